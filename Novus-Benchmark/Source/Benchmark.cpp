@@ -0,0 +1,210 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+namespace novus
+{
+
+namespace
+{
+	double RunTimed(BenchmarkFunction function, uint64_t iterations, uint64_t& bytesPerOp)
+	{
+		BenchmarkState state(iterations);
+
+		auto start = std::chrono::steady_clock::now();
+		function(state);
+		auto end = std::chrono::steady_clock::now();
+
+		bytesPerOp = state.GetBytesPerOp();
+
+		return std::chrono::duration<double>(end - start).count();
+	}
+}
+
+BenchmarkRegistry* BenchmarkRegistry::StaticInstance = nullptr;
+
+BenchmarkRegistry* BenchmarkRegistry::GetInstance()
+{
+	if (StaticInstance == nullptr)
+	{
+		StaticInstance = new BenchmarkRegistry();
+	}
+
+	return StaticInstance;
+}
+
+void BenchmarkRegistry::Register(const char* name, BenchmarkFunction function)
+{
+	Entry entry;
+	entry.Name = name;
+	entry.Function = function;
+
+	Benchmarks.push_back(entry);
+}
+
+std::vector<BenchmarkResult> BenchmarkRegistry::Run(const BenchmarkOptions& options) const
+{
+	std::vector<Entry> selected;
+
+	for (const auto& entry : Benchmarks)
+	{
+		if (options.Filter.empty() || std::string(entry.Name).find(options.Filter) != std::string::npos)
+			selected.push_back(entry);
+	}
+
+	std::sort(selected.begin(), selected.end(), [](const Entry& a, const Entry& b) { return std::string(a.Name) < std::string(b.Name); });
+
+	printf("%-40s %14s %14s %14s %9s %12s %12s\n", "Benchmark", "median ns/op", "min ns/op", "mean ns/op", "stddev", "bytes/op", "MB/s");
+
+	std::vector<BenchmarkResult> results;
+	results.reserve(selected.size());
+
+	for (const auto& entry : selected)
+	{
+		BenchmarkResult result = RunBenchmark(entry, options);
+
+		const double megabytesPerSecond = result.BytesPerOp > 0 ?
+			(static_cast<double>(result.BytesPerOp) / result.MedianNs) * 1000.0 : 0.0;
+
+		printf("%-40s %14.2f %14.2f %14.2f %8.2f%% %12llu %12.1f\n",
+			result.Name.c_str(),
+			result.MedianNs,
+			result.MinNs,
+			result.MeanNs,
+			result.MeanNs > 0.0 ? result.StdDevNs / result.MeanNs * 100.0 : 0.0,
+			static_cast<unsigned long long>(result.BytesPerOp),
+			megabytesPerSecond);
+		fflush(stdout);
+
+		results.push_back(result);
+	}
+
+	return results;
+}
+
+void BenchmarkRegistry::RegisterCheck(const char* name, VerifyFunction function)
+{
+	CheckEntry entry;
+	entry.Name = name;
+	entry.Function = function;
+
+	Checks.push_back(entry);
+}
+
+bool BenchmarkRegistry::RunChecks(const BenchmarkOptions& options) const
+{
+	uint32_t failed = 0;
+	uint32_t run = 0;
+
+	for (const auto& entry : Checks)
+	{
+		if (!options.Filter.empty() && std::string(entry.Name).find(options.Filter) == std::string::npos)
+			continue;
+
+		const bool bPassed = entry.Function();
+		printf("%-40s %s\n", entry.Name, bPassed ? "passed" : "FAILED");
+		fflush(stdout);
+
+		run++;
+		if (!bPassed)
+			failed++;
+	}
+
+	printf("%u of %u checks passed\n", run - failed, run);
+
+	return failed == 0;
+}
+
+bool VerifyNear(const char* what, double value, double expected, double tolerance)
+{
+	//Written so NaN fails
+	if (fabs(value - expected) <= tolerance)
+		return true;
+
+	printf("  %s: %.9g, expected %.9g within %.3g\n", what, value, expected, tolerance);
+	return false;
+}
+
+void BenchmarkRegistry::PrintNames() const
+{
+	for (const auto& entry : Benchmarks)
+	{
+		printf("%s\n", entry.Name);
+	}
+}
+
+BenchmarkResult BenchmarkRegistry::RunBenchmark(const Entry& entry, const BenchmarkOptions& options) const
+{
+	uint64_t bytesPerOp = 0;
+	uint64_t iterations = 1;
+	double elapsed = 0.0;
+	double warmupElapsed = 0.0;
+
+	//Grow the iteration count until one repetition takes long enough to be timed reliably, this also warms up caches and lazily created data
+	for (;;)
+	{
+		elapsed = RunTimed(entry.Function, iterations, bytesPerOp);
+		warmupElapsed += elapsed;
+
+		if (elapsed >= options.MinRepetitionSeconds)
+			break;
+
+		double scale = elapsed > 0.0 ? (options.MinRepetitionSeconds / elapsed) * 1.2 : 10.0;
+		scale = std::min(std::max(scale, 2.0), 10.0);
+
+		iterations = static_cast<uint64_t>(static_cast<double>(iterations) * scale);
+	}
+
+	while (warmupElapsed < options.WarmupSeconds)
+	{
+		warmupElapsed += RunTimed(entry.Function, iterations, bytesPerOp);
+	}
+
+	const uint32_t repetitions = std::max(options.Repetitions, 1u);
+
+	std::vector<double> samples;
+	samples.reserve(repetitions);
+
+	for (uint32_t i = 0; i < repetitions; i++)
+	{
+		const double seconds = RunTimed(entry.Function, iterations, bytesPerOp);
+		samples.push_back(seconds * 1000000000.0 / static_cast<double>(iterations));
+	}
+
+	std::sort(samples.begin(), samples.end());
+
+	double sum = 0.0;
+	for (double sample : samples)
+	{
+		sum += sample;
+	}
+
+	const double mean = sum / static_cast<double>(samples.size());
+
+	double variance = 0.0;
+	for (double sample : samples)
+	{
+		variance += (sample - mean) * (sample - mean);
+	}
+
+	variance /= static_cast<double>(samples.size());
+
+	const size_t middle = samples.size() / 2;
+
+	BenchmarkResult result;
+	result.Name = entry.Name;
+	result.Iterations = iterations;
+	result.Repetitions = repetitions;
+	result.MinNs = samples.front();
+	result.MaxNs = samples.back();
+	result.MeanNs = mean;
+	result.MedianNs = (samples.size() % 2 == 0) ? (samples[middle - 1] + samples[middle]) * 0.5 : samples[middle];
+	result.StdDevNs = sqrt(variance);
+	result.BytesPerOp = bytesPerOp;
+
+	return result;
+}
+
+}
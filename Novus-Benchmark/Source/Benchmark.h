@@ -0,0 +1,210 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/**
+ *	Minimal microbenchmark harness.
+ *
+ *	Benchmarks are free functions registered with NE_BENCHMARK. Each call has to run the operation
+ *	state.GetIterations() times, setup that should not be timed can be done in function local statics
+ *	since the first calls happen during calibration and warmup.
+ *
+ *	Example: NE_BENCHMARK(FooUpdate)
+ *			 {
+ *				 for (uint64_t i = 0; i < state.GetIterations(); i++)
+ *					 novus::DoNotOptimize(Foo(i));
+ *
+ *				 state.SetBytesPerOp(sizeof(Foo));
+ *			 }
+ */
+
+#define NE_BENCHMARK(name) \
+	static void name(novus::BenchmarkState& state); \
+	static novus::BenchmarkRegistrar name##Registrar(#name, &name); \
+	static void name(novus::BenchmarkState& state)
+
+/**
+ *	Correctness checks for the benchmarked code, run with --verify instead of the benchmarks.
+ *	A check prints what went wrong and returns false on failure.
+ *
+ *	Example: NE_VERIFY(FooMatchesReference)
+ *			 {
+ *				 return novus::VerifyNear("Foo", Foo(0.5f), 0.25f, 1.0e-6f);
+ *			 }
+ */
+#define NE_VERIFY(name) \
+	static bool name(); \
+	static novus::VerifyRegistrar name##Registrar(#name, &name); \
+	static bool name()
+
+namespace novus
+{
+
+class BenchmarkState
+{
+public:
+	explicit BenchmarkState(uint64_t iterations)
+		:Iterations(iterations),
+		BytesPerOp(0)
+	{}
+
+	uint64_t GetIterations() const { return Iterations; }
+
+	/**
+	 *	Number of bytes read and written by one iteration, used to report throughput.
+	 */
+	void SetBytesPerOp(uint64_t bytes) { BytesPerOp = bytes; }
+	uint64_t GetBytesPerOp() const { return BytesPerOp; }
+
+private:
+	uint64_t Iterations;
+	uint64_t BytesPerOp;
+};
+
+typedef void(*BenchmarkFunction)(BenchmarkState& state);
+typedef bool(*VerifyFunction)();
+
+struct BenchmarkOptions
+{
+	BenchmarkOptions()
+		:WarmupSeconds(0.1),
+		MinRepetitionSeconds(0.05),
+		Repetitions(10)
+	{}
+
+	double WarmupSeconds;
+	double MinRepetitionSeconds;
+	uint32_t Repetitions;
+
+	//Only benchmarks containing this string are run
+	std::string Filter;
+};
+
+struct BenchmarkResult
+{
+	std::string Name;
+
+	uint64_t Iterations;
+	uint32_t Repetitions;
+
+	//Time per operation statistics across all repetitions
+	double MinNs;
+	double MedianNs;
+	double MeanNs;
+	double MaxNs;
+	double StdDevNs;
+
+	uint64_t BytesPerOp;
+};
+
+class BenchmarkRegistry
+{
+public:
+	static BenchmarkRegistry* GetInstance();
+
+	void Register(const char* name, BenchmarkFunction function);
+	void RegisterCheck(const char* name, VerifyFunction function);
+
+	/**
+	 *	Runs every benchmark matching the filter and prints a line for each one as it finishes.
+	 */
+	std::vector<BenchmarkResult> Run(const BenchmarkOptions& options) const;
+
+	/**
+	 *	Runs every check matching the filter.
+	 *	@returns False if any of them failed
+	 */
+	bool RunChecks(const BenchmarkOptions& options) const;
+
+	void PrintNames() const;
+
+private:
+	struct Entry
+	{
+		const char* Name;
+		BenchmarkFunction Function;
+	};
+
+	struct CheckEntry
+	{
+		const char* Name;
+		VerifyFunction Function;
+	};
+
+	//Only allow access via GetInstance
+	BenchmarkRegistry() {}
+	~BenchmarkRegistry() {}
+	BenchmarkRegistry(const BenchmarkRegistry&) = delete;
+	BenchmarkRegistry& operator= (const BenchmarkRegistry&) = delete;
+
+	BenchmarkResult RunBenchmark(const Entry& entry, const BenchmarkOptions& options) const;
+
+private:
+	static BenchmarkRegistry* StaticInstance;
+
+	std::vector<Entry> Benchmarks;
+	std::vector<CheckEntry> Checks;
+};
+
+struct BenchmarkRegistrar
+{
+	BenchmarkRegistrar(const char* name, BenchmarkFunction function)
+	{
+		BenchmarkRegistry::GetInstance()->Register(name, function);
+	}
+};
+
+struct VerifyRegistrar
+{
+	VerifyRegistrar(const char* name, VerifyFunction function)
+	{
+		BenchmarkRegistry::GetInstance()->RegisterCheck(name, function);
+	}
+};
+
+/**
+ *	Prints a failure for a check if value isn't within tolerance of expected.
+ */
+bool VerifyNear(const char* what, double value, double expected, double tolerance);
+
+/**
+ *	Prevents the compiler from optimizing away the computation of value.
+ */
+template <typename T>
+inline void DoNotOptimize(const T& value)
+{
+#ifdef _MSC_VER
+	const volatile char* volatile sink = reinterpret_cast<const volatile char*>(&value);
+	(void)sink;
+	_ReadWriteBarrier();
+#else
+	asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+/**
+ *	Forces all pending memory writes to be treated as observable.
+ */
+inline void ClobberMemory()
+{
+#ifdef _MSC_VER
+	_ReadWriteBarrier();
+#else
+	asm volatile("" : : : "memory");
+#endif
+}
+
+}
@@ -0,0 +1,402 @@
+#include "Benchmark.h"
+#include <Utility/Delegates/Delegate.h>
+#include <Utility/Delegates/MulticastDelegate.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+using namespace novus;
+
+namespace
+{
+	//Functors that can't be called with the delegate's parameters, or whose result doesn't convert, are rejected by overload resolution
+	static_assert(std::is_constructible<Delegate<int, int>, int(*)(int)>::value, "Matching functor should convert");
+	static_assert(std::is_constructible<Delegate<double, int>, int(*)(long)>::value, "Convertible parameters and result should convert");
+	static_assert(!std::is_constructible<Delegate<void, int>, void(*)(const char*)>::value, "Functor with the wrong parameters should not convert");
+	static_assert(!std::is_constructible<Delegate<int, int>, void(*)(int)>::value, "Functor with a result that can't be returned should not convert");
+	static_assert(!std::is_constructible<Delegate<void, int>, int>::value, "Non-callable type should not convert");
+
+	const uint32_t ListenerCount = 8;
+
+	struct Listener
+	{
+		Listener()
+			:Total(0)
+		{}
+
+		void OnEvent(int value)
+		{
+			Total += value;
+		}
+
+		int Total;
+	};
+
+	//Listener with enough work per call that spreading them across threads pays off
+	struct HeavyListener
+	{
+		HeavyListener()
+			:Total(0)
+		{}
+
+		void OnEvent(int value)
+		{
+			uint32_t hash = static_cast<uint32_t>(value);
+
+			for (uint32_t i = 0; i < 2000; i++)
+			{
+				hash = (hash ^ i) * 16777619u;
+			}
+
+			Total += hash;
+		}
+
+		uint32_t Total;
+	};
+
+	template <bool bParallel>
+	void DispatchHeavyListeners(BenchmarkState& state, uint32_t listenerCount)
+	{
+		static std::vector<HeavyListener> listeners;
+		listeners.assign(listenerCount, HeavyListener());
+
+		MulticastDelegate<void, int> multicast;
+
+		for (auto& listener : listeners)
+		{
+			multicast.Add(NE_Delegate(&listener, &HeavyListener::OnEvent), true);
+		}
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			if (bParallel)
+				multicast.InvokeParallel(static_cast<int>(i));
+			else
+				multicast(static_cast<int>(i));
+		}
+
+		DoNotOptimize(listeners[0].Total);
+	}
+
+	/**
+	 *	The std::list based MulticastDelegate the contiguous version replaced, kept as a baseline
+	 */
+	template <typename return_type, typename ... params>
+	class ListMulticastDelegate
+	{
+	public:
+		void operator() (params... xs) const
+		{
+			for (const auto& d : Delegates)
+			{
+				d(xs...);
+			}
+		}
+
+		ListMulticastDelegate& operator+= (const Delegate<return_type, params...>& d)
+		{
+			Delegates.push_back(d);
+
+			return *this;
+		}
+
+		ListMulticastDelegate& operator-= (const Delegate<return_type, params...>& d)
+		{
+			auto endIt = std::remove_if(Delegates.begin(), Delegates.end(),
+				[&](const Delegate<return_type, params...>& other)
+			{ return d == other; });
+
+			Delegates.erase(endIt, Delegates.end());
+
+			return *this;
+		}
+
+	private:
+		std::list<Delegate<return_type, params...>> Delegates;
+	};
+
+	template <typename TMulticast>
+	void DispatchListeners(BenchmarkState& state, uint32_t listenerCount)
+	{
+		static std::vector<Listener> listeners;
+		listeners.assign(listenerCount, Listener());
+
+		TMulticast multicast;
+
+		for (auto& listener : listeners)
+		{
+			multicast += NE_Delegate(&listener, &Listener::OnEvent);
+		}
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			multicast(static_cast<int>(i));
+			ClobberMemory();
+		}
+
+		DoNotOptimize(listeners[0].Total);
+	}
+}
+
+NE_BENCHMARK(DelegateInvoke)
+{
+	Listener listener;
+	auto d = NE_Delegate(&listener, &Listener::OnEvent);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		d(static_cast<int>(i));
+		ClobberMemory();
+	}
+
+	DoNotOptimize(listener.Total);
+}
+
+NE_BENCHMARK(StdFunctionInvoke)
+{
+	Listener listener;
+	std::function<void(int)> f = std::bind(&Listener::OnEvent, &listener, std::placeholders::_1);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		f(static_cast<int>(i));
+		ClobberMemory();
+	}
+
+	DoNotOptimize(listener.Total);
+}
+
+NE_BENCHMARK(DelegateConstruct)
+{
+	Listener listener;
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		auto d = NE_Delegate(&listener, &Listener::OnEvent);
+		DoNotOptimize(d);
+	}
+
+	state.SetBytesPerOp(sizeof(Delegate<void, int>));
+}
+
+NE_BENCHMARK(StdFunctionConstruct)
+{
+	Listener listener;
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		std::function<void(int)> f = std::bind(&Listener::OnEvent, &listener, std::placeholders::_1);
+		DoNotOptimize(f);
+	}
+
+	state.SetBytesPerOp(sizeof(std::function<void(int)>));
+}
+
+NE_BENCHMARK(DelegateLambdaInvoke)
+{
+	Listener listener;
+	int scale = 3;
+	Delegate<void, int> d = [&listener, scale](int value) { listener.Total += value * scale; };
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		d(static_cast<int>(i));
+		ClobberMemory();
+	}
+
+	DoNotOptimize(listener.Total);
+}
+
+NE_BENCHMARK(StdFunctionLambdaInvoke)
+{
+	Listener listener;
+	int scale = 3;
+	std::function<void(int)> f = [&listener, scale](int value) { listener.Total += value * scale; };
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		f(static_cast<int>(i));
+		ClobberMemory();
+	}
+
+	DoNotOptimize(listener.Total);
+}
+
+//Captures larger than std::function's small buffer make it allocate, Delegate stores them inline
+NE_BENCHMARK(DelegateLambdaConstruct)
+{
+	Listener listener;
+	Listener* other = &listener;
+	int scale = 3;
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		Delegate<void, int> d = [&listener, other, scale](int value) { listener.Total += value * scale + other->Total; };
+		DoNotOptimize(d);
+	}
+
+	state.SetBytesPerOp(sizeof(Delegate<void, int>));
+}
+
+NE_BENCHMARK(StdFunctionLambdaConstruct)
+{
+	Listener listener;
+	Listener* other = &listener;
+	int scale = 3;
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		std::function<void(int)> f = [&listener, other, scale](int value) { listener.Total += value * scale + other->Total; };
+		DoNotOptimize(f);
+	}
+
+	state.SetBytesPerOp(sizeof(std::function<void(int)>));
+}
+
+NE_BENCHMARK(MulticastDelegateDispatch8)
+{
+	Listener listeners[ListenerCount];
+	MulticastDelegate<void, int> multicast;
+
+	for (auto& listener : listeners)
+	{
+		multicast += NE_Delegate(&listener, &Listener::OnEvent);
+	}
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		multicast(static_cast<int>(i));
+		ClobberMemory();
+	}
+
+	DoNotOptimize(listeners[0].Total);
+}
+
+NE_BENCHMARK(StdFunctionVectorDispatch8)
+{
+	Listener listeners[ListenerCount];
+	std::vector<std::function<void(int)>> functions;
+
+	for (auto& listener : listeners)
+	{
+		functions.push_back(std::bind(&Listener::OnEvent, &listener, std::placeholders::_1));
+	}
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		for (const auto& f : functions)
+		{
+			f(static_cast<int>(i));
+		}
+
+		ClobberMemory();
+	}
+
+	DoNotOptimize(listeners[0].Total);
+}
+
+NE_BENCHMARK(MulticastDelegateDispatch1K)
+{
+	DispatchListeners<MulticastDelegate<void, int>>(state, 1000);
+}
+
+NE_BENCHMARK(ListMulticastDelegateDispatch1K)
+{
+	DispatchListeners<ListMulticastDelegate<void, int>>(state, 1000);
+}
+
+NE_BENCHMARK(MulticastDelegateDispatch10K)
+{
+	DispatchListeners<MulticastDelegate<void, int>>(state, 10000);
+}
+
+NE_BENCHMARK(ListMulticastDelegateDispatch10K)
+{
+	DispatchListeners<ListMulticastDelegate<void, int>>(state, 10000);
+}
+
+//Remove and re-add one listener out of 1000 per iteration
+NE_BENCHMARK(MulticastDelegateChurn1K)
+{
+	static std::vector<Listener> listeners(1000);
+	static std::vector<DelegateHandle> handles;
+	MulticastDelegate<void, int> multicast;
+
+	handles.clear();
+
+	for (auto& listener : listeners)
+	{
+		handles.push_back(multicast.Add(NE_Delegate(&listener, &Listener::OnEvent)));
+	}
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		const size_t index = static_cast<size_t>((i * 7919) % listeners.size());
+
+		multicast.Remove(handles[index]);
+		handles[index] = multicast.Add(NE_Delegate(&listeners[index], &Listener::OnEvent));
+	}
+
+	DoNotOptimize(multicast.GetSize());
+}
+
+NE_BENCHMARK(ListMulticastDelegateChurn1K)
+{
+	static std::vector<Listener> listeners(1000);
+	ListMulticastDelegate<void, int> multicast;
+
+	for (auto& listener : listeners)
+	{
+		multicast += NE_Delegate(&listener, &Listener::OnEvent);
+	}
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		const size_t index = static_cast<size_t>((i * 7919) % listeners.size());
+
+		multicast -= NE_Delegate(&listeners[index], &Listener::OnEvent);
+		multicast += NE_Delegate(&listeners[index], &Listener::OnEvent);
+	}
+
+	DoNotOptimize(multicast);
+}
+
+NE_BENCHMARK(MulticastDelegateHeavy1K)
+{
+	DispatchHeavyListeners<false>(state, 1000);
+}
+
+NE_BENCHMARK(MulticastDelegateHeavyParallel1K)
+{
+	DispatchHeavyListeners<true>(state, 1000);
+}
+
+//A listener that dispatches again in parallel runs serially instead of deadlocking the pool
+NE_VERIFY(NestedInvokeParallel)
+{
+	ThreadPool pool(3);
+	std::atomic<uint32_t> total(0);
+
+	MulticastDelegate<void, uint32_t> outer;
+
+	for (uint32_t i = 0; i < 64; i++)
+	{
+		outer.Add([&pool, &total](uint32_t value)
+		{
+			pool.ParallelFor(16, 2, [&total, value](size_t begin, size_t end)
+			{
+				for (size_t i = begin; i < end; i++)
+				{
+					total += value;
+				}
+			});
+		}, true);
+	}
+
+	outer.InvokeParallel(pool, 1, 1);
+
+	return VerifyNear("nested total", total.load(), 64.0 * 16.0, 0.0);
+}
@@ -0,0 +1,51 @@
+#include "Benchmark.h"
+#include <Utility/Geometry/GeometryGenerator.h>
+
+using namespace novus;
+
+namespace
+{
+	void RunGeosphere(BenchmarkState& state, uint32_t subdivisions)
+	{
+		GeometryGenerator::Mesh mesh;
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			mesh.Vertices.clear();
+			mesh.Indices.clear();
+
+			GeometryGenerator::CreateGeosphere(1.0f, subdivisions, mesh);
+			DoNotOptimize(mesh.Vertices.data());
+		}
+
+		//Output size of one generated mesh
+		state.SetBytesPerOp(mesh.Vertices.size() * sizeof(GeometryGenerator::Vertex) + mesh.Indices.size() * sizeof(uint32_t));
+	}
+}
+
+NE_BENCHMARK(CreateGeosphere2)
+{
+	RunGeosphere(state, 2);
+}
+
+NE_BENCHMARK(CreateGeosphere5)
+{
+	RunGeosphere(state, 5);
+}
+
+NE_BENCHMARK(CompressMeshGeosphere5)
+{
+	GeometryGenerator::Mesh mesh;
+	GeometryGenerator::CreateGeosphere(1.0f, 5, mesh);
+
+	GeometryGenerator::PackedMesh packed;
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		GeometryGenerator::CompressMesh(mesh, packed);
+		DoNotOptimize(packed.Vertices.data());
+	}
+
+	//Vertex data read per op, the packed vertices are 24 bytes instead of 44
+	state.SetBytesPerOp(mesh.Vertices.size() * sizeof(GeometryGenerator::Vertex));
+}
@@ -0,0 +1,543 @@
+#include "Benchmark.h"
+#include <Utility/Hashing/SHA1.h>
+#include <Utility/Hashing/FastHash.h>
+#include <Utility/Hashing/StringId.h>
+#include <Resources/Shader/Shader.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+using namespace novus;
+
+namespace
+{
+	std::vector<UINT_8> CreateBuffer(size_t size)
+	{
+		std::vector<UINT_8> buffer(size);
+
+		for (size_t i = 0; i < size; i++)
+		{
+			buffer[i] = static_cast<UINT_8>(i * 31 + 7);
+		}
+
+		return buffer;
+	}
+
+	void RunSHA1Update(BenchmarkState& state, size_t size)
+	{
+		const std::vector<UINT_8> buffer = CreateBuffer(size);
+		SHA1 hasher;
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			hasher.Update(buffer.data(), static_cast<UINT_32>(buffer.size()));
+		}
+
+		hasher.Finalize();
+		DoNotOptimize(hasher.GetHash());
+
+		state.SetBytesPerOp(size);
+	}
+
+	/**
+	 *	Runs a benchmark body with the given kernel selected, reporting nothing if the CPU does not support it
+	 */
+	template <typename TBody>
+	void RunWithKernel(BenchmarkState& state, SHA1Kernel kernel, TBody body)
+	{
+		if (!SHA1::SetKernel(kernel))
+			return;
+
+		body(state);
+
+		SHA1::ResetKernel();
+	}
+
+	void RunSHA1HashBuffers(BenchmarkState& state, uint32_t bufferCount, size_t size)
+	{
+		const std::vector<UINT_8> buffer = CreateBuffer(bufferCount * size);
+
+		std::vector<const UINT_8*> data(bufferCount);
+		std::vector<UINT_32> lengths(bufferCount, static_cast<UINT_32>(size));
+		std::vector<SHA1Hash> hashes(bufferCount);
+
+		for (uint32_t i = 0; i < bufferCount; i++)
+		{
+			data[i] = buffer.data() + i * size;
+		}
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			SHA1::HashBuffers(data.data(), lengths.data(), bufferCount, hashes.data());
+			DoNotOptimize(hashes.data());
+		}
+
+		state.SetBytesPerOp(bufferCount * size);
+	}
+
+	/**
+	 *	Hashes a short key from scratch each iteration, the way cache lookups use a hash
+	 */
+	void RunSHA1Key(BenchmarkState& state, size_t size)
+	{
+		const std::vector<UINT_8> key = CreateBuffer(size);
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			SHA1 hasher;
+			hasher.Update(key.data(), static_cast<UINT_32>(key.size()));
+			hasher.Finalize();
+			DoNotOptimize(hasher.GetHash());
+		}
+
+		state.SetBytesPerOp(size);
+	}
+
+	template <typename THash>
+	void RunFastHash(BenchmarkState& state, size_t size, THash hash)
+	{
+		const std::vector<UINT_8> key = CreateBuffer(size);
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			DoNotOptimize(hash(key.data(), key.size()));
+		}
+
+		state.SetBytesPerOp(size);
+	}
+
+	void RunFastHash64(BenchmarkState& state, size_t size)
+	{
+		RunFastHash(state, size, [](const UINT_8* data, size_t length) { return FastHash64(data, length); });
+	}
+
+	void RunFastHash128(BenchmarkState& state, size_t size)
+	{
+		RunFastHash(state, size, [](const UINT_8* data, size_t length) { return FastHash128(data, length); });
+	}
+
+	void RunFastHasherUpdate(BenchmarkState& state, size_t size)
+	{
+		const std::vector<UINT_8> buffer = CreateBuffer(size);
+		FastHasher hasher;
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			hasher.Update(buffer.data(), buffer.size());
+		}
+
+		DoNotOptimize(hasher.Finalize());
+
+		state.SetBytesPerOp(size);
+	}
+
+	std::vector<std::wstring> CreateNames(size_t count)
+	{
+		std::vector<std::wstring> names(count);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			names[i] = L"Resources/Textures/Material_" + std::to_wstring(i);
+		}
+
+		return names;
+	}
+
+	/**
+	 *	Looks up every name once per iteration, either by the string itself or by its precomputed id
+	 */
+	template <typename TKey, typename TMakeKey>
+	void RunNameLookup(BenchmarkState& state, TMakeKey makeKey)
+	{
+		const std::vector<std::wstring> names = CreateNames(256);
+		std::unordered_map<TKey, size_t> map;
+		std::vector<TKey> keys;
+
+		for (size_t i = 0; i < names.size(); i++)
+		{
+			keys.push_back(makeKey(names[i]));
+			map[keys.back()] = i;
+		}
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			size_t sum = 0;
+
+			for (const TKey& key : keys)
+			{
+				sum += map.find(key)->second;
+			}
+
+			DoNotOptimize(sum);
+		}
+	}
+
+	std::vector<ShaderMacro> CreateMacros(uint32_t count)
+	{
+		std::vector<ShaderMacro> macros(count);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			//Reverse order so an implementation that sorts the macros has work to do
+			macros[i].Name = "NE_SHADER_FEATURE_" + std::to_string(count - i);
+			macros[i].Definition = std::to_string(i);
+		}
+
+		return macros;
+	}
+
+	void RunHashMacros(BenchmarkState& state, uint32_t count)
+	{
+		const std::vector<ShaderMacro> macros = CreateMacros(count);
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			DoNotOptimize(ShaderBase::HashMacros(macros.data(), count));
+		}
+
+		uint64_t bytes = 0;
+		for (const auto& macro : macros)
+		{
+			bytes += macro.Name.size() + macro.Definition.size();
+		}
+
+		state.SetBytesPerOp(bytes);
+	}
+}
+
+NE_BENCHMARK(SHA1Update64)
+{
+	RunSHA1Update(state, 64);
+}
+
+NE_BENCHMARK(SHA1Update4K)
+{
+	RunSHA1Update(state, 4096);
+}
+
+NE_BENCHMARK(SHA1Update64K)
+{
+	RunSHA1Update(state, 65536);
+}
+
+NE_BENCHMARK(SHA1Update64KScalar)
+{
+	RunWithKernel(state, SHA1Kernel::Scalar, [](BenchmarkState& s) { RunSHA1Update(s, 65536); });
+}
+
+NE_BENCHMARK(SHA1Update64KSHANI)
+{
+	RunWithKernel(state, SHA1Kernel::SHANI, [](BenchmarkState& s) { RunSHA1Update(s, 65536); });
+}
+
+NE_BENCHMARK(SHA1HashBuffers64x4KScalar)
+{
+	RunWithKernel(state, SHA1Kernel::Scalar, [](BenchmarkState& s) { RunSHA1HashBuffers(s, 64, 4096); });
+}
+
+NE_BENCHMARK(SHA1HashBuffers64x4KSHANI)
+{
+	RunWithKernel(state, SHA1Kernel::SHANI, [](BenchmarkState& s) { RunSHA1HashBuffers(s, 64, 4096); });
+}
+
+NE_BENCHMARK(SHA1HashBuffers64x4KAVX2)
+{
+	RunWithKernel(state, SHA1Kernel::AVX2MultiBuffer, [](BenchmarkState& s) { RunSHA1HashBuffers(s, 64, 4096); });
+}
+
+NE_BENCHMARK(SHA1HashBuffers256x64AVX2)
+{
+	RunWithKernel(state, SHA1Kernel::AVX2MultiBuffer, [](BenchmarkState& s) { RunSHA1HashBuffers(s, 256, 64); });
+}
+
+NE_BENCHMARK(SHA1HashBuffers256x64SHANI)
+{
+	RunWithKernel(state, SHA1Kernel::SHANI, [](BenchmarkState& s) { RunSHA1HashBuffers(s, 256, 64); });
+}
+
+NE_BENCHMARK(SHA1Key100)
+{
+	RunSHA1Key(state, 100);
+}
+
+NE_BENCHMARK(FastHash64Key100)
+{
+	RunFastHash64(state, 100);
+}
+
+NE_BENCHMARK(FastHash128Key100)
+{
+	RunFastHash128(state, 100);
+}
+
+NE_BENCHMARK(FastHash64Key16)
+{
+	RunFastHash64(state, 16);
+}
+
+NE_BENCHMARK(FastHash64_64K)
+{
+	RunFastHash64(state, 65536);
+}
+
+NE_BENCHMARK(FastHasherUpdate64K)
+{
+	RunFastHasherUpdate(state, 65536);
+}
+
+NE_BENCHMARK(NameLookup256WString)
+{
+	RunNameLookup<std::wstring>(state, [](const std::wstring& name) { return name; });
+}
+
+NE_BENCHMARK(NameLookup256StringId)
+{
+	RunNameLookup<StringId>(state, [](const std::wstring& name) { return StringId::FromString(name); });
+}
+
+NE_BENCHMARK(StringIdFromString)
+{
+	const std::wstring name = L"Resources/Textures/Material_0";
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		DoNotOptimize(StringId::FromString(name));
+	}
+
+	state.SetBytesPerOp(name.size() * sizeof(wchar_t));
+}
+
+NE_BENCHMARK(HashMacros4)
+{
+	RunHashMacros(state, 4);
+}
+
+NE_BENCHMARK(HashMacros16)
+{
+	RunHashMacros(state, 16);
+}
+
+//Reference results from wyhash final version 4, the string vectors are from its test_vector.cpp and use their index as the seed
+NE_VERIFY(FastHash64Vectors)
+{
+	static const char* const messages[] =
+	{
+		"",
+		"a",
+		"abc",
+		"message digest",
+		"abcdefghijklmnopqrstuvwxyz",
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+		"12345678901234567890123456789012345678901234567890123456789012345678901234567890"
+	};
+
+	static const uint64_t messageHashes[] =
+	{
+		0x93228a4de0eec5a2ull, 0xc5bac3db178713c4ull, 0xa97f2f7b1d9b3314ull, 0x786d1f1df3801df4ull,
+		0xdca5a8138ad37c87ull, 0xb9e734f117cfaf70ull, 0x6cc5eab49a92d617ull
+	};
+
+	//Lengths around the 48 byte stripes of CreateBuffer's data, with seed 0
+	static const struct { size_t Length; uint64_t Hash; } bufferHashes[] =
+	{
+		{ 17, 0xb3889b861f2af496ull },
+		{ 47, 0x1aba2071ed635298ull },
+		{ 48, 0x09a8616e6549b4c8ull },
+		{ 49, 0x0c4d8b68d0152146ull },
+		{ 95, 0x12c10abb4fce6653ull },
+		{ 96, 0x8b8f3bc122adeeaeull },
+		{ 97, 0xe9848a86f5cae82full },
+		{ 144, 0xd19ebc95b64f3463ull },
+		{ 1000, 0x8bd67e4d12b06c67ull },
+	};
+
+	bool bPassed = true;
+
+	for (size_t i = 0; i < sizeof(messages) / sizeof(messages[0]); i++)
+	{
+		const uint64_t hash = FastHash64(messages[i], strlen(messages[i]), i);
+
+		if (hash != messageHashes[i])
+		{
+			printf("  \"%s\": %016llx, expected %016llx\n", messages[i], static_cast<unsigned long long>(hash), static_cast<unsigned long long>(messageHashes[i]));
+			bPassed = false;
+		}
+	}
+
+	const std::vector<UINT_8> buffer = CreateBuffer(1000);
+
+	for (const auto& expected : bufferHashes)
+	{
+		const uint64_t hash = FastHash64(buffer.data(), expected.Length);
+
+		if (hash != expected.Hash)
+		{
+			printf("  %zu bytes: %016llx, expected %016llx\n", expected.Length, static_cast<unsigned long long>(hash), static_cast<unsigned long long>(expected.Hash));
+			bPassed = false;
+		}
+	}
+
+	return bPassed;
+}
+
+NE_VERIFY(FastHasherMatchesFastHash64)
+{
+	const std::vector<UINT_8> buffer = CreateBuffer(400);
+	const size_t chunkSizes[] = { 1, 3, 16, 47, 48, 49, 96, 400 };
+
+	bool bPassed = true;
+
+	for (size_t length = 0; length <= buffer.size(); length++)
+	{
+		const uint64_t expected = FastHash64(buffer.data(), length, 7);
+
+		for (size_t chunkSize : chunkSizes)
+		{
+			FastHasher hasher(7);
+
+			for (size_t offset = 0; offset < length; offset += chunkSize)
+				hasher.Update(buffer.data() + offset, std::min(chunkSize, length - offset));
+
+			if (hasher.Finalize() != expected)
+			{
+				printf("  %zu bytes in %zu byte chunks differs from the one-shot hash\n", length, chunkSize);
+				bPassed = false;
+			}
+		}
+	}
+
+	return bPassed;
+}
+
+//Kernels the CPU doesn't support are skipped. The scalar kernel reads message words in native byte order, so on little endian
+//machines its hashes differ from FIPS 180 SHA-1, the "abc" hash below pins the engine's own output instead
+NE_VERIFY(SHA1KernelsMatchScalar)
+{
+	const std::vector<UINT_8> buffer = CreateBuffer(4096 + 77);
+
+	//Every tail length around the 64 byte block and the 56 byte padding boundary, then multi-block messages
+	std::vector<UINT_32> lengths;
+	for (UINT_32 length = 0; length <= 200; length++)
+		lengths.push_back(length);
+	lengths.push_back(1000);
+	lengths.push_back(4096);
+	lengths.push_back(static_cast<UINT_32>(buffer.size()));
+
+	const UINT_32 chunkSizes[] = { 1, 7, 63, 64, 65, 200 };
+
+	bool bPassed = true;
+
+	SHA1::SetKernel(SHA1Kernel::Scalar);
+
+	const UINT_8 abc[] = { 'a', 'b', 'c' };
+	const UINT_8 abcHash[20] = { 0x14, 0xc2, 0x06, 0x90, 0xf6, 0x53, 0xfb, 0x16, 0x39, 0x6e, 0x4f, 0x80, 0x4c, 0x9d, 0xaf, 0xb4, 0x6e, 0x51, 0x3d, 0x4f };
+
+	SHA1 reference;
+	reference.Hash(abc, 3);
+
+	if (memcmp(reference.GetHash().Hash, abcHash, sizeof(abcHash)) != 0)
+	{
+		printf("  scalar kernel changed the hash of \"abc\"\n");
+		bPassed = false;
+	}
+
+	std::vector<SHA1Hash> expected;
+
+	for (UINT_32 length : lengths)
+	{
+		reference.Hash(buffer.data(), length);
+		expected.push_back(reference.GetHash());
+	}
+
+	if (SHA1::SetKernel(SHA1Kernel::SHANI))
+	{
+		for (size_t i = 0; i < lengths.size(); i++)
+		{
+			SHA1 hasher;
+			hasher.Hash(buffer.data(), lengths[i]);
+
+			if (hasher.GetHash() != expected[i])
+			{
+				printf("  SHA-NI kernel differs on %u bytes\n", lengths[i]);
+				bPassed = false;
+			}
+
+			//Split updates leave partial blocks in the hasher's buffer between calls
+			for (UINT_32 chunkSize : chunkSizes)
+			{
+				hasher.Reset();
+
+				for (UINT_32 offset = 0; offset < lengths[i]; offset += chunkSize)
+					hasher.Update(buffer.data() + offset, std::min(chunkSize, lengths[i] - offset));
+
+				hasher.Finalize();
+
+				if (hasher.GetHash() != expected[i])
+				{
+					printf("  SHA-NI kernel differs on %u bytes in %u byte chunks\n", lengths[i], chunkSize);
+					bPassed = false;
+				}
+			}
+		}
+	}
+
+	if (SHA1::SetKernel(SHA1Kernel::AVX2MultiBuffer))
+	{
+		//Buffers of different lengths go idle at different blocks, so lanes are masked off part way through
+		std::vector<const UINT_8*> data(lengths.size());
+		std::vector<SHA1Hash> hashes(lengths.size());
+
+		for (size_t i = 0; i < lengths.size(); i++)
+			data[i] = buffer.data() + (i % 5);
+
+		std::vector<UINT_32> offsetLengths(lengths);
+		for (size_t i = 0; i < lengths.size(); i++)
+			offsetLengths[i] = std::min(lengths[i], static_cast<UINT_32>(buffer.size() - i % 5));
+
+		SHA1::HashBuffers(data.data(), offsetLengths.data(), lengths.size(), hashes.data());
+
+		SHA1::SetKernel(SHA1Kernel::Scalar);
+
+		for (size_t i = 0; i < lengths.size(); i++)
+		{
+			SHA1 hasher;
+			hasher.Hash(data[i], offsetLengths[i]);
+
+			if (hashes[i] != hasher.GetHash())
+			{
+				printf("  AVX2 multi-buffer kernel differs on buffer %zu of %u bytes\n", i, offsetLengths[i]);
+				bPassed = false;
+			}
+		}
+	}
+
+	SHA1::ResetKernel();
+
+	return bPassed;
+}
+
+NE_VERIFY(StringIdLiteralsMatchFromString)
+{
+	bool bPassed = true;
+
+	auto check = [&](const char* what, StringId literal, StringId runtime)
+	{
+		if (literal != runtime)
+		{
+			printf("  %s: %016llx, expected %016llx\n", what, static_cast<unsigned long long>(literal.GetValue()), static_cast<unsigned long long>(runtime.GetValue()));
+			bPassed = false;
+		}
+	};
+
+	check("\"Rendering\"_id", "Rendering"_id, StringId::FromString("Rendering"));
+	check("L\"Rendering\"_id", L"Rendering"_id, StringId::FromString(L"Rendering"));
+	check("L\"Rendering\"_id, narrow FromString", L"Rendering"_id, StringId::FromString(std::string("Rendering")));
+	check("\"\"_id", ""_id, StringId::FromString(""));
+	check("non ASCII L\"Gr\\u00fc\\u00dfe\"_id", L"Gr\u00fc\u00dfe"_id, StringId::FromString(std::wstring(L"Gr\u00fc\u00dfe")));
+	check("non ASCII \"Gr\\xc3\\xbc\"_id", "Gr\xc3\xbc"_id, StringId::FromString(std::string("Gr\xc3\xbc")));
+
+	return bPassed;
+}
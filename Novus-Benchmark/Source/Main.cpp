@@ -0,0 +1,85 @@
+#include "Benchmark.h"
+#include "RHIBenchmarks.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace novus;
+
+namespace
+{
+	void PrintUsage(const char* executable)
+	{
+		printf("Usage: %s [options]\n", executable);
+		printf("  --filter <text>       Only run benchmarks with names containing text\n");
+		printf("  --repetitions <n>     Number of timed repetitions per benchmark (default 10)\n");
+		printf("  --min-time <seconds>  Minimum duration of one repetition (default 0.05)\n");
+		printf("  --warmup <seconds>    Minimum warmup time per benchmark (default 0.1)\n");
+		printf("  --list                List all benchmarks and exit\n");
+		printf("  --verify              Run the correctness checks matching the filter instead of the benchmarks\n");
+		printf("  --capture <file>      Write a capture of the synthetic RHI frame and exit\n");
+		printf("  --replay <file>       Replay an RHI command capture against the null context and exit\n");
+	}
+}
+
+int main(int argc, char** argv)
+{
+	BenchmarkOptions options;
+	std::string replayPath;
+	bool bVerify = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const bool hasValue = i + 1 < argc;
+
+		if (strcmp(argv[i], "--filter") == 0 && hasValue)
+		{
+			options.Filter = argv[++i];
+		}
+		else if (strcmp(argv[i], "--repetitions") == 0 && hasValue)
+		{
+			options.Repetitions = static_cast<uint32_t>(atoi(argv[++i]));
+		}
+		else if (strcmp(argv[i], "--min-time") == 0 && hasValue)
+		{
+			options.MinRepetitionSeconds = atof(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--warmup") == 0 && hasValue)
+		{
+			options.WarmupSeconds = atof(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--list") == 0)
+		{
+			BenchmarkRegistry::GetInstance()->PrintNames();
+			return 0;
+		}
+		else if (strcmp(argv[i], "--verify") == 0)
+		{
+			bVerify = true;
+		}
+		else if (strcmp(argv[i], "--capture") == 0 && hasValue)
+		{
+			return WriteSyntheticCapture(argv[++i], 4096) ? 0 : 1;
+		}
+		else if (strcmp(argv[i], "--replay") == 0 && hasValue)
+		{
+			replayPath = argv[++i];
+		}
+		else
+		{
+			PrintUsage(argv[0]);
+			return 1;
+		}
+	}
+
+	//Replay after all options are parsed so the repetition count applies
+	if (!replayPath.empty())
+		return RunCaptureReplay(replayPath, options) ? 0 : 1;
+
+	if (bVerify)
+		return BenchmarkRegistry::GetInstance()->RunChecks(options) ? 0 : 1;
+
+	BenchmarkRegistry::GetInstance()->Run(options);
+
+	return 0;
+}
@@ -0,0 +1,1753 @@
+#include "Benchmark.h"
+#include <Math/Math.h>
+#include <Math/Vector2.h>
+#include <Math/Vector3.h>
+#include <Math/Vector4.h>
+#include <Math/Matrix4.h>
+#include <Math/Matrix3x4.h>
+#include <Math/VectorA.h>
+#include <Math/Quaternion.h>
+#include <Math/BatchTransform.h>
+#include <Math/QuaternionBatch.h>
+#include <Math/FastMath.h>
+#include <Math/Random.h>
+#include <Math/Packing.h>
+#include <Math/WorldTransform.h>
+#include <Math/Primitives/BatchIntersection.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+using namespace novus;
+
+namespace
+{
+	//Kept a power of two so the benchmarks can wrap with a mask, small enough to stay in L1/L2
+	const uint32_t DataCount = 1024;
+	const uint32_t DataMask = DataCount - 1;
+
+	//Deterministic inputs so runs are comparable between builds
+	float NextFloat(uint32_t& seed)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		return static_cast<float>(seed >> 8) * (1.0f / 16777216.0f);
+	}
+
+	std::vector<Matrix4> CreateMatrices(uint32_t seed)
+	{
+		std::vector<Matrix4> matrices(DataCount);
+
+		for (auto& m : matrices)
+		{
+			m = Matrix4::Scale(0.5f + NextFloat(seed)) *
+				Matrix4::RotateY(NextFloat(seed) * Math::TwoPi) *
+				Matrix4::RotateX(NextFloat(seed) * Math::TwoPi) *
+				Matrix4::Translate(NextFloat(seed) * 100.0f, NextFloat(seed) * 100.0f, NextFloat(seed) * 100.0f);
+		}
+
+		return matrices;
+	}
+
+	std::vector<Quaternion> CreateQuaternions(uint32_t seed)
+	{
+		std::vector<Quaternion> quaternions(DataCount);
+
+		for (auto& q : quaternions)
+		{
+			Vector3 axis = Normalize(Vector3(NextFloat(seed) - 0.5f, NextFloat(seed) - 0.5f, NextFloat(seed) - 0.5f));
+			q = Quaternion::AxisAngle(axis, NextFloat(seed) * Math::TwoPi);
+		}
+
+		return quaternions;
+	}
+
+	std::vector<Vector4> CreateVectors(uint32_t seed)
+	{
+		std::vector<Vector4> vectors(DataCount);
+
+		for (auto& v : vectors)
+		{
+			v = Vector4(NextFloat(seed) * 100.0f, NextFloat(seed) * 100.0f, NextFloat(seed) * 100.0f, 1.0f);
+		}
+
+		return vectors;
+	}
+
+	template <typename TOp>
+	void RunMatrixBinary(BenchmarkState& state, TOp op)
+	{
+		static const std::vector<Matrix4> a = CreateMatrices(1);
+		static const std::vector<Matrix4> b = CreateMatrices(2);
+		static std::vector<Matrix4> result(DataCount);
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			const uint32_t index = static_cast<uint32_t>(i) & DataMask;
+			result[index] = op(a[index], b[index]);
+		}
+
+		DoNotOptimize(result[0]);
+		state.SetBytesPerOp(sizeof(Matrix4) * 3);
+	}
+
+	template <typename TOp>
+	void RunMatrixUnary(BenchmarkState& state, TOp op)
+	{
+		typedef decltype(op(Matrix4())) ResultType;
+
+		static const std::vector<Matrix4> a = CreateMatrices(3);
+		static std::vector<ResultType> result(DataCount);
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			const uint32_t index = static_cast<uint32_t>(i) & DataMask;
+			result[index] = op(a[index]);
+		}
+
+		DoNotOptimize(result[0]);
+		state.SetBytesPerOp(sizeof(Matrix4) + sizeof(ResultType));
+	}
+
+	template <typename TOp>
+	void RunMatrixVector(BenchmarkState& state, TOp op)
+	{
+		static const std::vector<Matrix4> a = CreateMatrices(7);
+		static const std::vector<Vector4> v = CreateVectors(8);
+		static std::vector<Vector4> result(DataCount);
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			const uint32_t index = static_cast<uint32_t>(i) & DataMask;
+			result[index] = op(a[index], v[index]);
+		}
+
+		DoNotOptimize(result[0]);
+		state.SetBytesPerOp(sizeof(Matrix4) + sizeof(Vector4) * 2);
+	}
+
+	//Interleaved like a typical mesh vertex, for the strided batch transforms
+	struct BenchmarkVertex
+	{
+		Vector3 Position;
+		Vector3 Normal;
+		Vector2 TexCoord;
+	};
+
+	std::vector<BenchmarkVertex> CreateVertices(uint32_t seed)
+	{
+		std::vector<BenchmarkVertex> vertices(DataCount);
+
+		for (auto& v : vertices)
+		{
+			v.Position = Vector3(NextFloat(seed) * 100.0f, NextFloat(seed) * 100.0f, NextFloat(seed) * 100.0f);
+			v.Normal = Normalize(Vector3(NextFloat(seed) - 0.5f, NextFloat(seed) - 0.5f, NextFloat(seed) - 0.5f));
+			v.TexCoord = Vector2(NextFloat(seed), NextFloat(seed));
+		}
+
+		return vertices;
+	}
+
+	/**
+	 *	Runs a benchmark body with the given batch transform kernel selected, reporting nothing if the CPU does not support it.
+	 *	Each op transforms all DataCount vertices.
+	 */
+	template <typename TBody>
+	void RunBatchTransform(BenchmarkState& state, BatchTransformKernel kernel, TBody body)
+	{
+		if (!SetBatchTransformKernel(kernel))
+			return;
+
+		static const Matrix4 m = CreateMatrices(9)[0];
+		static const std::vector<BenchmarkVertex> vertices = CreateVertices(10);
+		static std::vector<BenchmarkVertex> result(DataCount);
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			body(m, vertices.data(), result.data());
+			DoNotOptimize(result[0]);
+		}
+
+		state.SetBytesPerOp(sizeof(BenchmarkVertex) * DataCount * 2);
+
+		ResetBatchTransformKernel();
+	}
+
+	template <typename TBody>
+	void RunBatchTransformPacked(BenchmarkState& state, BatchTransformKernel kernel, TBody body)
+	{
+		if (!SetBatchTransformKernel(kernel))
+			return;
+
+		static const Matrix4 m = CreateMatrices(11)[0];
+		static std::vector<Vector3> points(DataCount);
+		static std::vector<Vector3> result(DataCount);
+
+		uint32_t seed = 12;
+		for (auto& p : points)
+			p = Vector3(NextFloat(seed) * 100.0f, NextFloat(seed) * 100.0f, NextFloat(seed) * 100.0f);
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			body(m, points.data(), result.data());
+			DoNotOptimize(result[0]);
+		}
+
+		state.SetBytesPerOp(sizeof(Vector3) * DataCount * 2);
+
+		ResetBatchTransformKernel();
+	}
+
+	//The same points as RunBatchTransformPacked stored as Vector3A
+	template <typename TBody>
+	void RunBatchTransformAligned(BenchmarkState& state, BatchTransformKernel kernel, TBody body)
+	{
+		if (!SetBatchTransformKernel(kernel))
+			return;
+
+		static const Matrix4 m = CreateMatrices(11)[0];
+		static std::vector<Vector3A> points(DataCount);
+		static std::vector<Vector3A> result(DataCount);
+
+		uint32_t seed = 12;
+		for (auto& p : points)
+			p = Vector3A(NextFloat(seed) * 100.0f, NextFloat(seed) * 100.0f, NextFloat(seed) * 100.0f);
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			body(m, points.data(), result.data());
+			DoNotOptimize(result[0]);
+		}
+
+		state.SetBytesPerOp(sizeof(Vector3A) * DataCount * 2);
+
+		ResetBatchTransformKernel();
+	}
+
+	void TransformAlignedPoints(const Matrix4& m, const Vector3A* in, Vector3A* out)
+	{
+		TransformPoints(m, in, out, DataCount);
+	}
+
+	void TransformAlignedNormals(const Matrix4& m, const Vector3A* in, Vector3A* out)
+	{
+		TransformNormals(m, in, out, DataCount);
+	}
+
+	void TransformPackedPoints(const Matrix4& m, const Vector3* in, Vector3* out)
+	{
+		TransformPoints(m, in, sizeof(Vector3), out, DataCount);
+	}
+
+	void TransformVertexPositions(const Matrix4& m, const BenchmarkVertex* in, BenchmarkVertex* out)
+	{
+		TransformPoints(m, &in->Position, sizeof(BenchmarkVertex), &out->Position, DataCount);
+	}
+
+	void TransformVertexNormals(const Matrix4& m, const BenchmarkVertex* in, BenchmarkVertex* out)
+	{
+		TransformNormals(m, &in->Normal, sizeof(BenchmarkVertex), &out->Normal, DataCount);
+	}
+
+	//Fills DataCount floats per op with body(out)
+	template <typename TBody>
+	void RunRandomFloats(BenchmarkState& state, TBody body)
+	{
+		static std::vector<float> result(DataCount);
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			body(result.data());
+			DoNotOptimize(result[0]);
+		}
+
+		state.SetBytesPerOp(sizeof(float) * DataCount);
+	}
+
+	//DataCount values in [-8, 8) and their halves
+	struct HalfData
+	{
+		std::vector<float> Floats;
+		std::vector<uint16_t> Halves;
+
+		HalfData()
+			: Floats(DataCount), Halves(DataCount)
+		{
+			uint32_t seed = 11;
+
+			for (auto& f : Floats)
+				f = NextFloat(seed) * 16.0f - 8.0f;
+
+			FloatsToHalves(Floats.data(), Halves.data(), DataCount);
+		}
+	};
+
+	//Runs body(data) once per op, each op converts DataCount values
+	template <typename TBody>
+	void RunPacking(BenchmarkState& state, size_t bytesPerValue, TBody body)
+	{
+		static HalfData data;
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			body(data);
+			DoNotOptimize(data.Floats[0]);
+			DoNotOptimize(data.Halves[0]);
+		}
+
+		state.SetBytesPerOp(bytesPerValue * DataCount);
+	}
+
+	//DataCount world positions around 100 km from the world origin, with a view origin among them
+	struct WorldPositionData
+	{
+		std::vector<double> X, Y, Z;
+		std::vector<float> RelativeX, RelativeY, RelativeZ;
+		Vector3d Origin;
+
+		WorldPositionData()
+			: X(DataCount), Y(DataCount), Z(DataCount), RelativeX(DataCount), RelativeY(DataCount), RelativeZ(DataCount),
+			Origin(100000.0, 20.0, -100000.0)
+		{
+			uint32_t seed = 13;
+
+			for (uint32_t i = 0; i < DataCount; i++)
+			{
+				X[i] = Origin.x + (NextFloat(seed) - 0.5) * 1000.0;
+				Y[i] = Origin.y + (NextFloat(seed) - 0.5) * 1000.0;
+				Z[i] = Origin.z + (NextFloat(seed) - 0.5) * 1000.0;
+			}
+		}
+	};
+
+	//DataCount spheres and their bounding boxes scattered around a camera, with its frustum planes
+	struct PrimitiveData
+	{
+		std::vector<float> CenterX, CenterY, CenterZ, Radius;
+		std::vector<float> MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+		Plane Frustum[6];
+
+		PrimitiveData()
+			: CenterX(DataCount), CenterY(DataCount), CenterZ(DataCount), Radius(DataCount),
+			MinX(DataCount), MinY(DataCount), MinZ(DataCount), MaxX(DataCount), MaxY(DataCount), MaxZ(DataCount)
+		{
+			uint32_t seed = 17;
+
+			for (uint32_t i = 0; i < DataCount; i++)
+			{
+				CenterX[i] = NextFloat(seed) * 200.0f - 100.0f;
+				CenterY[i] = NextFloat(seed) * 200.0f - 100.0f;
+				CenterZ[i] = NextFloat(seed) * 200.0f - 100.0f;
+				Radius[i] = NextFloat(seed) * 5.0f;
+
+				MinX[i] = CenterX[i] - Radius[i];
+				MinY[i] = CenterY[i] - Radius[i];
+				MinZ[i] = CenterZ[i] - Radius[i];
+				MaxX[i] = CenterX[i] + Radius[i];
+				MaxY[i] = CenterY[i] + Radius[i];
+				MaxZ[i] = CenterZ[i] + Radius[i];
+			}
+
+			const Matrix4 view = Matrix4::LookAt(Vector3(0.0f, 10.0f, -50.0f), Vector3(0.0f), Vector3(0.0f, 1.0f, 0.0f));
+			ExtractFrustumPlanes(view * Matrix4::Perspective(Math::PiOver4, 16.0f / 9.0f, 0.1f, 500.0f), Frustum);
+		}
+
+		SphereArrays GetSpheres() const { return{ CenterX.data(), CenterY.data(), CenterZ.data(), Radius.data() }; }
+		AABBArrays GetBoxes() const { return{ MinX.data(), MinY.data(), MinZ.data(), MaxX.data(), MaxY.data(), MaxZ.data() }; }
+	};
+
+	//CreateQuaternions split into one array per component for the batch quaternion functions
+	struct QuaternionComponents
+	{
+		std::vector<float> X, Y, Z, W;
+
+		explicit QuaternionComponents(const std::vector<Quaternion>& quaternions)
+		{
+			for (const auto& q : quaternions)
+			{
+				X.push_back(q.x);
+				Y.push_back(q.y);
+				Z.push_back(q.z);
+				W.push_back(q.w);
+			}
+		}
+
+		QuaternionArrays Get()
+		{
+			QuaternionArrays q = { X.data(), Y.data(), Z.data(), W.data() };
+			return q;
+		}
+	};
+
+	/**
+	 *	Runs a body over DataCount quaternions per op, given as arrays of Quaternion and as component arrays.
+	 *	t is a different blend factor per element.
+	 */
+	template <typename TBody>
+	void RunQuaternionArrays(BenchmarkState& state, size_t bytesPerElement, TBody body)
+	{
+		static const std::vector<Quaternion> a = CreateQuaternions(13);
+		static const std::vector<Quaternion> b = CreateQuaternions(14);
+		static QuaternionComponents aComponents(a);
+		static QuaternionComponents bComponents(b);
+		static QuaternionComponents result{ std::vector<Quaternion>(DataCount) };
+		static std::vector<float> t(DataCount);
+
+		for (uint32_t i = 0; i < DataCount; i++)
+			t[i] = static_cast<float>(i) * (1.0f / static_cast<float>(DataCount));
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			body(a, b, aComponents.Get(), bComponents.Get(), t.data(), result.Get());
+			DoNotOptimize(result.X[0]);
+		}
+
+		state.SetBytesPerOp(bytesPerElement * DataCount);
+	}
+
+	//Stores per element results of the scalar functions in the component arrays, like the batch versions
+	void StoreQuaternion(const QuaternionArrays& out, uint32_t i, const Quaternion& q)
+	{
+		out.X[i] = q.x;
+		out.Y[i] = q.y;
+		out.Z[i] = q.z;
+		out.W[i] = q.w;
+	}
+
+	struct QuaternionBatchError
+	{
+		double Max;
+
+		//Excluding pairs whose dot product is within float rounding of Slerp's nlerp threshold, where float and double can take different branches
+		double MaxAwayFromThreshold;
+	};
+
+	/**
+	 *	Largest difference between a component of the batch results and reference(a, b, t), a double precision Quaternion_t.
+	 *	Runs the batch function over several sets of inputs, with t per element and with a few uniform values of t.
+	 *	Every fourth pair is right at Slerp's nlerp threshold and every fourth a small rotation apart.
+	 */
+	template <typename TBatch, typename TReference>
+	QuaternionBatchError MaxQuaternionBatchError(TBatch batch, TReference reference)
+	{
+		const float uniformT[] = { 0.0f, 0.3f, 0.5f, 0.9f, 1.0f };
+		const float thresholdAngle = 2.0f * acosf(0.9995f);
+
+		QuaternionBatchError error = { 0.0, 0.0 };
+
+		for (uint32_t seed = 20; seed < 28; seed += 2)
+		{
+			const std::vector<Quaternion> a = CreateQuaternions(seed);
+			std::vector<Quaternion> b = CreateQuaternions(seed + 1);
+
+			uint32_t angleSeed = seed;
+			for (uint32_t i = 1; i < DataCount; i += 2)
+			{
+				const float angle = (i & 2) ? thresholdAngle * (1.0f + (NextFloat(angleSeed) - 0.5f) * 1.0e-4f) : NextFloat(angleSeed) * 0.1f;
+				b[i] = Quaternion::AxisAngle(Normalize(Vector3(a[i - 1].x, a[i - 1].y, a[i - 1].z) + Vector3(0.0f, 0.0f, 1.0f)), angle) * a[i];
+			}
+
+			QuaternionComponents aComponents(a);
+			QuaternionComponents bComponents(b);
+			QuaternionComponents result{ std::vector<Quaternion>(DataCount) };
+			std::vector<float> t(DataCount);
+
+			for (int uniform = -1; uniform < 5; uniform++)
+			{
+				for (uint32_t i = 0; i < DataCount; i++)
+					t[i] = uniform < 0 ? NextFloat(angleSeed) : uniformT[uniform];
+
+				batch(aComponents.Get(), bComponents.Get(), t.data(), uniform >= 0, result.Get());
+
+				for (uint32_t i = 0; i < DataCount; i++)
+				{
+					const Quaterniond qa(a[i]);
+					const Quaterniond qb(b[i]);
+					const Quaterniond expected = reference(qa, qb, static_cast<double>(t[i]));
+
+					double elementError = fabs(result.X[i] - expected.x);
+					elementError = std::max(elementError, fabs(result.Y[i] - expected.y));
+					elementError = std::max(elementError, fabs(result.Z[i] - expected.z));
+					elementError = std::max(elementError, fabs(result.W[i] - expected.w));
+
+					error.Max = std::max(error.Max, elementError);
+
+					const double dot = fabs(qa.x * qb.x + qa.y * qb.y + qa.z * qb.z + qa.w * qb.w);
+					if (fabs(dot - 0.9995) > 1.0e-6)
+						error.MaxAwayFromThreshold = std::max(error.MaxAwayFromThreshold, elementError);
+				}
+			}
+		}
+
+		return error;
+	}
+
+	//The widest lanes of the build for the fast math benchmarks
+#if NE_MATH_AVX2
+	typedef simd::Float8 FastMathLanes;
+	const uint32_t FastMathLaneCount = 8;
+
+	inline FastMathLanes LoadFastMathLanes(const float* p) { return simd::Load8(p); }
+	inline void StoreFastMathLanes(float* p, FastMathLanes v) { simd::Store8(p, v); }
+#elif NE_MATH_SSE || NE_MATH_NEON
+	typedef simd::Float4 FastMathLanes;
+	const uint32_t FastMathLaneCount = 4;
+
+	inline FastMathLanes LoadFastMathLanes(const float* p) { return simd::Load4(p); }
+	inline void StoreFastMathLanes(float* p, FastMathLanes v) { simd::Store4(p, v); }
+#else
+	typedef float FastMathLanes;
+	const uint32_t FastMathLaneCount = 1;
+
+	inline FastMathLanes LoadFastMathLanes(const float* p) { return *p; }
+	inline void StoreFastMathLanes(float* p, FastMathLanes v) { *p = v; }
+#endif
+
+	//x in [low, high) and y in [-1, 1)
+	void CreateFastMathInputs(float low, float high, std::vector<float>& x, std::vector<float>& y)
+	{
+		uint32_t seed = 15;
+
+		x.resize(DataCount);
+		y.resize(DataCount);
+
+		for (uint32_t i = 0; i < DataCount; i++)
+		{
+			x[i] = low + NextFloat(seed) * (high - low);
+			y[i] = NextFloat(seed) * 2.0f - 1.0f;
+		}
+	}
+
+	//Evaluates function(x, y) over DataCount pairs of inputs per op, one float at a time
+	template <typename TFunction>
+	void RunFastMath(BenchmarkState& state, float low, float high, TFunction function)
+	{
+		static std::vector<float> x, y;
+		static std::vector<float> result(DataCount);
+		CreateFastMathInputs(low, high, x, y);
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			for (uint32_t j = 0; j < DataCount; j++)
+				result[j] = function(x[j], y[j]);
+
+			DoNotOptimize(result[0]);
+		}
+
+		state.SetBytesPerOp(sizeof(float) * 3 * DataCount);
+	}
+
+	//The same inputs passed FastMathLaneCount at a time
+	template <typename TFunction>
+	void RunFastMathLanes(BenchmarkState& state, float low, float high, TFunction function)
+	{
+		static std::vector<float> x, y;
+		static std::vector<float> result(DataCount);
+		CreateFastMathInputs(low, high, x, y);
+
+		for (uint64_t i = 0; i < state.GetIterations(); i++)
+		{
+			for (uint32_t j = 0; j < DataCount; j += FastMathLaneCount)
+				StoreFastMathLanes(&result[j], function(LoadFastMathLanes(&x[j]), LoadFastMathLanes(&y[j])));
+
+			DoNotOptimize(result[0]);
+		}
+
+		state.SetBytesPerOp(sizeof(float) * 3 * DataCount);
+	}
+}
+
+NE_BENCHMARK(Matrix4Multiply)
+{
+	static const std::vector<Matrix4> a = CreateMatrices(1);
+	static const std::vector<Matrix4> b = CreateMatrices(2);
+	static std::vector<Matrix4> result(DataCount);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		const uint32_t index = static_cast<uint32_t>(i) & DataMask;
+		result[index] = a[index] * b[index];
+	}
+
+	DoNotOptimize(result[0]);
+	state.SetBytesPerOp(sizeof(Matrix4) * 3);
+}
+
+NE_BENCHMARK(Matrix4Inverse)
+{
+	static const std::vector<Matrix4> a = CreateMatrices(3);
+	static std::vector<Matrix4> result(DataCount);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		const uint32_t index = static_cast<uint32_t>(i) & DataMask;
+		result[index] = Matrix4::Inverse(a[index]);
+	}
+
+	DoNotOptimize(result[0]);
+	state.SetBytesPerOp(sizeof(Matrix4) * 2);
+}
+
+//Scalar paths of the operations that have SIMD specializations, for comparison
+
+NE_BENCHMARK(Matrix4MultiplyScalar)
+{
+	RunMatrixBinary(state, [](const Matrix4& a, const Matrix4& b) { return detail::Matrix4MultiplyScalar(a, b); });
+}
+
+NE_BENCHMARK(Matrix4InverseScalar)
+{
+	RunMatrixUnary(state, [](const Matrix4& m) { return detail::Matrix4InverseScalar(m); });
+}
+
+//Inverses specialized for the kind of transform, CreateMatrices only builds scales, rotations and translations
+
+NE_BENCHMARK(Matrix4AffineInverse)
+{
+	RunMatrixUnary(state, [](const Matrix4& m) { return Matrix4::AffineInverse(m); });
+}
+
+NE_BENCHMARK(Matrix4RigidInverse)
+{
+	RunMatrixUnary(state, [](const Matrix4& m) { return Matrix4::RigidInverse(m); });
+}
+
+NE_BENCHMARK(Matrix4InverseTranspose)
+{
+	RunMatrixUnary(state, [](const Matrix4& m) { return Matrix4::Transpose(Matrix4::Inverse(m)); });
+}
+
+NE_BENCHMARK(Matrix4InverseTranspose3x3)
+{
+	RunMatrixUnary(state, [](const Matrix4& m) { return Matrix4::InverseTranspose3x3(m); });
+}
+
+NE_BENCHMARK(Matrix3x4Multiply)
+{
+	static const std::vector<Matrix4> a = CreateMatrices(1);
+	static const std::vector<Matrix4> b = CreateMatrices(2);
+	static std::vector<Matrix3x4> a3x4(a.begin(), a.end());
+	static std::vector<Matrix3x4> b3x4(b.begin(), b.end());
+	static std::vector<Matrix3x4> result(DataCount);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		const uint32_t index = static_cast<uint32_t>(i) & DataMask;
+		result[index] = a3x4[index] * b3x4[index];
+	}
+
+	DoNotOptimize(result[0]);
+	state.SetBytesPerOp(sizeof(Matrix3x4) * 3);
+}
+
+NE_BENCHMARK(Matrix3x4Inverse)
+{
+	static const std::vector<Matrix4> a = CreateMatrices(3);
+	static std::vector<Matrix3x4> a3x4(a.begin(), a.end());
+	static std::vector<Matrix3x4> result(DataCount);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		const uint32_t index = static_cast<uint32_t>(i) & DataMask;
+		result[index] = Matrix3x4::Inverse(a3x4[index]);
+	}
+
+	DoNotOptimize(result[0]);
+	state.SetBytesPerOp(sizeof(Matrix3x4) * 2);
+}
+
+NE_BENCHMARK(Matrix4Transpose)
+{
+	RunMatrixUnary(state, [](const Matrix4& m) { return Matrix4::Transpose(m); });
+}
+
+NE_BENCHMARK(Matrix4TransposeScalar)
+{
+	RunMatrixUnary(state, [](const Matrix4& m) { return detail::Matrix4TransposeScalar(m); });
+}
+
+NE_BENCHMARK(Matrix4TransformVector)
+{
+	RunMatrixVector(state, [](const Matrix4& m, const Vector4& v) { return m * v; });
+}
+
+NE_BENCHMARK(Matrix4TransformVectorScalar)
+{
+	RunMatrixVector(state, [](const Matrix4& m, const Vector4& v) { return detail::Matrix4TransformScalar(m, v); });
+}
+
+NE_BENCHMARK(Vector4TransformRow)
+{
+	RunMatrixVector(state, [](const Matrix4& m, const Vector4& v) { return v * m; });
+}
+
+NE_BENCHMARK(Vector4TransformRowScalar)
+{
+	RunMatrixVector(state, [](const Matrix4& m, const Vector4& v) { return detail::Matrix4TransformRowScalar(v, m); });
+}
+
+NE_BENCHMARK(QuaternionSlerp)
+{
+	static const std::vector<Quaternion> a = CreateQuaternions(4);
+	static const std::vector<Quaternion> b = CreateQuaternions(5);
+	static std::vector<Quaternion> result(DataCount);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		const uint32_t index = static_cast<uint32_t>(i) & DataMask;
+		const float t = static_cast<float>(index) * (1.0f / static_cast<float>(DataCount));
+
+		result[index] = Quaternion::Slerp(a[index], b[index], t);
+	}
+
+	DoNotOptimize(result[0]);
+	state.SetBytesPerOp(sizeof(Quaternion) * 3);
+}
+
+NE_BENCHMARK(QuaternionToMatrix)
+{
+	static const std::vector<Quaternion> a = CreateQuaternions(6);
+	static std::vector<Matrix4> result(DataCount);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		const uint32_t index = static_cast<uint32_t>(i) & DataMask;
+		result[index] = Quaternion::ToMatrix(a[index]);
+	}
+
+	DoNotOptimize(result[0]);
+	state.SetBytesPerOp(sizeof(Quaternion) + sizeof(Matrix4));
+}
+
+//Batch transforms of 1024 vectors per op, compared against transforming one vertex at a time
+
+NE_BENCHMARK(TransformPointsPerVertex)
+{
+	RunBatchTransformPacked(state, BatchTransformKernel::Scalar, [](const Matrix4& m, const Vector3* in, Vector3* out)
+	{
+		for (uint32_t i = 0; i < DataCount; i++)
+		{
+			const Vector4 p = Vector4(in[i], 1.0f) * m;
+			out[i] = Vector3(p.x, p.y, p.z);
+		}
+	});
+}
+
+NE_BENCHMARK(BatchTransformPointsScalar)
+{
+	RunBatchTransformPacked(state, BatchTransformKernel::Scalar, &TransformPackedPoints);
+}
+
+NE_BENCHMARK(BatchTransformPointsAVX2)
+{
+	RunBatchTransformPacked(state, BatchTransformKernel::AVX2, &TransformPackedPoints);
+}
+
+NE_BENCHMARK(BatchTransformPointsAVX512)
+{
+	RunBatchTransformPacked(state, BatchTransformKernel::AVX512, &TransformPackedPoints);
+}
+
+NE_BENCHMARK(BatchTransformAlignedPointsScalar)
+{
+	RunBatchTransformAligned(state, BatchTransformKernel::Scalar, &TransformAlignedPoints);
+}
+
+NE_BENCHMARK(BatchTransformAlignedPointsAVX2)
+{
+	RunBatchTransformAligned(state, BatchTransformKernel::AVX2, &TransformAlignedPoints);
+}
+
+NE_BENCHMARK(BatchTransformAlignedNormalsScalar)
+{
+	RunBatchTransformAligned(state, BatchTransformKernel::Scalar, &TransformAlignedNormals);
+}
+
+NE_BENCHMARK(BatchTransformAlignedNormalsAVX2)
+{
+	RunBatchTransformAligned(state, BatchTransformKernel::AVX2, &TransformAlignedNormals);
+}
+
+NE_BENCHMARK(BatchTransformVertexPositionsScalar)
+{
+	RunBatchTransform(state, BatchTransformKernel::Scalar, &TransformVertexPositions);
+}
+
+NE_BENCHMARK(BatchTransformVertexPositionsAVX2)
+{
+	RunBatchTransform(state, BatchTransformKernel::AVX2, &TransformVertexPositions);
+}
+
+NE_BENCHMARK(BatchTransformVertexPositionsAVX512)
+{
+	RunBatchTransform(state, BatchTransformKernel::AVX512, &TransformVertexPositions);
+}
+
+NE_BENCHMARK(BatchTransformVertexNormalsScalar)
+{
+	RunBatchTransform(state, BatchTransformKernel::Scalar, &TransformVertexNormals);
+}
+
+NE_BENCHMARK(BatchTransformVertexNormalsAVX2)
+{
+	RunBatchTransform(state, BatchTransformKernel::AVX2, &TransformVertexNormals);
+}
+
+NE_BENCHMARK(BatchTransformVertexNormalsAVX512)
+{
+	RunBatchTransform(state, BatchTransformKernel::AVX512, &TransformVertexNormals);
+}
+
+//Quaternion functions over 1024 elements per op, one call per element compared against the batch functions
+
+NE_BENCHMARK(QuaternionSlerpPerElement)
+{
+	RunQuaternionArrays(state, sizeof(Quaternion) * 3 + sizeof(float), [](const std::vector<Quaternion>& a, const std::vector<Quaternion>& b,
+		const QuaternionArrays&, const QuaternionArrays&, const float* t, const QuaternionArrays& out)
+	{
+		for (uint32_t i = 0; i < DataCount; i++)
+			StoreQuaternion(out, i, Quaternion::Slerp(a[i], b[i], t[i]));
+	});
+}
+
+NE_BENCHMARK(QuaternionSlerpBatch)
+{
+	RunQuaternionArrays(state, sizeof(Quaternion) * 3 + sizeof(float), [](const std::vector<Quaternion>&, const std::vector<Quaternion>&,
+		const QuaternionArrays& a, const QuaternionArrays& b, const float* t, const QuaternionArrays& out)
+	{
+		SlerpQuaternions(a, b, t, out, DataCount);
+	});
+}
+
+NE_BENCHMARK(QuaternionNlerpPerElement)
+{
+	RunQuaternionArrays(state, sizeof(Quaternion) * 3 + sizeof(float), [](const std::vector<Quaternion>& a, const std::vector<Quaternion>& b,
+		const QuaternionArrays&, const QuaternionArrays&, const float* t, const QuaternionArrays& out)
+	{
+		for (uint32_t i = 0; i < DataCount; i++)
+			StoreQuaternion(out, i, Quaternion::Nlerp(a[i], b[i], t[i]));
+	});
+}
+
+NE_BENCHMARK(QuaternionNlerpBatch)
+{
+	RunQuaternionArrays(state, sizeof(Quaternion) * 3 + sizeof(float), [](const std::vector<Quaternion>&, const std::vector<Quaternion>&,
+		const QuaternionArrays& a, const QuaternionArrays& b, const float* t, const QuaternionArrays& out)
+	{
+		NlerpQuaternions(a, b, t, out, DataCount);
+	});
+}
+
+NE_BENCHMARK(QuaternionMultiplyPerElement)
+{
+	RunQuaternionArrays(state, sizeof(Quaternion) * 3, [](const std::vector<Quaternion>& a, const std::vector<Quaternion>& b,
+		const QuaternionArrays&, const QuaternionArrays&, const float*, const QuaternionArrays& out)
+	{
+		for (uint32_t i = 0; i < DataCount; i++)
+			StoreQuaternion(out, i, a[i] * b[i]);
+	});
+}
+
+NE_BENCHMARK(QuaternionMultiplyBatch)
+{
+	RunQuaternionArrays(state, sizeof(Quaternion) * 3, [](const std::vector<Quaternion>&, const std::vector<Quaternion>&,
+		const QuaternionArrays& a, const QuaternionArrays& b, const float*, const QuaternionArrays& out)
+	{
+		MultiplyQuaternions(a, b, out, DataCount);
+	});
+}
+
+NE_BENCHMARK(QuaternionToMatrixPerElement)
+{
+	static std::vector<Matrix3x4> matrices(DataCount);
+
+	RunQuaternionArrays(state, sizeof(Quaternion) + sizeof(Matrix3x4), [](const std::vector<Quaternion>& a, const std::vector<Quaternion>&,
+		const QuaternionArrays&, const QuaternionArrays&, const float*, const QuaternionArrays&)
+	{
+		for (uint32_t i = 0; i < DataCount; i++)
+			matrices[i] = Matrix3x4(Quaternion::ToMatrix(a[i]));
+
+		DoNotOptimize(matrices[0]);
+	});
+}
+
+NE_BENCHMARK(QuaternionToMatrixBatch)
+{
+	static std::vector<Matrix3x4> matrices(DataCount);
+
+	RunQuaternionArrays(state, sizeof(Quaternion) + sizeof(Matrix3x4), [](const std::vector<Quaternion>&, const std::vector<Quaternion>&,
+		const QuaternionArrays& a, const QuaternionArrays&, const float*, const QuaternionArrays&)
+	{
+		QuaternionsToMatrices(a, matrices.data(), DataCount);
+		DoNotOptimize(matrices[0]);
+	});
+}
+
+//<cmath> against the fast math approximations over 1024 inputs per op, one float at a time and in the widest SIMD lanes of the build
+
+NE_BENCHMARK(RsqrtStd)
+{
+	RunFastMath(state, 0.001f, 1000.0f, [](float x, float) { return 1.0f / std::sqrt(x); });
+}
+
+NE_BENCHMARK(RsqrtFast)
+{
+	RunFastMath(state, 0.001f, 1000.0f, [](float x, float) { return fastmath::Rsqrt(x); });
+}
+
+NE_BENCHMARK(RsqrtFastLanes)
+{
+	RunFastMathLanes(state, 0.001f, 1000.0f, [](FastMathLanes x, FastMathLanes) { return fastmath::Rsqrt(x); });
+}
+
+NE_BENCHMARK(SinStd)
+{
+	RunFastMath(state, -100.0f, 100.0f, [](float x, float) { return std::sin(x); });
+}
+
+NE_BENCHMARK(SinFast)
+{
+	RunFastMath(state, -100.0f, 100.0f, [](float x, float) { return fastmath::Sin(x); });
+}
+
+NE_BENCHMARK(SinFastLanesLow)
+{
+	RunFastMathLanes(state, -100.0f, 100.0f, [](FastMathLanes x, FastMathLanes) { return fastmath::Sin<FastMathPrecision::Low>(x); });
+}
+
+NE_BENCHMARK(SinFastLanes)
+{
+	RunFastMathLanes(state, -100.0f, 100.0f, [](FastMathLanes x, FastMathLanes) { return fastmath::Sin(x); });
+}
+
+NE_BENCHMARK(SinFastLanesHigh)
+{
+	RunFastMathLanes(state, -100.0f, 100.0f, [](FastMathLanes x, FastMathLanes) { return fastmath::Sin<FastMathPrecision::High>(x); });
+}
+
+NE_BENCHMARK(Atan2Std)
+{
+	RunFastMath(state, -1.0f, 1.0f, [](float x, float y) { return std::atan2(y, x); });
+}
+
+NE_BENCHMARK(Atan2Fast)
+{
+	RunFastMath(state, -1.0f, 1.0f, [](float x, float y) { return fastmath::Atan2(y, x); });
+}
+
+NE_BENCHMARK(Atan2FastLanes)
+{
+	RunFastMathLanes(state, -1.0f, 1.0f, [](FastMathLanes x, FastMathLanes y) { return fastmath::Atan2(y, x); });
+}
+
+NE_BENCHMARK(AcosStd)
+{
+	RunFastMath(state, -1.0f, 1.0f, [](float x, float) { return std::acos(x); });
+}
+
+NE_BENCHMARK(AcosFast)
+{
+	RunFastMath(state, -1.0f, 1.0f, [](float x, float) { return fastmath::Acos(x); });
+}
+
+NE_BENCHMARK(AcosFastLanes)
+{
+	RunFastMathLanes(state, -1.0f, 1.0f, [](FastMathLanes x, FastMathLanes) { return fastmath::Acos(x); });
+}
+
+NE_BENCHMARK(Exp2Std)
+{
+	RunFastMath(state, -20.0f, 20.0f, [](float x, float) { return std::exp2(x); });
+}
+
+NE_BENCHMARK(Exp2Fast)
+{
+	RunFastMath(state, -20.0f, 20.0f, [](float x, float) { return fastmath::Exp2(x); });
+}
+
+NE_BENCHMARK(Exp2FastLanes)
+{
+	RunFastMathLanes(state, -20.0f, 20.0f, [](FastMathLanes x, FastMathLanes) { return fastmath::Exp2(x); });
+}
+
+NE_BENCHMARK(Log2Std)
+{
+	RunFastMath(state, 0.001f, 1000.0f, [](float x, float) { return std::log2(x); });
+}
+
+NE_BENCHMARK(Log2Fast)
+{
+	RunFastMath(state, 0.001f, 1000.0f, [](float x, float) { return fastmath::Log2(x); });
+}
+
+NE_BENCHMARK(Log2FastLanes)
+{
+	RunFastMathLanes(state, 0.001f, 1000.0f, [](FastMathLanes x, FastMathLanes) { return fastmath::Log2(x); });
+}
+
+//1024 random floats in [0, 1) per op, from rand() and from the generators in Random.h
+
+NE_BENCHMARK(RandomStdRand)
+{
+	RunRandomFloats(state, [](float* out)
+	{
+		for (uint32_t i = 0; i < DataCount; i++)
+			out[i] = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+	});
+}
+
+NE_BENCHMARK(RandomMathRandF)
+{
+	RunRandomFloats(state, [](float* out)
+	{
+		for (uint32_t i = 0; i < DataCount; i++)
+			out[i] = Math::RandF();
+	});
+}
+
+NE_BENCHMARK(RandomXoshiro256)
+{
+	static Xoshiro256 random(1);
+
+	RunRandomFloats(state, [](float* out)
+	{
+		for (uint32_t i = 0; i < DataCount; i++)
+			out[i] = random.NextFloat();
+	});
+}
+
+NE_BENCHMARK(RandomPcg32)
+{
+	static Pcg32 random(1);
+
+	RunRandomFloats(state, [](float* out)
+	{
+		for (uint32_t i = 0; i < DataCount; i++)
+			out[i] = random.NextFloat();
+	});
+}
+
+NE_BENCHMARK(RandomXoshiro256x4Fill)
+{
+	static Xoshiro256x4 random(1);
+
+	RunRandomFloats(state, [](float* out)
+	{
+		random.FillFloats(out, DataCount);
+	});
+}
+
+NE_BENCHMARK(FloatToHalfScalar)
+{
+	RunPacking(state, sizeof(float), [](HalfData& data)
+	{
+		for (uint32_t i = 0; i < DataCount; i++)
+			data.Halves[i] = FloatToHalf(data.Floats[i]);
+	});
+}
+
+NE_BENCHMARK(FloatToHalfBulk)
+{
+	RunPacking(state, sizeof(float), [](HalfData& data)
+	{
+		FloatsToHalves(data.Floats.data(), data.Halves.data(), DataCount);
+	});
+}
+
+NE_BENCHMARK(HalfToFloatScalar)
+{
+	RunPacking(state, sizeof(uint16_t), [](HalfData& data)
+	{
+		for (uint32_t i = 0; i < DataCount; i++)
+			data.Floats[i] = HalfToFloat(data.Halves[i]);
+	});
+}
+
+NE_BENCHMARK(HalfToFloatBulk)
+{
+	RunPacking(state, sizeof(uint16_t), [](HalfData& data)
+	{
+		HalvesToFloats(data.Halves.data(), data.Floats.data(), DataCount);
+	});
+}
+
+NE_BENCHMARK(OctahedralPackScalar)
+{
+	static const std::vector<BenchmarkVertex> vertices = CreateVertices(12);
+	static std::vector<uint32_t> packed(DataCount);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		for (uint32_t j = 0; j < DataCount; j++)
+			packed[j] = PackOctahedralSnorm16(vertices[j].Normal);
+
+		DoNotOptimize(packed[0]);
+	}
+
+	state.SetBytesPerOp(sizeof(Vector3) * DataCount);
+}
+
+NE_BENCHMARK(OctahedralPackBulk)
+{
+	static const std::vector<BenchmarkVertex> vertices = CreateVertices(12);
+	static std::vector<uint32_t> packed(DataCount);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		PackOctahedralNormals(&vertices[0].Normal, sizeof(BenchmarkVertex), packed.data(), sizeof(uint32_t), DataCount);
+		DoNotOptimize(packed[0]);
+	}
+
+	state.SetBytesPerOp(sizeof(Vector3) * DataCount);
+}
+
+NE_BENCHMARK(RebasePositionsScalar)
+{
+	static WorldPositionData data;
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		for (uint32_t j = 0; j < DataCount; j++)
+		{
+			data.RelativeX[j] = static_cast<float>(data.X[j] - data.Origin.x);
+			data.RelativeY[j] = static_cast<float>(data.Y[j] - data.Origin.y);
+			data.RelativeZ[j] = static_cast<float>(data.Z[j] - data.Origin.z);
+		}
+
+		DoNotOptimize(data.RelativeX[0]);
+	}
+
+	state.SetBytesPerOp(sizeof(double) * 3 * DataCount);
+}
+
+NE_BENCHMARK(RebasePositionsBulk)
+{
+	static WorldPositionData data;
+
+	const WorldPositionArrays positions = { data.X.data(), data.Y.data(), data.Z.data() };
+	const RelativePositionArrays relative = { data.RelativeX.data(), data.RelativeY.data(), data.RelativeZ.data() };
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		RebasePositions(positions, data.Origin, relative, DataCount);
+		DoNotOptimize(data.RelativeX[0]);
+	}
+
+	state.SetBytesPerOp(sizeof(double) * 3 * DataCount);
+}
+
+NE_BENCHMARK(CullSpheresScalar)
+{
+	static const PrimitiveData data;
+	static std::vector<uint8_t> visible(DataCount);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		for (uint32_t j = 0; j < DataCount; j++)
+		{
+			const Sphere sphere(Vector3(data.CenterX[j], data.CenterY[j], data.CenterZ[j]), data.Radius[j]);
+			bool bCulled = false;
+
+			for (const Plane& plane : data.Frustum)
+				bCulled |= Classify(plane, sphere) == PlaneSide::Back;
+
+			visible[j] = bCulled ? 0 : 1;
+		}
+
+		DoNotOptimize(visible[0]);
+	}
+
+	state.SetBytesPerOp(sizeof(float) * 4 * DataCount);
+}
+
+NE_BENCHMARK(CullSpheresBatch)
+{
+	static const PrimitiveData data;
+	static std::vector<uint8_t> visible(DataCount);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		CullSpheres(data.Frustum, 6, data.GetSpheres(), visible.data(), DataCount);
+		DoNotOptimize(visible[0]);
+	}
+
+	state.SetBytesPerOp(sizeof(float) * 4 * DataCount);
+}
+
+NE_BENCHMARK(CullAABBsBatch)
+{
+	static const PrimitiveData data;
+	static std::vector<uint8_t> visible(DataCount);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		CullAABBs(data.Frustum, 6, data.GetBoxes(), visible.data(), DataCount);
+		DoNotOptimize(visible[0]);
+	}
+
+	state.SetBytesPerOp(sizeof(float) * 6 * DataCount);
+}
+
+NE_BENCHMARK(RayAABBScalar)
+{
+	static const PrimitiveData data;
+	static std::vector<float> distances(DataCount);
+	const Ray ray(Vector3(0.0f, 10.0f, -50.0f), Normalize(Vector3(0.1f, -0.05f, 1.0f)));
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		for (uint32_t j = 0; j < DataCount; j++)
+		{
+			const AABB box(Vector3(data.MinX[j], data.MinY[j], data.MinZ[j]), Vector3(data.MaxX[j], data.MaxY[j], data.MaxZ[j]));
+			float distance;
+			distances[j] = Intersects(ray, box, distance) ? distance : Math::Infinity;
+		}
+
+		DoNotOptimize(distances[0]);
+	}
+
+	state.SetBytesPerOp(sizeof(float) * 6 * DataCount);
+}
+
+NE_BENCHMARK(RayAABBBatch)
+{
+	static const PrimitiveData data;
+	static std::vector<float> distances(DataCount);
+	const Ray ray(Vector3(0.0f, 10.0f, -50.0f), Normalize(Vector3(0.1f, -0.05f, 1.0f)));
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		IntersectRayAABBs(ray, Math::Infinity, data.GetBoxes(), distances.data(), DataCount);
+		DoNotOptimize(distances[0]);
+	}
+
+	state.SetBytesPerOp(sizeof(float) * 6 * DataCount);
+}
+
+//The error bounds documented in QuaternionBatch.h, against the functions evaluated in double precision
+
+NE_VERIFY(MultiplyQuaternionsBound)
+{
+	const double maxError = MaxQuaternionBatchError(
+		[](const QuaternionArrays& a, const QuaternionArrays& b, const float*, bool, const QuaternionArrays& out) { MultiplyQuaternions(a, b, out, DataCount); },
+		[](const Quaterniond& a, const Quaterniond& b, double) { return a * b; }).Max;
+
+	return VerifyNear("MultiplyQuaternions max error", maxError, 0.0, 2.0e-7);
+}
+
+NE_VERIFY(NlerpQuaternionsBound)
+{
+	const double maxError = MaxQuaternionBatchError(
+		[](const QuaternionArrays& a, const QuaternionArrays& b, const float* t, bool bUniform, const QuaternionArrays& out)
+		{
+			if (bUniform)
+				NlerpQuaternions(a, b, t[0], out, DataCount);
+			else
+				NlerpQuaternions(a, b, t, out, DataCount);
+		},
+		[](const Quaterniond& a, const Quaterniond& b, double t) { return Quaterniond::Nlerp(a, b, t); }).Max;
+
+	return VerifyNear("NlerpQuaternions max error", maxError, 0.0, 2.0e-7);
+}
+
+NE_VERIFY(SlerpQuaternionsBound)
+{
+	const QuaternionBatchError error = MaxQuaternionBatchError(
+		[](const QuaternionArrays& a, const QuaternionArrays& b, const float* t, bool bUniform, const QuaternionArrays& out)
+		{
+			if (bUniform)
+				SlerpQuaternions(a, b, t[0], out, DataCount);
+			else
+				SlerpQuaternions(a, b, t, out, DataCount);
+		},
+		[](const Quaterniond& a, const Quaterniond& b, double t) { return Quaterniond::Slerp(a, b, t); });
+
+	const bool bPassed = VerifyNear("SlerpQuaternions max error", error.Max, 0.0, 6.0e-7);
+	return VerifyNear("SlerpQuaternions max error away from the nlerp threshold", error.MaxAwayFromThreshold, 0.0, 3.0e-7) && bPassed;
+}
+
+NE_VERIFY(QuaternionsToMatricesBound)
+{
+	const std::vector<Quaternion> q = CreateQuaternions(20);
+	QuaternionComponents components(q);
+	std::vector<Matrix3x4> matrices(DataCount);
+
+	QuaternionsToMatrices(components.Get(), matrices.data(), DataCount);
+
+	double maxError = 0.0;
+
+	for (uint32_t i = 0; i < DataCount; i++)
+	{
+		const Matrix3x4_t<double> expected(Quaterniond::ToMatrix(Quaterniond(q[i])));
+
+		for (int row = 0; row < 3; row++)
+		{
+			for (int column = 0; column < 4; column++)
+				maxError = std::max(maxError, fabs(matrices[i][row][column] - expected[row][column]));
+		}
+	}
+
+	return VerifyNear("QuaternionsToMatrices max error", maxError, 0.0, 2.0e-7);
+}
+
+namespace
+{
+	//Compares IntersectRayAABBs with the scalar slab test for every box, they are expected to give bit identical distances
+	bool VerifyRayAABBs(const char* what, const Ray& ray, float maxDistance, const AABBArrays& boxes, size_t count)
+	{
+		std::vector<float> distances(count);
+		IntersectRayAABBs(ray, maxDistance, boxes, distances.data(), count);
+
+		const Vector3 inverseDirection = detail::Reciprocal(ray.Direction);
+		bool bPassed = true;
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const AABB box(Vector3(boxes.MinX[i], boxes.MinY[i], boxes.MinZ[i]), Vector3(boxes.MaxX[i], boxes.MaxY[i], boxes.MaxZ[i]));
+
+			float distance;
+			if (!detail::IntersectSlabs(ray.Origin, inverseDirection, box, 0.0f, maxDistance, distance))
+				distance = Math::Infinity;
+
+			if (distances[i] != distance)
+			{
+				printf("  %s, box %zu: %.9g, scalar %.9g\n", what, i, distances[i], distance);
+				bPassed = false;
+			}
+		}
+
+		return bPassed;
+	}
+}
+
+NE_VERIFY(RayAABBBatchMatchesScalar)
+{
+	const PrimitiveData data;
+
+	bool bPassed = VerifyRayAABBs("Scattered boxes", Ray(Vector3(0.0f, 10.0f, -50.0f), Normalize(Vector3(0.1f, -0.05f, 1.0f))), Math::Infinity, data.GetBoxes(), DataCount);
+	bPassed &= VerifyRayAABBs("Scattered boxes, axis aligned ray", Ray(Vector3(0.0f, 10.0f, -50.0f), Vector3(0.0f, 0.0f, 1.0f)), 100.0f, data.GetBoxes(), DataCount);
+
+	//Rays along z from x = 1 and y = 0.5 run along the Min or Max faces of some of these boxes, inside or outside the others.
+	//Enough boxes that every case lands in the 8 and 4 wide paths and the scalar tail.
+	const float rangesX[][2] = { { 1.0f, 2.0f }, { 0.0f, 1.0f }, { -1.0f, 3.0f }, { 2.0f, 3.0f } };
+	const float rangesY[][2] = { { 0.5f, 1.5f }, { -0.5f, 0.5f }, { 0.0f, 1.0f } };
+	const float rangesZ[][2] = { { 0.0f, 1.0f }, { 2.0f, 3.0f }, { -3.0f, -2.0f } };
+
+	std::vector<float> minX, minY, minZ, maxX, maxY, maxZ;
+
+	for (uint32_t repeat = 0; repeat < 3; repeat++)
+	{
+		for (const auto& x : rangesX)
+		{
+			for (const auto& y : rangesY)
+			{
+				for (const auto& z : rangesZ)
+				{
+					minX.push_back(x[0]); maxX.push_back(x[1]);
+					minY.push_back(y[0]); maxY.push_back(y[1]);
+					minZ.push_back(z[0]); maxZ.push_back(z[1]);
+				}
+			}
+		}
+
+		//Shifts the cases to other lanes on the next repeat
+		minX.push_back(10.0f); maxX.push_back(11.0f);
+		minY.push_back(10.0f); maxY.push_back(11.0f);
+		minZ.push_back(10.0f); maxZ.push_back(11.0f);
+	}
+
+	const AABBArrays grazing = { minX.data(), minY.data(), minZ.data(), maxX.data(), maxY.data(), maxZ.data() };
+
+	const Ray grazingRays[] =
+	{
+		Ray(Vector3(1.0f, 0.5f, -1.0f), Vector3(0.0f, 0.0f, 1.0f)),
+		Ray(Vector3(1.0f, 0.5f, -1.0f), Vector3(-0.0f, -0.0f, 1.0f)),
+		Ray(Vector3(1.0f, 0.5f, -1.0f), Vector3(0.0f, -0.0f, 1.0f)),
+		Ray(Vector3(1.0f, 0.5f, 4.0f), Vector3(-0.0f, 0.0f, -1.0f)),
+	};
+
+	for (const Ray& ray : grazingRays)
+	{
+		bPassed &= VerifyRayAABBs("Grazing rays", ray, Math::Infinity, grazing, minX.size());
+		bPassed &= VerifyRayAABBs("Grazing rays, max distance 2.5", ray, 2.5f, grazing, minX.size());
+	}
+
+	//The behaviour documented for detail::IntersectSlabs, hits along the Max face and misses along the Min face
+	const AABB unitBox(Vector3(0.0f), Vector3(1.0f));
+	float distance = 0.0f;
+
+	if (Intersects(Ray(Vector3(0.0f, 0.5f, -1.0f), Vector3(0.0f, 0.0f, 1.0f)), unitBox, distance))
+	{
+		printf("  Ray along the Min face of the box hits\n");
+		bPassed = false;
+	}
+
+	if (!Intersects(Ray(Vector3(1.0f, 0.5f, -1.0f), Vector3(-0.0f, 0.0f, 1.0f)), unitBox, distance) || distance != 1.0f)
+	{
+		printf("  Ray along the Max face of the box misses\n");
+		bPassed = false;
+	}
+
+	return bPassed;
+}
+
+namespace
+{
+	//Largest difference relative to the largest element of the scalar result, so errors in the rotation aren't measured against translations of 100
+	template <int Rows, int Columns, typename TMatrix>
+	double RelativeDifference(const TMatrix& simdResult, const TMatrix& scalarResult)
+	{
+		double difference = 0.0;
+		double scale = 1.0;
+
+		for (int row = 0; row < Rows; row++)
+		{
+			for (int column = 0; column < Columns; column++)
+			{
+				difference = std::max(difference, static_cast<double>(fabs(simdResult[row][column] - scalarResult[row][column])));
+				scale = std::max(scale, static_cast<double>(fabs(scalarResult[row][column])));
+			}
+		}
+
+		return difference / scale;
+	}
+
+	template <int Rows, int Columns, typename TSimd, typename TScalar>
+	double MaxRelativeDifference(const std::vector<Matrix4>& inputs, TSimd simdOp, TScalar scalarOp)
+	{
+		double maxDifference = 0.0;
+
+		for (const Matrix4& m : inputs)
+			maxDifference = std::max(maxDifference, RelativeDifference<Rows, Columns>(simdOp(m), scalarOp(m)));
+
+		return maxDifference;
+	}
+}
+
+//The tolerances documented in Matrix4SIMD.h. Without NE_MATH_SSE or NE_MATH_NEON both sides are the scalar versions.
+NE_VERIFY(Matrix4SIMDMatchesScalar)
+{
+	const std::vector<Matrix4> affine = CreateMatrices(30);
+	const std::vector<Matrix4> other = CreateMatrices(31);
+	const std::vector<Vector4> vectors = CreateVectors(32);
+
+	std::vector<Matrix4> rigid(DataCount);
+	std::vector<Matrix4> projective(DataCount);
+	uint32_t seed = 33;
+
+	for (uint32_t i = 0; i < DataCount; i++)
+	{
+		rigid[i] = Matrix4::RotateY(NextFloat(seed) * Math::TwoPi) *
+			Matrix4::RotateX(NextFloat(seed) * Math::TwoPi) *
+			Matrix4::Translate(NextFloat(seed) * 100.0f, NextFloat(seed) * 100.0f, NextFloat(seed) * 100.0f);
+
+		projective[i] = affine[i] * Matrix4::Perspective(0.5f + NextFloat(seed), 1.0f + NextFloat(seed), 0.1f + NextFloat(seed), 1000.0f);
+	}
+
+	double multiplyDifference = 0.0;
+	double transformDifference = 0.0;
+
+	for (uint32_t i = 0; i < DataCount; i++)
+	{
+		multiplyDifference = std::max(multiplyDifference, RelativeDifference<4, 4>(affine[i] * other[i], detail::Matrix4MultiplyScalar(affine[i], other[i])));
+
+		const Vector4 column = affine[i] * vectors[i];
+		const Vector4 row = vectors[i] * affine[i];
+		const Vector4 scalarColumn = detail::Matrix4TransformScalar(affine[i], vectors[i]);
+		const Vector4 scalarRow = detail::Matrix4TransformRowScalar(vectors[i], affine[i]);
+
+		transformDifference = std::max(transformDifference, RelativeDifference<1, 4>(&column, &scalarColumn));
+		multiplyDifference = std::max(multiplyDifference, RelativeDifference<1, 4>(&row, &scalarRow));
+	}
+
+	bool bPassed = VerifyNear("Matrix4 * Matrix4 and Vector4 * Matrix4", multiplyDifference, 0.0, 1.0e-6);
+	bPassed &= VerifyNear("Matrix4 * Vector4", transformDifference, 0.0, 1.0e-5);
+
+	bPassed &= VerifyNear("Inverse of affine matrices", MaxRelativeDifference<4, 4>(affine,
+		[](const Matrix4& m) { return Matrix4::Inverse(m); }, [](const Matrix4& m) { return detail::Matrix4InverseScalar(m); }), 0.0, 2.0e-6);
+	bPassed &= VerifyNear("Inverse of projections", MaxRelativeDifference<4, 4>(projective,
+		[](const Matrix4& m) { return Matrix4::Inverse(m); }, [](const Matrix4& m) { return detail::Matrix4InverseScalar(m); }), 0.0, 5.0e-4);
+	bPassed &= VerifyNear("AffineInverse", MaxRelativeDifference<4, 4>(affine,
+		[](const Matrix4& m) { return Matrix4::AffineInverse(m); }, [](const Matrix4& m) { return detail::Matrix4AffineInverseScalar(m); }), 0.0, 2.0e-6);
+	bPassed &= VerifyNear("RigidInverse", MaxRelativeDifference<4, 4>(rigid,
+		[](const Matrix4& m) { return Matrix4::RigidInverse(m); }, [](const Matrix4& m) { return detail::Matrix4RigidInverseScalar(m); }), 0.0, 1.0e-6);
+	bPassed &= VerifyNear("InverseTranspose3x3", MaxRelativeDifference<3, 3>(affine,
+		[](const Matrix4& m) { return Matrix4::InverseTranspose3x3(m); }, [](const Matrix4& m) { return detail::Matrix4InverseTranspose3x3Scalar(m); }), 0.0, 1.0e-6);
+
+	return bPassed;
+}
+
+namespace
+{
+	typedef void(*StridedTransform)(const Matrix4& m, const Vector3* in, size_t inStride, Vector3* out, size_t outStride, size_t count);
+	typedef void(*AlignedTransform)(const Matrix4& m, const Vector3A* in, Vector3A* out, size_t count);
+
+	//Largest component difference relative to the largest component of the scalar kernel's vector
+	template <typename TVector>
+	double MaxVectorDifference(const TVector* result, const TVector* expected, size_t count)
+	{
+		double maxDifference = 0.0;
+
+		for (size_t i = 0; i < count; i++)
+		{
+			double difference = 0.0;
+			double scale = 1.0;
+
+			const float resultComponents[] = { result[i].x, result[i].y, result[i].z };
+			const float expectedComponents[] = { expected[i].x, expected[i].y, expected[i].z };
+
+			for (int component = 0; component < 3; component++)
+			{
+				difference = std::max(difference, static_cast<double>(fabs(resultComponents[component] - expectedComponents[component])));
+				scale = std::max(scale, static_cast<double>(fabs(expectedComponents[component])));
+			}
+
+			maxDifference = std::max(maxDifference, difference / scale);
+		}
+
+		return maxDifference;
+	}
+
+	/**
+	 *	Runs the transform with the scalar kernel and then with kernel on the same inputs: interleaved vertices to a packed array,
+	 *	a packed array in place and Vector3A arrays, for counts that end in every tail length of the 8 and 16 wide kernels.
+	 */
+	double MaxBatchTransformDifference(BatchTransformKernel kernel, const Matrix4& m, bool bNormals, StridedTransform strided, AlignedTransform aligned)
+	{
+		const std::vector<BenchmarkVertex> vertices = CreateVertices(40);
+		const size_t counts[] = { 1, 7, 8, 9, 15, 16, 17, 31, 33, DataCount - 1 };
+
+		double maxDifference = 0.0;
+
+		for (size_t count : counts)
+		{
+			std::vector<Vector3> packed(count);
+			std::vector<Vector3A> alignedInput(count);
+
+			for (size_t i = 0; i < count; i++)
+			{
+				packed[i] = bNormals ? vertices[i].Normal : vertices[i].Position;
+				alignedInput[i] = Vector3A(packed[i].x, packed[i].y, packed[i].z);
+			}
+
+			const Vector3* interleaved = bNormals ? &vertices[0].Normal : &vertices[0].Position;
+
+			std::vector<Vector3> expected(count), result(count);
+			std::vector<Vector3> expectedInPlace(packed), resultInPlace(packed);
+			std::vector<Vector3A> expectedAligned(count), resultAligned(count);
+
+			SetBatchTransformKernel(BatchTransformKernel::Scalar);
+			strided(m, interleaved, sizeof(BenchmarkVertex), expected.data(), sizeof(Vector3), count);
+			strided(m, expectedInPlace.data(), sizeof(Vector3), expectedInPlace.data(), sizeof(Vector3), count);
+			aligned(m, alignedInput.data(), expectedAligned.data(), count);
+
+			SetBatchTransformKernel(kernel);
+			strided(m, interleaved, sizeof(BenchmarkVertex), result.data(), sizeof(Vector3), count);
+			strided(m, resultInPlace.data(), sizeof(Vector3), resultInPlace.data(), sizeof(Vector3), count);
+			aligned(m, alignedInput.data(), resultAligned.data(), count);
+
+			maxDifference = std::max(maxDifference, MaxVectorDifference(result.data(), expected.data(), count));
+			maxDifference = std::max(maxDifference, MaxVectorDifference(resultInPlace.data(), expectedInPlace.data(), count));
+			maxDifference = std::max(maxDifference, MaxVectorDifference(resultAligned.data(), expectedAligned.data(), count));
+		}
+
+		ResetBatchTransformKernel();
+
+		return maxDifference;
+	}
+}
+
+//The SIMD kernels fuse multiplies and adds, the tolerance is relative to the largest component of each vector.
+//Kernels the CPU doesn't support are skipped.
+NE_VERIFY(BatchTransformKernelsMatchScalar)
+{
+	const BatchTransformKernel kernels[] = { BatchTransformKernel::AVX2, BatchTransformKernel::AVX512 };
+	const char* kernelNames[] = { "AVX2", "AVX-512" };
+
+	//Non-uniform scale so normals need the inverse transpose, and a mirroring transform that flips them
+	const Matrix4 matrices[] =
+	{
+		Matrix4::Scale(Vector3(0.5f, 2.0f, 1.3f)) * CreateMatrices(41)[0],
+		Matrix4::Scale(Vector3(-1.0f, 0.7f, 1.0f)) * CreateMatrices(42)[0]
+	};
+
+	bool bPassed = true;
+	char what[64];
+
+	for (int kernel = 0; kernel < 2; kernel++)
+	{
+		if (!IsBatchTransformKernelSupported(kernels[kernel]))
+			continue;
+
+		double pointDifference = 0.0;
+		double vectorDifference = 0.0;
+		double normalDifference = 0.0;
+
+		for (const Matrix4& m : matrices)
+		{
+			pointDifference = std::max(pointDifference, MaxBatchTransformDifference(kernels[kernel], m, false,
+				[](const Matrix4& m, const Vector3* in, size_t inStride, Vector3* out, size_t outStride, size_t count) { TransformPoints(m, in, inStride, out, outStride, count); },
+				[](const Matrix4& m, const Vector3A* in, Vector3A* out, size_t count) { TransformPoints(m, in, out, count); }));
+
+			vectorDifference = std::max(vectorDifference, MaxBatchTransformDifference(kernels[kernel], m, false,
+				[](const Matrix4& m, const Vector3* in, size_t inStride, Vector3* out, size_t outStride, size_t count) { TransformVectors(m, in, inStride, out, outStride, count); },
+				[](const Matrix4& m, const Vector3A* in, Vector3A* out, size_t count) { TransformVectors(m, in, out, count); }));
+
+			normalDifference = std::max(normalDifference, MaxBatchTransformDifference(kernels[kernel], m, true,
+				[](const Matrix4& m, const Vector3* in, size_t inStride, Vector3* out, size_t outStride, size_t count) { TransformNormals(m, in, inStride, out, outStride, count); },
+				[](const Matrix4& m, const Vector3A* in, Vector3A* out, size_t count) { TransformNormals(m, in, out, count); }));
+		}
+
+		snprintf(what, sizeof(what), "%s TransformPoints", kernelNames[kernel]);
+		bPassed &= VerifyNear(what, pointDifference, 0.0, 1.0e-6);
+		snprintf(what, sizeof(what), "%s TransformVectors", kernelNames[kernel]);
+		bPassed &= VerifyNear(what, vectorDifference, 0.0, 1.0e-6);
+		snprintf(what, sizeof(what), "%s TransformNormals", kernelNames[kernel]);
+		bPassed &= VerifyNear(what, normalDifference, 0.0, 1.0e-6);
+	}
+
+	return bPassed;
+}
+
+namespace
+{
+	//Bit equality, except that any NaN matches any other since F16C keeps NaN payloads the single value functions drop
+	bool SameFloat(float a, float b)
+	{
+		return (a != a && b != b) || memcmp(&a, &b, sizeof(float)) == 0;
+	}
+
+	bool SameHalf(uint16_t a, uint16_t b)
+	{
+		const bool bNaNA = (a & 0x7FFFu) > 0x7C00u;
+		const bool bNaNB = (b & 0x7FFFu) > 0x7C00u;
+
+		return (bNaNA && bNaNB) || a == b;
+	}
+
+	template <typename T, typename TSame>
+	bool VerifyPackedArray(const char* kernel, const char* what, const std::vector<T>& result, const std::vector<T>& expected, TSame same)
+	{
+		for (size_t i = 0; i < result.size(); i++)
+		{
+			if (!same(result[i], expected[i]))
+			{
+				printf("  %s %s differs from the single value function at element %zu\n", kernel, what, i);
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+//The array functions promise the same bits as the single value functions, checked with every kernel the CPU supports.
+//Counts aren't multiples of 8 so the scalar tails run too.
+NE_VERIFY(PackingKernelsMatchSingleValues)
+{
+	const PackingKernel kernels[] = { PackingKernel::Scalar, PackingKernel::SSE2, PackingKernel::F16C };
+	const char* kernelNames[] = { "Scalar", "SSE2", "F16C" };
+
+	//Random bit patterns cover NaNs and infinities, random mantissas around the half range cover rounding, denormals and overflow
+	std::vector<float> floats;
+	uint32_t seed = 50;
+
+	for (uint32_t i = 0; i < 65536; i++)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		uint32_t bits = seed;
+
+		if (i % 2 == 0)
+			bits = (bits & 0x807FFFFFu) | ((100 + (i / 2) % 48) << 23);
+
+		float f;
+		memcpy(&f, &bits, sizeof(f));
+		floats.push_back(f);
+	}
+
+	//Round to even ties, the largest half, the first value rounding to infinity and the smallest half denormal
+	const float special[] = { 0.0f, -0.0f, 1.0f + 1.0f / 2048.0f, 1.0f + 3.0f / 2048.0f, 65504.0f, 65519.0f, 65520.0f, 5.9604645e-8f, 2.9802322e-8f, 1.5f, -1.5f, 1.0f, -1.0f };
+	floats.insert(floats.end(), std::begin(special), std::end(special));
+
+	std::vector<uint16_t> halves(65536 + 3);
+	std::vector<int16_t> snorms(65536 + 3);
+
+	for (size_t i = 0; i < halves.size(); i++)
+	{
+		halves[i] = static_cast<uint16_t>(i);
+		snorms[i] = static_cast<int16_t>(i);
+	}
+
+	std::vector<Vector3> normals;
+
+	for (const BenchmarkVertex& vertex : CreateVertices(51))
+		normals.push_back(vertex.Normal);
+
+	//Axes and octant boundaries, where the lower hemisphere fold changes sign
+	const Vector3 axes[] = { Vector3(1.0f, 0.0f, 0.0f), Vector3(-1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f),
+		Vector3(0.0f, 0.0f, 1.0f), Vector3(0.0f, 0.0f, -1.0f), Vector3(-0.0f, -0.0f, -1.0f), Normalize(Vector3(1.0f, -1.0f, -1.0f)), Normalize(Vector3(-1.0f, 1.0f, 0.0f)) };
+	normals.insert(normals.end(), std::begin(axes), std::end(axes));
+
+	std::vector<uint16_t> expectedHalves(floats.size());
+	std::vector<float> expectedFloats(halves.size());
+	std::vector<int16_t> expectedSnorms(floats.size());
+	std::vector<float> expectedSnormFloats(snorms.size());
+	std::vector<uint32_t> expectedOctahedral(normals.size());
+	std::vector<Vector3> expectedNormals(normals.size());
+
+	for (size_t i = 0; i < floats.size(); i++)
+	{
+		expectedHalves[i] = FloatToHalf(floats[i]);
+		expectedSnorms[i] = PackSnorm16(floats[i]);
+	}
+
+	for (size_t i = 0; i < halves.size(); i++)
+	{
+		expectedFloats[i] = HalfToFloat(halves[i]);
+		expectedSnormFloats[i] = UnpackSnorm16(snorms[i]);
+	}
+
+	for (size_t i = 0; i < normals.size(); i++)
+	{
+		expectedOctahedral[i] = PackOctahedralSnorm16(normals[i]);
+		expectedNormals[i] = UnpackOctahedralSnorm16(expectedOctahedral[i]);
+	}
+
+	bool bPassed = true;
+
+	for (int kernel = 0; kernel < 3; kernel++)
+	{
+		if (!SetPackingKernel(kernels[kernel]))
+			continue;
+
+		std::vector<uint16_t> resultHalves(floats.size());
+		std::vector<float> resultFloats(halves.size());
+		std::vector<int16_t> resultSnorms(floats.size());
+		std::vector<float> resultSnormFloats(snorms.size());
+		std::vector<uint32_t> resultOctahedral(normals.size());
+		std::vector<Vector3> resultNormals(normals.size());
+
+		FloatsToHalves(floats.data(), resultHalves.data(), floats.size());
+		HalvesToFloats(halves.data(), resultFloats.data(), halves.size());
+		FloatsToSnorm16(floats.data(), resultSnorms.data(), floats.size());
+		Snorm16ToFloats(snorms.data(), resultSnormFloats.data(), snorms.size());
+		PackOctahedralNormals(normals.data(), sizeof(Vector3), resultOctahedral.data(), sizeof(uint32_t), normals.size());
+		UnpackOctahedralNormals(expectedOctahedral.data(), sizeof(uint32_t), resultNormals.data(), sizeof(Vector3), normals.size());
+
+		const char* name = kernelNames[kernel];
+
+		bPassed &= VerifyPackedArray(name, "FloatsToHalves", resultHalves, expectedHalves, SameHalf);
+		bPassed &= VerifyPackedArray(name, "HalvesToFloats", resultFloats, expectedFloats, SameFloat);
+		bPassed &= VerifyPackedArray(name, "FloatsToSnorm16", resultSnorms, expectedSnorms, [](int16_t a, int16_t b) { return a == b; });
+		bPassed &= VerifyPackedArray(name, "Snorm16ToFloats", resultSnormFloats, expectedSnormFloats, SameFloat);
+		bPassed &= VerifyPackedArray(name, "PackOctahedralNormals", resultOctahedral, expectedOctahedral, [](uint32_t a, uint32_t b) { return a == b; });
+		bPassed &= VerifyPackedArray(name, "UnpackOctahedralNormals", resultNormals, expectedNormals,
+			[](const Vector3& a, const Vector3& b) { return SameFloat(a.x, b.x) && SameFloat(a.y, b.y) && SameFloat(a.z, b.z); });
+	}
+
+	ResetPackingKernel();
+
+	return bPassed;
+}
@@ -0,0 +1,363 @@
+#include "RHIBenchmarks.h"
+#include <Rendering/RHI/RHICommandCapture.h>
+#include <Rendering/RHI/Null/NullRHICommandContext.h>
+#include <Rendering/PerObjectConstants.h>
+#include <Math/Vector3.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <cstdio>
+#include <vector>
+
+using namespace novus;
+
+namespace
+{
+	const uint32_t ObjectCount = 4096;
+
+	const uint64_t VertexBufferAddress = 0x100000;
+	const uint64_t IndexBufferAddress = 0x200000;
+	const uint64_t ConstantBufferAddress = 0x10000000;
+	const uint32_t ConstantBufferStride = 256;
+	const uint32_t IndexCount = 36;
+
+	/**
+	 *	Stand-in for a mapped D3D12BufferPool so constant buffer updates can be timed without a device.
+	 *	Regular heap memory is cached rather than write-combined, so this underestimates the benefit of streaming stores.
+	 */
+	struct ObjectConstantsPool
+	{
+		ObjectConstantsPool()
+			:Memory(ObjectCount * ConstantBufferStride + ConstantBufferStride),
+			PositionX(ObjectCount), PositionY(ObjectCount), PositionZ(ObjectCount),
+			ScaleX(ObjectCount), ScaleY(ObjectCount), ScaleZ(ObjectCount)
+		{
+			const uintptr_t address = reinterpret_cast<uintptr_t>(Memory.data());
+			Base = Memory.data() + ((ConstantBufferStride - address % ConstantBufferStride) % ConstantBufferStride);
+
+			for (uint32_t i = 0; i < ObjectCount; i++)
+			{
+				PositionX[i] = static_cast<float>(i % 64);
+				PositionY[i] = 0.0f;
+				PositionZ[i] = static_cast<float>(i / 64);
+				ScaleX[i] = ScaleY[i] = ScaleZ[i] = 0.25f + static_cast<float>(i % 7) * 0.1f;
+			}
+
+			View = Matrix4::LookAt(Vector3(0.0f, 20.0f, 50.0f), Vector3(), Vector3(0.0f, 1.0f, 0.0f));
+			Proj = Matrix4::Perspective(0.785398f, 1280.0f / 720.0f, 1.0f, 10000.0f);
+			ViewProj = View * Proj;
+		}
+
+		std::vector<uint8_t> Memory;
+		uint8_t* Base;
+
+		std::vector<float> PositionX, PositionY, PositionZ;
+		std::vector<float> ScaleX, ScaleY, ScaleZ;
+
+		Matrix4 View;
+		Matrix4 Proj;
+		Matrix4 ViewProj;
+	};
+}
+
+namespace novus
+{
+
+void RecordSyntheticFrame(RHICommandList& commandList, uint32_t objectCount)
+{
+	RHIViewport viewport = { 0.0f, 0.0f, 1280.0f, 720.0f, 0.0f, 1.0f };
+	RHIRect scissorRect = { 0, 0, 1280, 720 };
+
+	commandList.SetViewport(viewport);
+	commandList.SetScissorRect(scissorRect);
+	commandList.ClearRenderTarget(1, Vector4(0.0f, 0.2f, 0.4f, 1.0f));
+	commandList.SetPrimitiveTopology(RHIPrimitiveTopology::TriangleList);
+	commandList.SetVertexBuffer(0, VertexBufferAddress, 24 * 24, 24);
+	commandList.SetIndexBuffer(IndexBufferAddress, IndexCount * sizeof(uint32_t), RHIIndexFormat::UInt32);
+
+	for (uint32_t i = 0; i < objectCount; i++)
+	{
+		commandList.SetGraphicsRootConstantBufferView(0, ConstantBufferAddress + static_cast<uint64_t>(i) * ConstantBufferStride);
+		commandList.DrawIndexedInstanced(IndexCount, 1, 0, 0, 0);
+	}
+}
+
+bool WriteSyntheticCapture(const std::string& filePath, uint32_t objectCount)
+{
+	RHICommandList commandList;
+	RecordSyntheticFrame(commandList, objectCount);
+
+	const bool result = RHICommandCapture::WriteToFile(filePath, commandList);
+	commandList.Reset();
+
+	return result;
+}
+
+bool RunCaptureReplay(const std::string& filePath, const BenchmarkOptions& options)
+{
+	std::vector<uint8_t> data;
+
+	if (!RHICommandCapture::ReadFromFile(filePath, data))
+	{
+		printf("Failed to read capture %s\n", filePath.c_str());
+		return false;
+	}
+
+	RHICommandList commandList;
+	NullRHICommandContext context;
+	commandList.SetContext(&context);
+
+	if (!RHICommandCapture::Deserialize(data.data(), data.size(), commandList))
+	{
+		printf("%s is not a valid capture or was written by an incompatible version\n", filePath.c_str());
+		return false;
+	}
+
+	const uint32_t commandCount = commandList.GetCommandCount();
+
+	commandList.Execute();
+
+	const NullRHICommandContext::Statistics stats = context.GetStatistics();
+	printf("%s: %u commands, %llu draws, %llu state changes, %llu invalid draws\n",
+		filePath.c_str(),
+		commandCount,
+		static_cast<unsigned long long>(stats.DrawCount),
+		static_cast<unsigned long long>(stats.StateChangeCount),
+		static_cast<unsigned long long>(stats.InvalidDrawCount));
+
+	std::vector<double> deserializeSamples;
+	std::vector<double> executeSamples;
+
+	const uint32_t repetitions = std::max(options.Repetitions, 1u);
+
+	for (uint32_t i = 0; i < repetitions; i++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		RHICommandCapture::Deserialize(data.data(), data.size(), commandList);
+		auto recorded = std::chrono::steady_clock::now();
+		commandList.Execute();
+		auto end = std::chrono::steady_clock::now();
+
+		deserializeSamples.push_back(std::chrono::duration<double, std::nano>(recorded - start).count());
+		executeSamples.push_back(std::chrono::duration<double, std::nano>(end - recorded).count());
+	}
+
+	std::sort(deserializeSamples.begin(), deserializeSamples.end());
+	std::sort(executeSamples.begin(), executeSamples.end());
+
+	const double perCommand = commandCount > 0 ? 1.0 / static_cast<double>(commandCount) : 0.0;
+
+	printf("Rebuild: median %.3f ms, min %.3f ms, %.2f ns/command\n",
+		deserializeSamples[repetitions / 2] * 1.0e-6, deserializeSamples.front() * 1.0e-6, deserializeSamples[repetitions / 2] * perCommand);
+	printf("Execute: median %.3f ms, min %.3f ms, %.2f ns/command\n",
+		executeSamples[repetitions / 2] * 1.0e-6, executeSamples.front() * 1.0e-6, executeSamples[repetitions / 2] * perCommand);
+
+	return true;
+}
+
+}
+
+NE_BENCHMARK(RHIRecordFrame4K)
+{
+	static RHICommandList commandList;
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		RecordSyntheticFrame(commandList, ObjectCount);
+		DoNotOptimize(commandList.GetHead());
+		commandList.Reset();
+	}
+}
+
+NE_BENCHMARK(RHIExecuteFrame4KNull)
+{
+	static RHICommandList commandList;
+	static NullRHICommandContext context;
+	commandList.SetContext(&context);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		RecordSyntheticFrame(commandList, ObjectCount);
+		commandList.Execute();
+	}
+
+	DoNotOptimize(context.GetStatistics());
+}
+
+NE_BENCHMARK(RHICaptureFrame4K)
+{
+	static RHICommandList commandList;
+	static std::vector<uint8_t> data;
+
+	if (commandList.GetCommandCount() == 0)
+		RecordSyntheticFrame(commandList, ObjectCount);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		data.clear();
+		RHICommandCapture::Serialize(commandList, data);
+		DoNotOptimize(data.data());
+	}
+
+	state.SetBytesPerOp(data.size());
+}
+
+NE_BENCHMARK(RHIReplayFrame4KNull)
+{
+	static std::vector<uint8_t> data;
+	static RHICommandList commandList;
+	static NullRHICommandContext context;
+
+	if (data.empty())
+	{
+		RecordSyntheticFrame(commandList, ObjectCount);
+		RHICommandCapture::Serialize(commandList, data);
+		commandList.Reset();
+	}
+
+	commandList.SetContext(&context);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		RHICommandCapture::Deserialize(data.data(), data.size(), commandList);
+		commandList.Execute();
+	}
+
+	DoNotOptimize(context.GetStatistics());
+	state.SetBytesPerOp(data.size());
+}
+
+//Per object constant buffer updates for 4096 objects per op, objects/ms is 4096 * 10^6 / ns per op
+
+NE_BENCHMARK(PerObjectConstants4K)
+{
+	static ObjectConstantsPool pool;
+
+	ObjectTransformArrays objects;
+	objects.PositionX = pool.PositionX.data();
+	objects.PositionY = pool.PositionY.data();
+	objects.PositionZ = pool.PositionZ.data();
+	objects.ScaleX = pool.ScaleX.data();
+	objects.ScaleY = pool.ScaleY.data();
+	objects.ScaleZ = pool.ScaleZ.data();
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		ComputePerObjectConstants(pool.View, pool.ViewProj, objects, ObjectCount, pool.Base, ConstantBufferStride);
+		DoNotOptimize(pool.Base[0]);
+	}
+
+	state.SetBytesPerOp(ObjectCount * (sizeof(PerObjectConstants) + 6 * sizeof(float)));
+}
+
+//One object at a time through the matrix operators and a copy into the pool, like the test sample did before the batched kernel
+NE_BENCHMARK(PerObjectConstants4KSerial)
+{
+	static ObjectConstantsPool pool;
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		PerObjectConstants constants;
+
+		for (uint32_t object = 0; object < ObjectCount; object++)
+		{
+			const Vector3 scale(pool.ScaleX[object], pool.ScaleY[object], pool.ScaleZ[object]);
+			const Vector3 position(pool.PositionX[object], pool.PositionY[object], pool.PositionZ[object]);
+
+			const Matrix4 world = Matrix4::Scale(scale) * Matrix4::Translate(position);
+			const Matrix4 worldView = world * pool.View;
+
+			constants.World = Matrix3x4(world);
+			constants.WorldView = Matrix3x4(worldView);
+			constants.WorldViewProj = worldView * pool.Proj;
+
+			const Matrix4 inverseTranspose = Matrix4::Transpose(Matrix4::Inverse(world));
+			for (int row = 0; row < 3; row++)
+				constants.WorldInvTranspose[row] = inverseTranspose[row];
+
+			memcpy(pool.Base + object * ConstantBufferStride, &constants, sizeof(constants));
+		}
+
+		DoNotOptimize(pool.Base[0]);
+	}
+
+	state.SetBytesPerOp(ObjectCount * (sizeof(PerObjectConstants) + 6 * sizeof(float)));
+}
+
+NE_VERIFY(RHICaptureRoundTrip)
+{
+	RHICommandList recorded;
+	RecordSyntheticFrame(recorded, 64);
+
+	std::vector<uint8_t> data;
+	RHICommandCapture::Serialize(recorded, data);
+
+	RHICommandList replayed;
+	const bool bValid = RHICommandCapture::Deserialize(data.data(), data.size(), replayed);
+	const bool bMatches = bValid && RHICommandCapture::Equals(recorded, replayed);
+
+	recorded.Reset();
+	replayed.Reset();
+
+	if (!bMatches)
+		printf("  synthetic frame %s\n", bValid ? "changed in the round trip" : "capture was rejected");
+
+	return bMatches;
+}
+
+//Captures are read from files, indices a backend would use to address its arrays have to be rejected rather than replayed
+NE_VERIFY(RHICaptureRejectsOutOfRangeIndices)
+{
+	bool bPassed = true;
+
+	auto check = [&](const char* what, RHICommandList& commandList, bool bExpected)
+	{
+		std::vector<uint8_t> data;
+		RHICommandCapture::Serialize(commandList, data);
+		commandList.Reset();
+
+		RHICommandList replayed;
+		const bool bValid = RHICommandCapture::Deserialize(data.data(), data.size(), replayed);
+		replayed.Reset();
+
+		if (bValid != bExpected)
+		{
+			printf("  %s was %s\n", what, bValid ? "accepted" : "rejected");
+			bPassed = false;
+		}
+	};
+
+	RHICommandList commandList;
+
+	commandList.SetVertexBuffer(IRHICommandContext::MaxVertexBufferSlots - 1, VertexBufferAddress, 24, 24);
+	commandList.SetGraphicsRootConstantBufferView(IRHICommandContext::MaxRootParameters - 1, ConstantBufferAddress);
+	check("last slot and root parameter", commandList, true);
+
+	commandList.SetVertexBuffer(IRHICommandContext::MaxVertexBufferSlots, VertexBufferAddress, 24, 24);
+	check("vertex buffer slot past the limit", commandList, false);
+
+	commandList.SetGraphicsRootConstantBufferView(IRHICommandContext::MaxRootParameters, ConstantBufferAddress);
+	check("constant buffer view root parameter past the limit", commandList, false);
+
+	commandList.SetGraphicsRootDescriptorTable(0xFFFFFFFF, 0);
+	check("descriptor table root parameter past the limit", commandList, false);
+
+	commandList.SetPrimitiveTopology(static_cast<RHIPrimitiveTopology>(100));
+	check("unknown primitive topology", commandList, false);
+
+	//The null backend counts draws after an out of range binding as invalid instead of writing past its state
+	NullRHICommandContext context;
+	commandList.SetContext(&context);
+	RecordSyntheticFrame(commandList, 1);
+	commandList.SetGraphicsRootConstantBufferView(IRHICommandContext::MaxRootParameters, ConstantBufferAddress);
+	commandList.DrawIndexedInstanced(IndexCount, 1, 0, 0, 0);
+	commandList.Execute();
+
+	if (context.GetStatistics().InvalidDrawCount != 1)
+	{
+		printf("  null backend counted %llu invalid draws, expected 1\n", static_cast<unsigned long long>(context.GetStatistics().InvalidDrawCount));
+		bPassed = false;
+	}
+
+	return bPassed;
+}
@@ -0,0 +1,31 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include "Benchmark.h"
+#include <Rendering/RHI/RHICommandList.h>
+
+namespace novus
+{
+
+/**
+ *	Records a frame shaped like the TestSample's, one root constant buffer view and draw per object.
+ */
+void RecordSyntheticFrame(RHICommandList& commandList, uint32_t objectCount);
+
+/**
+ *	Writes a capture of the synthetic frame to a file so it can be replayed later.
+ */
+bool WriteSyntheticCapture(const std::string& filePath, uint32_t objectCount);
+
+/**
+ *	Loads a capture file and times rebuilding and executing it against the null command context.
+ */
+bool RunCaptureReplay(const std::string& filePath, const BenchmarkOptions& options);
+
+}
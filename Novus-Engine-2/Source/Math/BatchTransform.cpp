@@ -0,0 +1,482 @@
+#include "BatchTransform.h"
+#include "Utility/Platform/CpuFeatures.h"
+#include <stdint.h>
+#include <cmath>
+#include <climits>
+
+#if NE_PLATFORM_X86
+#include <immintrin.h>
+#endif
+
+namespace novus
+{
+
+static_assert(sizeof(Vector3) == 3 * sizeof(float), "Batch transforms assume Vector3 is three packed floats");
+
+namespace
+{
+	struct TransformParams
+	{
+		//Upper 3x3 of the matrix and the translation, zero for directions
+		float M[3][3];
+		float T[3];
+		bool bNormalize;
+	};
+
+	typedef void(*TransformKernelFunction)(const TransformParams& p, const uint8_t* in, size_t inStride, uint8_t* out, size_t outStride, size_t count);
+
+	void TransformScalar(const TransformParams& p, const uint8_t* in, size_t inStride, uint8_t* out, size_t outStride, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			const float* v = reinterpret_cast<const float*>(in + i * inStride);
+			const float x = v[0];
+			const float y = v[1];
+			const float z = v[2];
+
+			float ox = x * p.M[0][0] + y * p.M[1][0] + z * p.M[2][0] + p.T[0];
+			float oy = x * p.M[0][1] + y * p.M[1][1] + z * p.M[2][1] + p.T[1];
+			float oz = x * p.M[0][2] + y * p.M[1][2] + z * p.M[2][2] + p.T[2];
+
+			if (p.bNormalize)
+			{
+				const float length = std::sqrt(ox * ox + oy * oy + oz * oz);
+				ox /= length;
+				oy /= length;
+				oz /= length;
+			}
+
+			float* o = reinterpret_cast<float*>(out + i * outStride);
+			o[0] = ox;
+			o[1] = oy;
+			o[2] = oz;
+		}
+	}
+
+	/**
+	 *	One Vector3A per register, also the tail of the AVX2 kernel
+	 */
+	void TransformAligned(const TransformParams& p, const Vector3A* in, Vector3A* out, size_t count)
+	{
+#if NE_MATH_SSE || NE_MATH_NEON
+		const simd::Float4 m0 = simd::Set4(p.M[0][0], p.M[0][1], p.M[0][2], 0.0f);
+		const simd::Float4 m1 = simd::Set4(p.M[1][0], p.M[1][1], p.M[1][2], 0.0f);
+		const simd::Float4 m2 = simd::Set4(p.M[2][0], p.M[2][1], p.M[2][2], 0.0f);
+		const simd::Float4 t = simd::Set4(p.T[0], p.T[1], p.T[2], 0.0f);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const simd::Float4 v = in[i].v;
+
+			simd::Float4 result = simd::MulAdd(simd::Splat<0>(v), m0, t);
+			result = simd::MulAdd(simd::Splat<1>(v), m1, result);
+			result = simd::MulAdd(simd::Splat<2>(v), m2, result);
+
+			out[i] = p.bNormalize ? Normalize(Vector3A(result)) : Vector3A(result);
+		}
+#else
+		//The padding is never written by the scalar kernel
+		for (size_t i = 0; i < count; i++)
+			out[i].padding = 0.0f;
+
+		TransformScalar(p, reinterpret_cast<const uint8_t*>(in), sizeof(Vector3A), reinterpret_cast<uint8_t*>(out), sizeof(Vector3A), count);
+#endif
+	}
+
+#if NE_PLATFORM_X86
+	/**
+	 *	Splits 8 packed Vector3s into one register per component, each 128 bit lane handles 4 of the vectors
+	 */
+	NE_TARGET("avx2") inline void LoadPacked8(const float* src, __m256& x, __m256& y, __m256& z)
+	{
+		const __m256 m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src)), _mm_loadu_ps(src + 12), 1);
+		const __m256 m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 4)), _mm_loadu_ps(src + 16), 1);
+		const __m256 m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 8)), _mm_loadu_ps(src + 20), 1);
+
+		const __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+		const __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+
+		x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+		y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+		z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+	}
+
+	//Inverse of LoadPacked8
+	NE_TARGET("avx2") inline void StorePacked8(float* dst, __m256 x, __m256 y, __m256 z)
+	{
+		const __m256 xy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m256 yz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+		const __m256 zx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+
+		const __m256 m03 = _mm256_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m256 m14 = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+		const __m256 m25 = _mm256_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1));
+
+		_mm_storeu_ps(dst, _mm256_castps256_ps128(m03));
+		_mm_storeu_ps(dst + 4, _mm256_castps256_ps128(m14));
+		_mm_storeu_ps(dst + 8, _mm256_castps256_ps128(m25));
+		_mm_storeu_ps(dst + 12, _mm256_extractf128_ps(m03, 1));
+		_mm_storeu_ps(dst + 16, _mm256_extractf128_ps(m14, 1));
+		_mm_storeu_ps(dst + 20, _mm256_extractf128_ps(m25, 1));
+	}
+
+	NE_TARGET("avx2,fma") void TransformAVX2(const TransformParams& p, const uint8_t* in, size_t inStride, uint8_t* out, size_t outStride, size_t count)
+	{
+		const __m256 m00 = _mm256_set1_ps(p.M[0][0]), m01 = _mm256_set1_ps(p.M[0][1]), m02 = _mm256_set1_ps(p.M[0][2]);
+		const __m256 m10 = _mm256_set1_ps(p.M[1][0]), m11 = _mm256_set1_ps(p.M[1][1]), m12 = _mm256_set1_ps(p.M[1][2]);
+		const __m256 m20 = _mm256_set1_ps(p.M[2][0]), m21 = _mm256_set1_ps(p.M[2][1]), m22 = _mm256_set1_ps(p.M[2][2]);
+		const __m256 t0 = _mm256_set1_ps(p.T[0]), t1 = _mm256_set1_ps(p.T[1]), t2 = _mm256_set1_ps(p.T[2]);
+
+		const bool bPackedIn = inStride == sizeof(Vector3);
+		const bool bPackedOut = outStride == sizeof(Vector3);
+
+		//Offsets of the vectors from the first one in floats
+		const __m256i gatherOffsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(inStride / sizeof(float))));
+
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const float* src = reinterpret_cast<const float*>(in + i * inStride);
+			__m256 x, y, z;
+
+			if (bPackedIn)
+			{
+				LoadPacked8(src, x, y, z);
+			}
+			else
+			{
+				x = _mm256_i32gather_ps(src, gatherOffsets, 4);
+				y = _mm256_i32gather_ps(src + 1, gatherOffsets, 4);
+				z = _mm256_i32gather_ps(src + 2, gatherOffsets, 4);
+			}
+
+			__m256 ox = _mm256_fmadd_ps(x, m00, _mm256_fmadd_ps(y, m10, _mm256_fmadd_ps(z, m20, t0)));
+			__m256 oy = _mm256_fmadd_ps(x, m01, _mm256_fmadd_ps(y, m11, _mm256_fmadd_ps(z, m21, t1)));
+			__m256 oz = _mm256_fmadd_ps(x, m02, _mm256_fmadd_ps(y, m12, _mm256_fmadd_ps(z, m22, t2)));
+
+			if (p.bNormalize)
+			{
+				const __m256 length = _mm256_sqrt_ps(_mm256_fmadd_ps(ox, ox, _mm256_fmadd_ps(oy, oy, _mm256_mul_ps(oz, oz))));
+				ox = _mm256_div_ps(ox, length);
+				oy = _mm256_div_ps(oy, length);
+				oz = _mm256_div_ps(oz, length);
+			}
+
+			if (bPackedOut)
+			{
+				StorePacked8(reinterpret_cast<float*>(out + i * outStride), ox, oy, oz);
+			}
+			else
+			{
+				//No scatter in AVX2, write each vector without touching the bytes between them
+				alignas(32) float xs[8], ys[8], zs[8];
+				_mm256_store_ps(xs, ox);
+				_mm256_store_ps(ys, oy);
+				_mm256_store_ps(zs, oz);
+
+				for (size_t j = 0; j < 8; j++)
+				{
+					float* o = reinterpret_cast<float*>(out + (i + j) * outStride);
+					o[0] = xs[j];
+					o[1] = ys[j];
+					o[2] = zs[j];
+				}
+			}
+		}
+
+		TransformScalar(p, in + i * inStride, inStride, out + i * outStride, outStride, count - i);
+	}
+
+	/**
+	 *	Splits 8 Vector3As into one register per component with an in-lane transpose.
+	 *	Each 128 bit lane gets every other vector, which StoreAligned8 puts back in the same order.
+	 */
+	NE_TARGET("avx2") inline void LoadAligned8(const Vector3A* src, __m256& x, __m256& y, __m256& z)
+	{
+		const __m256 v01 = _mm256_loadu_ps(&src[0].x);
+		const __m256 v23 = _mm256_loadu_ps(&src[2].x);
+		const __m256 v45 = _mm256_loadu_ps(&src[4].x);
+		const __m256 v67 = _mm256_loadu_ps(&src[6].x);
+
+		const __m256 xy0246 = _mm256_unpacklo_ps(v01, v23);
+		const __m256 xy4567 = _mm256_unpacklo_ps(v45, v67);
+		const __m256 zw0246 = _mm256_unpackhi_ps(v01, v23);
+		const __m256 zw4567 = _mm256_unpackhi_ps(v45, v67);
+
+		x = _mm256_shuffle_ps(xy0246, xy4567, _MM_SHUFFLE(1, 0, 1, 0));
+		y = _mm256_shuffle_ps(xy0246, xy4567, _MM_SHUFFLE(3, 2, 3, 2));
+		z = _mm256_shuffle_ps(zw0246, zw4567, _MM_SHUFFLE(1, 0, 1, 0));
+	}
+
+	//Inverse of LoadAligned8, with zero padding
+	NE_TARGET("avx2") inline void StoreAligned8(Vector3A* dst, __m256 x, __m256 y, __m256 z)
+	{
+		const __m256 zero = _mm256_setzero_ps();
+
+		const __m256 xyLow = _mm256_unpacklo_ps(x, y);
+		const __m256 xyHigh = _mm256_unpackhi_ps(x, y);
+		const __m256 zwLow = _mm256_unpacklo_ps(z, zero);
+		const __m256 zwHigh = _mm256_unpackhi_ps(z, zero);
+
+		_mm256_storeu_ps(&dst[0].x, _mm256_shuffle_ps(xyLow, zwLow, _MM_SHUFFLE(1, 0, 1, 0)));
+		_mm256_storeu_ps(&dst[2].x, _mm256_shuffle_ps(xyLow, zwLow, _MM_SHUFFLE(3, 2, 3, 2)));
+		_mm256_storeu_ps(&dst[4].x, _mm256_shuffle_ps(xyHigh, zwHigh, _MM_SHUFFLE(1, 0, 1, 0)));
+		_mm256_storeu_ps(&dst[6].x, _mm256_shuffle_ps(xyHigh, zwHigh, _MM_SHUFFLE(3, 2, 3, 2)));
+	}
+
+	NE_TARGET("avx2,fma") void TransformAlignedAVX2(const TransformParams& p, const Vector3A* in, Vector3A* out, size_t count)
+	{
+		const __m256 m00 = _mm256_set1_ps(p.M[0][0]), m01 = _mm256_set1_ps(p.M[0][1]), m02 = _mm256_set1_ps(p.M[0][2]);
+		const __m256 m10 = _mm256_set1_ps(p.M[1][0]), m11 = _mm256_set1_ps(p.M[1][1]), m12 = _mm256_set1_ps(p.M[1][2]);
+		const __m256 m20 = _mm256_set1_ps(p.M[2][0]), m21 = _mm256_set1_ps(p.M[2][1]), m22 = _mm256_set1_ps(p.M[2][2]);
+		const __m256 t0 = _mm256_set1_ps(p.T[0]), t1 = _mm256_set1_ps(p.T[1]), t2 = _mm256_set1_ps(p.T[2]);
+
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 x, y, z;
+			LoadAligned8(in + i, x, y, z);
+
+			__m256 ox = _mm256_fmadd_ps(x, m00, _mm256_fmadd_ps(y, m10, _mm256_fmadd_ps(z, m20, t0)));
+			__m256 oy = _mm256_fmadd_ps(x, m01, _mm256_fmadd_ps(y, m11, _mm256_fmadd_ps(z, m21, t1)));
+			__m256 oz = _mm256_fmadd_ps(x, m02, _mm256_fmadd_ps(y, m12, _mm256_fmadd_ps(z, m22, t2)));
+
+			if (p.bNormalize)
+			{
+				const __m256 length = _mm256_sqrt_ps(_mm256_fmadd_ps(ox, ox, _mm256_fmadd_ps(oy, oy, _mm256_mul_ps(oz, oz))));
+				ox = _mm256_div_ps(ox, length);
+				oy = _mm256_div_ps(oy, length);
+				oz = _mm256_div_ps(oz, length);
+			}
+
+			StoreAligned8(out + i, ox, oy, oz);
+		}
+
+		TransformAligned(p, in + i, out + i, count - i);
+	}
+
+	NE_TARGET("avx512f") void TransformAVX512(const TransformParams& p, const uint8_t* in, size_t inStride, uint8_t* out, size_t outStride, size_t count)
+	{
+		//Gathers are slower than the AVX2 shuffles when there is nothing between the vectors
+		if (inStride == sizeof(Vector3) && outStride == sizeof(Vector3))
+		{
+			TransformAVX2(p, in, inStride, out, outStride, count);
+			return;
+		}
+
+		const __m512 m00 = _mm512_set1_ps(p.M[0][0]), m01 = _mm512_set1_ps(p.M[0][1]), m02 = _mm512_set1_ps(p.M[0][2]);
+		const __m512 m10 = _mm512_set1_ps(p.M[1][0]), m11 = _mm512_set1_ps(p.M[1][1]), m12 = _mm512_set1_ps(p.M[1][2]);
+		const __m512 m20 = _mm512_set1_ps(p.M[2][0]), m21 = _mm512_set1_ps(p.M[2][1]), m22 = _mm512_set1_ps(p.M[2][2]);
+		const __m512 t0 = _mm512_set1_ps(p.T[0]), t1 = _mm512_set1_ps(p.T[1]), t2 = _mm512_set1_ps(p.T[2]);
+
+		const __m512i lanes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+		const __m512i inOffsets = _mm512_mullo_epi32(lanes, _mm512_set1_epi32(static_cast<int>(inStride / sizeof(float))));
+		const __m512i outOffsets = _mm512_mullo_epi32(lanes, _mm512_set1_epi32(static_cast<int>(outStride / sizeof(float))));
+
+		size_t i = 0;
+
+		for (; i + 16 <= count; i += 16)
+		{
+			const float* src = reinterpret_cast<const float*>(in + i * inStride);
+
+			const __m512 x = _mm512_i32gather_ps(inOffsets, src, 4);
+			const __m512 y = _mm512_i32gather_ps(inOffsets, src + 1, 4);
+			const __m512 z = _mm512_i32gather_ps(inOffsets, src + 2, 4);
+
+			__m512 ox = _mm512_fmadd_ps(x, m00, _mm512_fmadd_ps(y, m10, _mm512_fmadd_ps(z, m20, t0)));
+			__m512 oy = _mm512_fmadd_ps(x, m01, _mm512_fmadd_ps(y, m11, _mm512_fmadd_ps(z, m21, t1)));
+			__m512 oz = _mm512_fmadd_ps(x, m02, _mm512_fmadd_ps(y, m12, _mm512_fmadd_ps(z, m22, t2)));
+
+			if (p.bNormalize)
+			{
+				const __m512 length = _mm512_sqrt_ps(_mm512_fmadd_ps(ox, ox, _mm512_fmadd_ps(oy, oy, _mm512_mul_ps(oz, oz))));
+				ox = _mm512_div_ps(ox, length);
+				oy = _mm512_div_ps(oy, length);
+				oz = _mm512_div_ps(oz, length);
+			}
+
+			float* dst = reinterpret_cast<float*>(out + i * outStride);
+
+			_mm512_i32scatter_ps(dst, outOffsets, ox, 4);
+			_mm512_i32scatter_ps(dst + 1, outOffsets, oy, 4);
+			_mm512_i32scatter_ps(dst + 2, outOffsets, oz, 4);
+		}
+
+		TransformScalar(p, in + i * inStride, inStride, out + i * outStride, outStride, count - i);
+	}
+#endif
+
+	TransformKernelFunction GetKernelFunction(BatchTransformKernel kernel)
+	{
+		switch (kernel)
+		{
+#if NE_PLATFORM_X86
+		case BatchTransformKernel::AVX2:
+			return &TransformAVX2;
+		case BatchTransformKernel::AVX512:
+			return &TransformAVX512;
+#endif
+		default:
+			return &TransformScalar;
+		}
+	}
+
+	BatchTransformKernel SelectFastestKernel()
+	{
+		if (IsBatchTransformKernelSupported(BatchTransformKernel::AVX512))
+			return BatchTransformKernel::AVX512;
+
+		if (IsBatchTransformKernelSupported(BatchTransformKernel::AVX2))
+			return BatchTransformKernel::AVX2;
+
+		return BatchTransformKernel::Scalar;
+	}
+
+	BatchTransformKernel& GetKernelSelection()
+	{
+		static BatchTransformKernel selection = SelectFastestKernel();
+
+		return selection;
+	}
+
+	void RunTransform(const TransformParams& p, const Vector3* in, size_t inStride, Vector3* out, size_t outStride, size_t count)
+	{
+		const uint8_t* inBytes = reinterpret_cast<const uint8_t*>(in);
+		uint8_t* outBytes = reinterpret_cast<uint8_t*>(out);
+
+		//The SIMD kernels address vectors with 32 bit float offsets from the first vector of a batch
+		const size_t maxStride = static_cast<size_t>(INT_MAX) / 16;
+		const bool bSIMDStrides = inStride % sizeof(float) == 0 && outStride % sizeof(float) == 0 && inStride <= maxStride && outStride <= maxStride;
+
+		GetKernelFunction(bSIMDStrides ? GetKernelSelection() : BatchTransformKernel::Scalar)(p, inBytes, inStride, outBytes, outStride, count);
+	}
+
+	void RunAlignedTransform(const TransformParams& p, const Vector3A* in, Vector3A* out, size_t count)
+	{
+#if NE_PLATFORM_X86
+		//The AVX-512 selection also uses the AVX2 kernel, loads of whole vectors need no gathers
+		if (GetKernelSelection() != BatchTransformKernel::Scalar)
+		{
+			TransformAlignedAVX2(p, in, out, count);
+			return;
+		}
+#endif
+
+		TransformAligned(p, in, out, count);
+	}
+
+	TransformParams GetParams(const Matrix4& m, bool bTranslate)
+	{
+		TransformParams p;
+
+		for (int row = 0; row < 3; row++)
+		{
+			for (int column = 0; column < 3; column++)
+			{
+				p.M[row][column] = m[row][column];
+			}
+
+			p.T[row] = bTranslate ? m[3][row] : 0.0f;
+		}
+
+		p.bNormalize = false;
+
+		return p;
+	}
+
+	TransformParams GetNormalParams(const Matrix4& m)
+	{
+		const Vector3 r0(m[0][0], m[0][1], m[0][2]);
+		const Vector3 r1(m[1][0], m[1][1], m[1][2]);
+		const Vector3 r2(m[2][0], m[2][1], m[2][2]);
+
+		//The rows of the cofactor matrix are the cross products of the other two rows.
+		//It equals the inverse transpose times the determinant, which only scales the normals before they are renormalized,
+		//the sign of the determinant is kept so mirroring transforms still flip normals
+		const Vector3 c0 = Cross(r1, r2);
+		const Vector3 c1 = Cross(r2, r0);
+		const Vector3 c2 = Cross(r0, r1);
+		const float determinantSign = Dot(r0, c0) < 0.0f ? -1.0f : 1.0f;
+
+		TransformParams p;
+		p.M[0][0] = c0.x * determinantSign; p.M[0][1] = c0.y * determinantSign; p.M[0][2] = c0.z * determinantSign;
+		p.M[1][0] = c1.x * determinantSign; p.M[1][1] = c1.y * determinantSign; p.M[1][2] = c1.z * determinantSign;
+		p.M[2][0] = c2.x * determinantSign; p.M[2][1] = c2.y * determinantSign; p.M[2][2] = c2.z * determinantSign;
+		p.T[0] = p.T[1] = p.T[2] = 0.0f;
+		p.bNormalize = true;
+
+		return p;
+	}
+}
+
+void TransformPoints(const Matrix4& m, const Vector3* in, size_t inStride, Vector3* out, size_t outStride, size_t count)
+{
+	RunTransform(GetParams(m, true), in, inStride, out, outStride, count);
+}
+
+void TransformVectors(const Matrix4& m, const Vector3* in, size_t inStride, Vector3* out, size_t outStride, size_t count)
+{
+	RunTransform(GetParams(m, false), in, inStride, out, outStride, count);
+}
+
+void TransformNormals(const Matrix4& m, const Vector3* in, size_t inStride, Vector3* out, size_t outStride, size_t count)
+{
+	RunTransform(GetNormalParams(m), in, inStride, out, outStride, count);
+}
+
+void TransformPoints(const Matrix4& m, const Vector3A* in, Vector3A* out, size_t count)
+{
+	RunAlignedTransform(GetParams(m, true), in, out, count);
+}
+
+void TransformVectors(const Matrix4& m, const Vector3A* in, Vector3A* out, size_t count)
+{
+	RunAlignedTransform(GetParams(m, false), in, out, count);
+}
+
+void TransformNormals(const Matrix4& m, const Vector3A* in, Vector3A* out, size_t count)
+{
+	RunAlignedTransform(GetNormalParams(m), in, out, count);
+}
+
+bool IsBatchTransformKernelSupported(BatchTransformKernel kernel)
+{
+	switch (kernel)
+	{
+	case BatchTransformKernel::Scalar:
+		return true;
+#if NE_PLATFORM_X86
+	case BatchTransformKernel::AVX2:
+		return GetCpuFeatures().bAVX2 && GetCpuFeatures().bFMA;
+	case BatchTransformKernel::AVX512:
+		//Packed streams are handed to the AVX2 kernel
+		return GetCpuFeatures().bAVX512F && GetCpuFeatures().bFMA;
+#endif
+	default:
+		return false;
+	}
+}
+
+bool SetBatchTransformKernel(BatchTransformKernel kernel)
+{
+	if (!IsBatchTransformKernelSupported(kernel))
+		return false;
+
+	GetKernelSelection() = kernel;
+
+	return true;
+}
+
+void ResetBatchTransformKernel()
+{
+	GetKernelSelection() = SelectFastestKernel();
+}
+
+BatchTransformKernel GetBatchTransformKernel()
+{
+	return GetKernelSelection();
+}
+
+}
@@ -0,0 +1,96 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include "Vector3.h"
+#include "VectorA.h"
+#include "Matrix4.h"
+
+/**
+ *	Transforms of whole streams of Vector3s by one matrix, for vertex data, skinning, bounds and culling.
+ *
+ *	Vectors are read and written with a byte stride so they can be fields of larger structs, e.g. the positions in an array of vertices.
+ *	A stride of sizeof(Vector3) is a tightly packed array. Strides must be multiples of 4.
+ *	Input and output may be the same memory if they use the same stride, otherwise they must not overlap.
+ *
+ *	Vectors are row vectors like the rest of the math library, out = in * m.
+ *	The SIMD kernels load 8 or 16 vectors at a time and transpose them so each register holds one component of every vector.
+ *	They fuse multiplies and adds, so results differ from the scalar kernel by a few ulps. The benchmark's --verify
+ *	allows 1e-6 relative to the largest component of each vector, differences measured so far stay below 2.2e-7.
+ */
+
+namespace novus
+{
+
+enum class BatchTransformKernel
+{
+	Scalar,
+	//8 vectors at a time with AVX2 and FMA
+	AVX2,
+	//16 vectors at a time with AVX-512 gathers and scatters, tightly packed streams use the AVX2 kernel
+	AVX512
+};
+
+/**
+ *	Transforms positions, including the translation of the matrix. The matrix is assumed to be affine, there is no divide by w.
+ */
+void TransformPoints(const Matrix4& m, const Vector3* in, size_t inStride, Vector3* out, size_t outStride, size_t count);
+
+inline void TransformPoints(const Matrix4& m, const Vector3* in, size_t stride, Vector3* out, size_t count)
+{
+	TransformPoints(m, in, stride, out, stride, count);
+}
+
+/**
+ *	Transforms directions by the upper 3x3 of the matrix, ignoring translation
+ */
+void TransformVectors(const Matrix4& m, const Vector3* in, size_t inStride, Vector3* out, size_t outStride, size_t count);
+
+inline void TransformVectors(const Matrix4& m, const Vector3* in, size_t stride, Vector3* out, size_t count)
+{
+	TransformVectors(m, in, stride, out, stride, count);
+}
+
+/**
+ *	Transforms normals by the inverse transpose of the upper 3x3 of the matrix and renormalizes them,
+ *	so they stay perpendicular to surfaces transformed by the matrix even with non-uniform scale
+ */
+void TransformNormals(const Matrix4& m, const Vector3* in, size_t inStride, Vector3* out, size_t outStride, size_t count);
+
+inline void TransformNormals(const Matrix4& m, const Vector3* in, size_t stride, Vector3* out, size_t count)
+{
+	TransformNormals(m, in, stride, out, stride, count);
+}
+
+/**
+ *	Transforms of Vector3A arrays. The scalar kernel selection handles one vector per register, the others transpose 8 at a time with AVX2
+ *	which takes fewer shuffles than for packed Vector3s. The outputs' padding is set to zero. Input and output may be the same array.
+ */
+void TransformPoints(const Matrix4& m, const Vector3A* in, Vector3A* out, size_t count);
+
+void TransformVectors(const Matrix4& m, const Vector3A* in, Vector3A* out, size_t count);
+
+void TransformNormals(const Matrix4& m, const Vector3A* in, Vector3A* out, size_t count);
+
+bool IsBatchTransformKernelSupported(BatchTransformKernel kernel);
+
+/**
+ *	Overrides the kernel picked from the CPU features, for testing and benchmarks. Not thread safe.
+ *	@return false if the CPU does not support the kernel, the current selection is kept
+ */
+bool SetBatchTransformKernel(BatchTransformKernel kernel);
+
+/**
+ *	Goes back to the fastest kernel the CPU supports
+ */
+void ResetBatchTransformKernel();
+
+BatchTransformKernel GetBatchTransformKernel();
+
+}
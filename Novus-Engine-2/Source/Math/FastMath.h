@@ -0,0 +1,581 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+#include "MathSIMD.h"
+#include "Vector2.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+/**
+ *	Polynomial approximations of the <cmath> functions, for code that evaluates them in bulk such as normalization,
+ *	animation and procedural generation.
+ *
+ *	Every function takes a float, a simd::Float4 or, in NE_MATH_AVX2 builds, a simd::Float8 and evaluates the same polynomial
+ *	for each of them, so a batch kernel and its scalar tail agree. There are no branches, every lane takes the same path.
+ *
+ *	The precision is a template argument, Medium when it is left out. The bounds given for each function are the largest errors
+ *	measured against the double precision <cmath> function over the whole domain, rounding included.
+ */
+
+namespace novus
+{
+
+enum class FastMathPrecision
+{
+	//About 11 bits, for lighting, noise and anything that ends up in an 8 bit channel
+	Low,
+	//At least 17 bits
+	Medium,
+	//A few ulp from the float <cmath> functions
+	High
+};
+
+namespace fastmath
+{
+	/**
+	 *	1 / sqrt(x) for x > 0. Low is the hardware estimate, Medium adds a Newton-Raphson step and High divides by the square root.
+	 *	Relative error: Low 6.5e-4, Medium 7.7e-7, High 9e-8
+	 */
+	template <FastMathPrecision P = FastMathPrecision::Medium, typename V>
+	V Rsqrt(V x);
+
+	/**
+	 *	Sine and cosine of x in radians, reduced to [-pi/4, pi/4] around the nearest multiple of pi/2.
+	 *	Absolute error for |x| <= 8192: Low 4.6e-4, Medium 1.6e-6, High 8.6e-8. Larger angles lose precision in the reduction,
+	 *	wrap them with Math::WrapAngle first.
+	 */
+	template <FastMathPrecision P = FastMathPrecision::Medium, typename V>
+	void SinCos(V x, V& s, V& c);
+
+	template <FastMathPrecision P = FastMathPrecision::Medium, typename V>
+	V Sin(V x);
+
+	template <FastMathPrecision P = FastMathPrecision::Medium, typename V>
+	V Cos(V x);
+
+	/**
+	 *	Angle of (x, y) in [-pi, pi] for finite x and y, 0 when both are zero. Negative zeros are treated as positive.
+	 *	Absolute error: Low 2.6e-4, Medium 5.5e-6, High 3e-7
+	 */
+	template <FastMathPrecision P = FastMathPrecision::Medium, typename V>
+	V Atan2(V y, V x);
+
+	/**
+	 *	acos(x) in [0, pi]. x is clamped to [-1, 1], so dot products of unit vectors that round slightly past 1 don't give NaN.
+	 *	Absolute error: Low 5.8e-4, Medium 8.4e-6, High 3.6e-7
+	 */
+	template <FastMathPrecision P = FastMathPrecision::Medium, typename V>
+	V Acos(V x);
+
+	/**
+	 *	2^x with x clamped to [-126, 127], so results stay normal floats.
+	 *	Relative error: Low 4.4e-4, Medium 5.5e-6, High 1e-7
+	 */
+	template <FastMathPrecision P = FastMathPrecision::Medium, typename V>
+	V Exp2(V x);
+
+	/**
+	 *	log2(x) for positive, normal and finite x.
+	 *	Error relative to the larger of 1 and |log2(x)|: Low 2.3e-5, Medium 3.3e-7, High 2.1e-7
+	 */
+	template <FastMathPrecision P = FastMathPrecision::Medium, typename V>
+	V Log2(V x);
+
+	/**
+	 *	v / Length(v) using Rsqrt. The length must not be zero.
+	 */
+	template <FastMathPrecision P = FastMathPrecision::Medium>
+	Vector2 Normalize(const Vector2& v);
+
+	template <FastMathPrecision P = FastMathPrecision::Medium>
+	Vector3 Normalize(const Vector3& v);
+
+	template <FastMathPrecision P = FastMathPrecision::Medium>
+	Vector4 Normalize(const Vector4& v);
+}
+
+}
+
+/**
+ *	Lane operations
+ */
+
+namespace novus
+{
+namespace fastmath
+{
+namespace detail
+{
+	template <FastMathPrecision P>
+	using PrecisionTag = std::integral_constant<FastMathPrecision, P>;
+
+	typedef PrecisionTag<FastMathPrecision::Low> LowTag;
+	typedef PrecisionTag<FastMathPrecision::Medium> MediumTag;
+	typedef PrecisionTag<FastMathPrecision::High> HighTag;
+
+	template <typename V>
+	V Set(float s);
+
+#if NE_MATH_SSE || NE_MATH_NEON
+	/**
+	 *	Single floats go through the first lane of the Float4 path, so they take no branches and give the same results as the SIMD calls.
+	 *	The quadrants and octants of the inputs are as good as random, a compiler branching on them mispredicts half of the time.
+	 */
+	template <typename V>
+	struct Lanes
+	{
+		typedef V Type;
+
+		static V Widen(V v) { return v; }
+		static V Narrow(V v) { return v; }
+	};
+
+	template <>
+	struct Lanes<float>
+	{
+		typedef simd::Float4 Type;
+
+		static simd::Float4 Widen(float v) { return simd::Set1(v); }
+		static float Narrow(simd::Float4 v) { return simd::GetX(v); }
+	};
+#else
+	template <typename V>
+	struct Lanes
+	{
+		typedef V Type;
+
+		static V Widen(V v) { return v; }
+		static V Narrow(V v) { return v; }
+	};
+
+	inline uint32_t AsBits(float v)
+	{
+		uint32_t bits;
+		memcpy(&bits, &v, sizeof(bits));
+		return bits;
+	}
+
+	inline float FromBits(uint32_t bits)
+	{
+		float v;
+		memcpy(&v, &bits, sizeof(v));
+		return v;
+	}
+
+	//Scalar lanes, masks are plain bools like the one lane builds of the batch kernels
+	template <>
+	inline float Set<float>(float s) { return s; }
+
+	inline float Add(float a, float b) { return a + b; }
+	inline float Sub(float a, float b) { return a - b; }
+	inline float Mul(float a, float b) { return a * b; }
+	inline float MulAdd(float a, float b, float c) { return a * b + c; }
+	inline float Div(float a, float b) { return a / b; }
+	inline float Sqrt(float v) { return std::sqrt(v); }
+	inline float Min(float a, float b) { return a < b ? a : b; }
+	inline float Max(float a, float b) { return a > b ? a : b; }
+	inline float Abs(float v) { return std::fabs(v); }
+	inline bool Less(float a, float b) { return a < b; }
+	inline float Select(bool mask, float a, float b) { return mask ? a : b; }
+
+	//Nearest integer, ties to even, for |v| < 2^22. Adding 1.5 * 2^23 pushes the fraction out of the mantissa
+	inline float Round(float v) { return (v + 12582912.0f) - 12582912.0f; }
+
+	//Whether bit of the integer q is set, q is a whole number
+	inline bool IsBitSet(float q, int32_t bit) { return (static_cast<int32_t>(q) & bit) != 0; }
+
+	//2^q for a whole number q in [-126, 127]
+	inline float Pow2Integer(float q) { return FromBits(static_cast<uint32_t>(static_cast<int32_t>(q) + 127) << 23); }
+
+	//Unbiased exponent of a normal float, mantissa gets the significand in [1, 2)
+	inline float SplitExponent(float v, float& mantissa)
+	{
+		const uint32_t bits = AsBits(v);
+		mantissa = FromBits((bits & 0x007FFFFFu) | 0x3F800000u);
+		return static_cast<float>(static_cast<int32_t>(bits >> 23) - 127);
+	}
+
+	//Moroz et al., magic constant and one modified Newton-Raphson step with a relative error below 6.5e-4
+	inline float RsqrtEstimate(float v)
+	{
+		const float y = FromBits(0x5F1FFFF9u - (AsBits(v) >> 1));
+		return y * 0.703952253f * (2.38924456f - v * y * y);
+	}
+#endif
+
+#if NE_MATH_SSE || NE_MATH_NEON
+	template <>
+	inline simd::Float4 Set<simd::Float4>(float s) { return simd::Set1(s); }
+
+	using simd::Add;
+	using simd::Sub;
+	using simd::Mul;
+	using simd::MulAdd;
+	using simd::Div;
+	using simd::Sqrt;
+	using simd::Min;
+	using simd::Max;
+	using simd::Less;
+	using simd::Select;
+#endif
+
+#if NE_MATH_SSE
+	inline simd::Float4 Abs(simd::Float4 v) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), v); }
+	inline simd::Float4 Round(simd::Float4 v) { return _mm_cvtepi32_ps(_mm_cvtps_epi32(v)); }
+
+	inline simd::Float4 IsBitSet(simd::Float4 q, int32_t bit)
+	{
+		const __m128i mask = _mm_set1_epi32(bit);
+		return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_cvttps_epi32(q), mask), mask));
+	}
+
+	inline simd::Float4 Pow2Integer(simd::Float4 q)
+	{
+		return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(q), _mm_set1_epi32(127)), 23));
+	}
+
+	inline simd::Float4 SplitExponent(simd::Float4 v, simd::Float4& mantissa)
+	{
+		const __m128i bits = _mm_castps_si128(v);
+		mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+		return _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+	}
+
+	//12 bits, relative error below 3.7e-4
+	inline simd::Float4 RsqrtEstimate(simd::Float4 v) { return _mm_rsqrt_ps(v); }
+#elif NE_MATH_NEON
+	inline simd::Float4 Abs(simd::Float4 v) { return vabsq_f32(v); }
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+	inline simd::Float4 Round(simd::Float4 v) { return vrndnq_f32(v); }
+#else
+	inline simd::Float4 Round(simd::Float4 v)
+	{
+		const float32x4_t magic = vdupq_n_f32(12582912.0f);
+		return vsubq_f32(vaddq_f32(v, magic), magic);
+	}
+#endif
+
+	inline simd::Float4 IsBitSet(simd::Float4 q, int32_t bit)
+	{
+		return vreinterpretq_f32_u32(vtstq_s32(vcvtq_s32_f32(q), vdupq_n_s32(bit)));
+	}
+
+	inline simd::Float4 Pow2Integer(simd::Float4 q)
+	{
+		return vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(q), vdupq_n_s32(127)), 23));
+	}
+
+	inline simd::Float4 SplitExponent(simd::Float4 v, simd::Float4& mantissa)
+	{
+		const uint32x4_t bits = vreinterpretq_u32_f32(v);
+		mantissa = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007FFFFF)), vdupq_n_u32(0x3F800000)));
+		return vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+	}
+
+	//The NEON estimate only has 8 bits, one step brings it to about 16
+	inline simd::Float4 RsqrtEstimate(simd::Float4 v)
+	{
+		const float32x4_t r = vrsqrteq_f32(v);
+		return vmulq_f32(vrsqrtsq_f32(vmulq_f32(v, r), r), r);
+	}
+#endif
+
+#if NE_MATH_AVX2
+	template <>
+	inline simd::Float8 Set<simd::Float8>(float s) { return simd::Set8(s); }
+
+	inline simd::Float8 Abs(simd::Float8 v) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v); }
+	inline simd::Float8 Round(simd::Float8 v) { return _mm256_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+	inline simd::Float8 IsBitSet(simd::Float8 q, int32_t bit)
+	{
+		const __m256i mask = _mm256_set1_epi32(bit);
+		return _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(_mm256_cvttps_epi32(q), mask), mask));
+	}
+
+	inline simd::Float8 Pow2Integer(simd::Float8 q)
+	{
+		return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvttps_epi32(q), _mm256_set1_epi32(127)), 23));
+	}
+
+	inline simd::Float8 SplitExponent(simd::Float8 v, simd::Float8& mantissa)
+	{
+		const __m256i bits = _mm256_castps_si256(v);
+		mantissa = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000)));
+		return _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+	}
+
+	inline simd::Float8 RsqrtEstimate(simd::Float8 v) { return _mm256_rsqrt_ps(v); }
+#endif
+
+	template <typename V>
+	inline V Negate(V v) { return Sub(Set<V>(0.0f), v); }
+
+	//c0 + x * (c1 + x * (c2 + ...))
+	template <typename V>
+	inline V Polynomial(V, float c0)
+	{
+		return Set<V>(c0);
+	}
+
+	template <typename V, typename... TCoefficients>
+	inline V Polynomial(V x, float c0, TCoefficients... coefficients)
+	{
+		return MulAdd(Polynomial(x, coefficients...), x, Set<V>(c0));
+	}
+
+	/**
+	 *	Minimax polynomials, fitted with the Remez algorithm for the error of the whole function, not of the polynomial alone
+	 */
+
+	//sin(r) = r + r * z * SinPolynomial(z) with z = r^2 and |r| <= pi/4
+	template <typename V> inline V SinPolynomial(V z, LowTag) { return Polynomial(z, -0.161601096f); }
+	template <typename V> inline V SinPolynomial(V z, MediumTag) { return Polynomial(z, -0.166629404f, 0.00815157127f); }
+	template <typename V> inline V SinPolynomial(V z, HighTag) { return Polynomial(z, -0.166666552f, 0.0083321007f, -0.000195039625f); }
+
+	//cos(r) = 1 + z * CosPolynomial(z)
+	template <typename V> inline V CosPolynomial(V z, LowTag) { return Polynomial(z, -0.499740094f, 0.040397957f); }
+	template <typename V> inline V CosPolynomial(V z, MediumTag) { return Polynomial(z, -0.499998927f, 0.0416556001f, -0.00135858438f); }
+	template <typename V> inline V CosPolynomial(V z, HighTag) { return Polynomial(z, -0.5f, 0.0416666232f, -0.00138866832f, 2.43798804e-05f); }
+
+	//atan(a) = a + a * z * AtanPolynomial(z) with z = a^2 and a in [0, 1]
+	template <typename V> inline V AtanPolynomial(V z, LowTag) { return Polynomial(z, -0.327274561f, 0.156871393f, -0.0441986658f); }
+
+	template <typename V> inline V AtanPolynomial(V z, MediumTag)
+	{
+		return Polynomial(z, -0.333121896f, 0.196228459f, -0.122105882f, 0.0578196459f, -0.0134221809f);
+	}
+
+	template <typename V> inline V AtanPolynomial(V z, HighTag)
+	{
+		return Polynomial(z, -0.333332151f, 0.199947566f, -0.142158657f, 0.106739856f, -0.0754918009f, 0.04297328f, -0.0161140114f, 0.00283406419f);
+	}
+
+	//acos(x) = sqrt(1 - x) * AcosPolynomial(x) for x in [0, 1], the form of Abramowitz and Stegun 4.4.45
+	template <typename V> inline V AcosPolynomial(V x, LowTag) { return Polynomial(x, 1.57079637f, -0.209050044f, 0.0559283644f); }
+
+	template <typename V> inline V AcosPolynomial(V x, MediumTag)
+	{
+		return Polynomial(x, 1.57079637f, -0.214459449f, 0.0866665095f, -0.0394817665f, 0.0107751116f);
+	}
+
+	template <typename V> inline V AcosPolynomial(V x, HighTag)
+	{
+		return Polynomial(x, 1.57079637f, -0.214601219f, 0.0890223756f, -0.0504626073f, 0.0317959487f, -0.0185323954f, 0.00780676771f, -0.00161197002f);
+	}
+
+	//2^f = 1 + f * Exp2Polynomial(f) for f in [-0.5, 0.5]
+	template <typename V> inline V Exp2Polynomial(V f, LowTag) { return Polynomial(f, 0.695766807f, 0.242030516f, 0.0416987501f); }
+	template <typename V> inline V Exp2Polynomial(V f, MediumTag) { return Polynomial(f, 0.69310534f, 0.240221679f, 0.0560057871f, 0.00967603736f); }
+
+	template <typename V> inline V Exp2Polynomial(V f, HighTag)
+	{
+		return Polynomial(f, 0.693147242f, 0.240226507f, 0.0555029735f, 0.00961803086f, 0.00134100008f, 0.000154697322f);
+	}
+
+	//log2(m) = s * Log2Polynomial(z) with s = (m - 1) / (m + 1), z = s^2 and m in [sqrt(1/2), sqrt(2)]
+	template <typename V> inline V Log2Polynomial(V z, LowTag) { return Polynomial(z, 2.88532591f, 0.979128063f); }
+	template <typename V> inline V Log2Polynomial(V z, MediumTag) { return Polynomial(z, 2.88539052f, 0.961588323f, 0.59578073f); }
+	template <typename V> inline V Log2Polynomial(V z, HighTag) { return Polynomial(z, 2.88539004f, 0.961798847f, 0.576714396f, 0.431735873f); }
+
+	template <typename V>
+	inline V ReciprocalSqrt(V x, LowTag)
+	{
+		return RsqrtEstimate(x);
+	}
+
+	//One Newton-Raphson step, y * (1.5 - 0.5 * x * y * y), roughly doubles the bits of the estimate
+	template <typename V>
+	inline V ReciprocalSqrt(V x, MediumTag)
+	{
+		const V y = RsqrtEstimate(x);
+		return Mul(y, MulAdd(Mul(Mul(Set<V>(-0.5f), x), y), y, Set<V>(1.5f)));
+	}
+
+	template <typename V>
+	inline V ReciprocalSqrt(V x, HighTag)
+	{
+		return Div(Set<V>(1.0f), Sqrt(x));
+	}
+
+	template <typename V, typename TPrecision>
+	inline void SinCos(V x, V& s, V& c, TPrecision precision)
+	{
+		//x = q * pi/2 + r, pi/2 is split in three parts so the first products are exact, Cody and Waite
+		const V q = Round(Mul(x, Set<V>(0.636619772f)));
+		const V r = MulAdd(q, Set<V>(-7.54978995e-8f), MulAdd(q, Set<V>(-4.83751297e-4f), MulAdd(q, Set<V>(-1.5703125f), x)));
+		const V z = Mul(r, r);
+
+		const V sinR = MulAdd(Mul(r, z), SinPolynomial(z, precision), r);
+		const V cosR = MulAdd(z, CosPolynomial(z, precision), Set<V>(1.0f));
+
+		//Quadrants 1 and 3 swap sine and cosine, the low bits of q are its quadrant in two's complement as well
+		const auto bSwap = IsBitSet(q, 1);
+		const auto bNegateSin = IsBitSet(q, 2);
+		const auto bNegateCos = IsBitSet(Add(q, Set<V>(1.0f)), 2);
+
+		s = Select(bSwap, cosR, sinR);
+		c = Select(bSwap, sinR, cosR);
+		s = Select(bNegateSin, Negate(s), s);
+		c = Select(bNegateCos, Negate(c), c);
+	}
+
+	template <typename V, typename TPrecision>
+	inline V Atan2(V y, V x, TPrecision precision)
+	{
+		const V zero = Set<V>(0.0f);
+		const V absX = Abs(x);
+		const V absY = Abs(y);
+
+		//atan of the ratio in [0, 1], the other octants are reflections of it
+		const V larger = Max(absX, absY);
+		const V a = Select(Less(zero, larger), Div(Min(absX, absY), larger), zero);
+		const V z = Mul(a, a);
+
+		V angle = MulAdd(Mul(a, z), AtanPolynomial(z, precision), a);
+		angle = Select(Less(absX, absY), Sub(Set<V>(1.57079637f), angle), angle);
+		angle = Select(Less(x, zero), Sub(Set<V>(3.14159274f), angle), angle);
+
+		return Select(Less(y, zero), Negate(angle), angle);
+	}
+
+	template <typename V, typename TPrecision>
+	inline V Acos(V x, TPrecision precision)
+	{
+		const V absX = Min(Abs(x), Set<V>(1.0f));
+		const V angle = Mul(Sqrt(Sub(Set<V>(1.0f), absX)), AcosPolynomial(absX, precision));
+
+		//acos(-x) = pi - acos(x)
+		return Select(Less(x, Set<V>(0.0f)), Sub(Set<V>(3.14159274f), angle), angle);
+	}
+
+	template <typename V, typename TPrecision>
+	inline V Exp2(V x, TPrecision precision)
+	{
+		//2^x = 2^q * 2^f with a whole number q and f in [-0.5, 0.5]
+		x = Min(Max(x, Set<V>(-126.0f)), Set<V>(127.0f));
+
+		const V q = Round(x);
+		const V f = Sub(x, q);
+
+		return Mul(MulAdd(f, Exp2Polynomial(f, precision), Set<V>(1.0f)), Pow2Integer(q));
+	}
+
+	template <typename V, typename TPrecision>
+	inline V Log2(V x, TPrecision precision)
+	{
+		//log2(x) = e + log2(m), with m moved to [sqrt(1/2), sqrt(2)] so the series in s converges quickly on both sides of 1
+		V m;
+		V e = SplitExponent(x, m);
+
+		const auto bHigh = Less(Set<V>(1.41421354f), m);
+		m = Select(bHigh, Mul(m, Set<V>(0.5f)), m);
+		e = Select(bHigh, Add(e, Set<V>(1.0f)), e);
+
+		const V s = Div(Sub(m, Set<V>(1.0f)), Add(m, Set<V>(1.0f)));
+
+		return MulAdd(s, Log2Polynomial(Mul(s, s), precision), e);
+	}
+}
+}
+}
+
+/**
+ *	Fast math definitions
+ */
+
+namespace novus
+{
+namespace fastmath
+{
+	template <FastMathPrecision P, typename V>
+	inline V Rsqrt(V x)
+	{
+		typedef detail::Lanes<V> L;
+		return L::Narrow(detail::ReciprocalSqrt(L::Widen(x), detail::PrecisionTag<P>()));
+	}
+
+	template <FastMathPrecision P, typename V>
+	inline void SinCos(V x, V& s, V& c)
+	{
+		typedef detail::Lanes<V> L;
+		typename L::Type sinX, cosX;
+		detail::SinCos(L::Widen(x), sinX, cosX, detail::PrecisionTag<P>());
+		s = L::Narrow(sinX);
+		c = L::Narrow(cosX);
+	}
+
+	template <FastMathPrecision P, typename V>
+	inline V Sin(V x)
+	{
+		V s, c;
+		SinCos<P>(x, s, c);
+		return s;
+	}
+
+	template <FastMathPrecision P, typename V>
+	inline V Cos(V x)
+	{
+		V s, c;
+		SinCos<P>(x, s, c);
+		return c;
+	}
+
+	template <FastMathPrecision P, typename V>
+	inline V Atan2(V y, V x)
+	{
+		typedef detail::Lanes<V> L;
+		return L::Narrow(detail::Atan2(L::Widen(y), L::Widen(x), detail::PrecisionTag<P>()));
+	}
+
+	template <FastMathPrecision P, typename V>
+	inline V Acos(V x)
+	{
+		typedef detail::Lanes<V> L;
+		return L::Narrow(detail::Acos(L::Widen(x), detail::PrecisionTag<P>()));
+	}
+
+	template <FastMathPrecision P, typename V>
+	inline V Exp2(V x)
+	{
+		typedef detail::Lanes<V> L;
+		return L::Narrow(detail::Exp2(L::Widen(x), detail::PrecisionTag<P>()));
+	}
+
+	template <FastMathPrecision P, typename V>
+	inline V Log2(V x)
+	{
+		typedef detail::Lanes<V> L;
+		return L::Narrow(detail::Log2(L::Widen(x), detail::PrecisionTag<P>()));
+	}
+
+	template <FastMathPrecision P>
+	inline Vector2 Normalize(const Vector2& v)
+	{
+		return v * Rsqrt<P>(LengthSq(v));
+	}
+
+	template <FastMathPrecision P>
+	inline Vector3 Normalize(const Vector3& v)
+	{
+		return v * Rsqrt<P>(LengthSq(v));
+	}
+
+	template <FastMathPrecision P>
+	inline Vector4 Normalize(const Vector4& v)
+	{
+		return v * Rsqrt<P>(LengthSq(v));
+	}
+}
+}
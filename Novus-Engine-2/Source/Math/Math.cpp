@@ -1,13 +1,21 @@
 #include "Math.h"
+#include "Vector2.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include "Matrix3.h"
+#include "Matrix4.h"
+#include "Matrix3x4.h"
+#include "Quaternion.h"
 
 namespace novus
 {
 
-const float Math::Infinity = FLT_MAX;
-const float Math::Pi = 3.1415926535f;
-const float Math::TwoPi = Math::Pi * 2.0f;
-const float Math::PiOver2 = Math::Pi / 2.0f;
-const float Math::PiOver4 = Math::Pi / 4.0f;
+//Definitions for when the constants are bound to references, their values are in the class
+constexpr float Math::Infinity;
+constexpr float Math::Pi;
+constexpr float Math::TwoPi;
+constexpr float Math::PiOver2;
+constexpr float Math::PiOver4;
 
 int Math::MipMapCount(int width)
 {
@@ -51,4 +59,45 @@ int Math::MipMapCount(int width, int height, int depth)
 	return mipmaps;
 }
 
-}//namespace novus
\ No newline at end of file
+namespace
+{
+	//Compile time checks that the math types stay usable in constant expressions
+
+	constexpr Vector2 TestVector2 = Vector2(1.0f, 2.0f) * 2.0f + Vector2(0.5f);
+	static_assert(TestVector2 == Vector2(2.5f, 4.5f), "Vector2 arithmetic is not constexpr");
+	static_assert(Dot(Vector2(1.0f, 2.0f), Vector2(3.0f, 4.0f)) == 11.0f, "Vector2 Dot is not constexpr");
+
+	constexpr Vector3 TestVector3 = Cross(Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+	static_assert(TestVector3 == Vector3(0.0f, 0.0f, 1.0f), "Vector3 Cross is not constexpr");
+	static_assert(LengthSq(-Vector3(1.0f, 2.0f, 2.0f)) == 9.0f, "Vector3 arithmetic is not constexpr");
+	static_assert(Vector3(Vector4(1.0f, 2.0f, 3.0f, 4.0f)) == Vector3(1.0f, 2.0f, 3.0f), "Vector3 conversions are not constexpr");
+
+	constexpr Vector4 TestVector4 = Vector4(Vector3(1.0f, 2.0f, 3.0f), 1.0f) / 2.0f;
+	static_assert(TestVector4.w == 0.5f && Dot(TestVector4, Vector4(2.0f)) == 7.0f, "Vector4 arithmetic is not constexpr");
+
+	constexpr Matrix3 TestMatrix3 = Matrix3::Transpose(Matrix3::Scale(2.0f, 3.0f, 4.0f) * Matrix3::Translate(1.0f, 2.0f));
+	static_assert(TestMatrix3[0] == Vector3(2.0f, 0.0f, 0.0f) && TestMatrix3[2] == Vector3(2.0f, 6.0f, 4.0f), "Matrix3 product is not constexpr");
+	static_assert(Vector3(1.0f, 1.0f, 1.0f) * Matrix3(2.0f) == Vector3(2.0f), "Matrix3 transforms are not constexpr");
+
+	//Float products use the SIMD specializations at run time, the scalar implementations are the constexpr ones
+	constexpr Matrix4 TestMatrix4 = detail::Matrix4MultiplyScalar(Matrix4::Scale(2.0f), Matrix4::Translate(1.0f, 2.0f, 3.0f));
+	static_assert(TestMatrix4[3] == Vector4(1.0f, 2.0f, 3.0f, 1.0f) && TestMatrix4[1] == Vector4(0.0f, 2.0f, 0.0f, 0.0f), "Matrix4 product is not constexpr");
+	static_assert(detail::Matrix4TransformRowScalar(Vector4(1.0f, 1.0f, 1.0f, 1.0f), TestMatrix4) == Vector4(3.0f, 4.0f, 5.0f, 1.0f), "Matrix4 transforms are not constexpr");
+
+	constexpr Matrix4d TestMatrix4d = Matrix4d::Transpose(Matrix4d::Translate(1.0, 2.0, 3.0) * Matrix4d(Matrix3d(2.0)));
+	static_assert(TestMatrix4d[0] == Vector4d(2.0, 0.0, 0.0, 2.0), "Matrix4 double operations are not constexpr");
+
+	constexpr Matrix3x4 TestMatrix3x4 = Matrix3x4(TestMatrix4);
+	static_assert(TestMatrix3x4[1] == Vector4(0.0f, 2.0f, 0.0f, 2.0f), "Matrix3x4 is not constexpr");
+
+	constexpr Quaternion TestQuaternion = Quaternion(0.0f, 0.0f, 1.0f, 0.0f) * Quaternion(0.0f, 0.0f, 1.0f, 0.0f);
+	static_assert(TestQuaternion == Quaternion(0.0f, 0.0f, 0.0f, -1.0f), "Quaternion product is not constexpr");
+	static_assert((-Quaternion(0.0f, 2.0f, 0.0f, 0.0f)).y == -0.5f, "Quaternion inverse is not constexpr");
+
+	constexpr Matrix4 TestQuaternionMatrix = Quaternion::ToMatrix(Quaternion());
+	static_assert(TestQuaternionMatrix[2] == Vector4(0.0f, 0.0f, 1.0f, 0.0f), "Quaternion ToMatrix is not constexpr");
+
+	static_assert(Math::Clamp(Math::DegToRad(180.0f), 0.0f, Math::TwoPi) == Math::Pi, "Math helpers are not constexpr");
+}
+
+}//namespace novus
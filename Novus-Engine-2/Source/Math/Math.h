@@ -1,17 +1,18 @@
 #pragma once
 
 #include <cmath>
-#include <random>
+#include <cfloat>
+#include "Random.h"
 
 namespace novus
 {
 class Math
 {
 public:
-	//0..1
+	//0..1, from the calling thread's generator so it is safe to call from any thread without locking
 	static float RandF()
 	{
-		return (float)(rand()) / (float)RAND_MAX;
+		return GetThreadRandom().NextFloat();
 	}
 
 	//a..b
@@ -21,25 +22,25 @@ public:
 	}
 
 	template<typename T>
-	static T Min(const T& a, const T& b)
+	static constexpr T Min(const T& a, const T& b)
 	{
 		return a < b ? a : b;
 	}
 
 	template<typename T>
-	static T Max(const T& a, const T& b)
+	static constexpr T Max(const T& a, const T& b)
 	{
 		return a > b ? a : b;
 	}
 
 	template<typename T>
-	static T Lerp(const T& a, const T& b, float t)
+	static constexpr T Lerp(const T& a, const T& b, float t)
 	{
 		return a + (b - a)*t;
 	}
 
 	template<typename T>
-	static T Clamp(const T& x, const T& low, const T& high)
+	static constexpr T Clamp(const T& x, const T& low, const T& high)
 	{
 		return x < low ? low : (x > high ? high : x);
 	}
@@ -49,11 +50,11 @@ public:
 	static int MipMapCount(int width, int height, int depth);
 
 
-	static const float Pi;
-	static const float TwoPi;
-	static const float PiOver2;
-	static const float PiOver4;
-	static const float Infinity;
+	static constexpr float Pi = 3.1415926535f;
+	static constexpr float TwoPi = Pi * 2.0f;
+	static constexpr float PiOver2 = Pi / 2.0f;
+	static constexpr float PiOver4 = Pi / 4.0f;
+	static constexpr float Infinity = FLT_MAX;
 
 	static float WrapAngle(float angle)
 	{
@@ -63,18 +64,14 @@ public:
 			return angle;
 	}
 
-	static float DegToRad(float degrees)
+	static constexpr float DegToRad(float degrees)
 	{
-		static const float toRad = Pi / 180.0f;
-
-		return degrees * toRad;
+		return degrees * (Pi / 180.0f);
 	}
 
-	static float RadToDeg(float radians)
+	static constexpr float RadToDeg(float radians)
 	{
-		static const float toDeg = 180.0f / Pi;
-
-		return radians * toDeg;
+		return radians * (180.0f / Pi);
 	}
 };
 }
\ No newline at end of file
@@ -0,0 +1,206 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include "Utility/Platform/PlatformDefines.h"
+
+/**
+ *	Compile time selection of the instruction set used by the float specializations of the math types.
+ *	These are inlined into every caller so they can't dispatch at runtime like the hashing kernels,
+ *	the build's target architecture (/arch or -m flags) decides what is used.
+ *
+ *	NE_MATH_SSE		SSE2, always available on x64
+ *	NE_MATH_FMA		Fused multiply-add when the build targets AVX2 or FMA
+ *	NE_MATH_AVX2	Eight wide Float8 wrappers when the build targets AVX2, for code that works on whole arrays
+ *	NE_MATH_NEON	ARM NEON
+ *
+ *	Define NE_MATH_NO_SIMD to use the scalar templates everywhere.
+ */
+
+#if !defined(NE_MATH_NO_SIMD) && NE_PLATFORM_X86 && (defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define NE_MATH_SSE 1
+#else
+#define NE_MATH_SSE 0
+#endif
+
+#if NE_MATH_SSE && (defined(__FMA__) || defined(__AVX2__))
+#define NE_MATH_FMA 1
+#else
+#define NE_MATH_FMA 0
+#endif
+
+#if NE_MATH_SSE && defined(__AVX2__)
+#define NE_MATH_AVX2 1
+#else
+#define NE_MATH_AVX2 0
+#endif
+
+#if !defined(NE_MATH_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM) || defined(_M_ARM64))
+#define NE_MATH_NEON 1
+#else
+#define NE_MATH_NEON 0
+#endif
+
+#if NE_MATH_SSE
+#include <emmintrin.h>
+#if NE_MATH_FMA || NE_MATH_AVX2
+#include <immintrin.h>
+#endif
+#elif NE_MATH_NEON
+#include <arm_neon.h>
+#endif
+
+namespace novus
+{
+namespace simd
+{
+#if NE_MATH_SSE
+	typedef __m128 Float4;
+
+	inline Float4 Load4(const float* p) { return _mm_loadu_ps(p); }
+	inline void Store4(float* p, Float4 v) { _mm_storeu_ps(p, v); }
+	inline Float4 Set4(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+	inline Float4 Set1(float s) { return _mm_set1_ps(s); }
+	inline float GetX(Float4 v) { return _mm_cvtss_f32(v); }
+
+	/**
+	 *	Non-temporal store that bypasses the cache, for write-combined upload memory that is never read back.
+	 *	p must be 16 byte aligned. Call StreamFence once the stores have to be visible to other threads or the GPU.
+	 */
+	inline void Stream4(float* p, Float4 v) { _mm_stream_ps(p, v); }
+	inline void StreamFence() { _mm_sfence(); }
+	inline Float4 Add(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+	inline Float4 Sub(Float4 a, Float4 b) { return _mm_sub_ps(a, b); }
+	inline Float4 Mul(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+	inline Float4 Div(Float4 a, Float4 b) { return _mm_div_ps(a, b); }
+	inline Float4 Sqrt(Float4 v) { return _mm_sqrt_ps(v); }
+	inline Float4 Min(Float4 a, Float4 b) { return _mm_min_ps(a, b); }
+	inline Float4 Max(Float4 a, Float4 b) { return _mm_max_ps(a, b); }
+
+	//All bits of a lane are set where a < b, for Select
+	inline Float4 Less(Float4 a, Float4 b) { return _mm_cmplt_ps(a, b); }
+
+	//Per lane mask ? a : b
+	inline Float4 Select(Float4 mask, Float4 a, Float4 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+	inline Float4 Or(Float4 a, Float4 b) { return _mm_or_ps(a, b); }
+	inline Float4 Abs(Float4 v) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), v); }
+
+	//Bit i is set where lane i of a mask is set
+	inline int MoveMask(Float4 mask) { return _mm_movemask_ps(mask); }
+
+	//a * b + c
+	inline Float4 MulAdd(Float4 a, Float4 b, Float4 c)
+	{
+#if NE_MATH_FMA
+		return _mm_fmadd_ps(a, b, c);
+#else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+	}
+
+	template <int Lane>
+	inline Float4 Splat(Float4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(Lane, Lane, Lane, Lane)); }
+
+	//Shuffle with the lanes listed in memory order, unlike _MM_SHUFFLE
+#define NE_SIMD_SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps((a), (b), _MM_SHUFFLE((w), (z), (y), (x)))
+#define NE_SIMD_SWIZZLE(v, x, y, z, w) NE_SIMD_SHUFFLE((v), (v), (x), (y), (z), (w))
+
+	inline void Transpose4(Float4& r0, Float4& r1, Float4& r2, Float4& r3)
+	{
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	}
+
+#elif NE_MATH_NEON
+	typedef float32x4_t Float4;
+
+	inline Float4 Load4(const float* p) { return vld1q_f32(p); }
+	inline void Store4(float* p, Float4 v) { vst1q_f32(p, v); }
+	inline Float4 Set4(float x, float y, float z, float w) { const float values[4] = { x, y, z, w }; return vld1q_f32(values); }
+	inline Float4 Set1(float s) { return vdupq_n_f32(s); }
+	inline float GetX(Float4 v) { return vgetq_lane_f32(v, 0); }
+
+	//No non-temporal store hint that compilers expose, regular stores are used
+	inline void Stream4(float* p, Float4 v) { vst1q_f32(p, v); }
+	inline void StreamFence() {}
+	inline Float4 Add(Float4 a, Float4 b) { return vaddq_f32(a, b); }
+	inline Float4 Sub(Float4 a, Float4 b) { return vsubq_f32(a, b); }
+	inline Float4 Mul(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+	inline Float4 Div(Float4 a, Float4 b) { return vdivq_f32(a, b); }
+	inline Float4 Sqrt(Float4 v) { return vsqrtq_f32(v); }
+#else
+	//ARMv7 has no vector divide or square root, the estimates are refined with two Newton-Raphson steps
+	inline Float4 Div(Float4 a, Float4 b)
+	{
+		Float4 r = vrecpeq_f32(b);
+		r = vmulq_f32(vrecpsq_f32(b, r), r);
+		r = vmulq_f32(vrecpsq_f32(b, r), r);
+		return vmulq_f32(a, r);
+	}
+
+	inline Float4 Sqrt(Float4 v)
+	{
+		Float4 r = vrsqrteq_f32(v);
+		r = vmulq_f32(vrsqrtsq_f32(vmulq_f32(v, r), r), r);
+		r = vmulq_f32(vrsqrtsq_f32(vmulq_f32(v, r), r), r);
+
+		//The estimate of 1/sqrt(0) is infinite
+		return vbslq_f32(vceqq_f32(v, vdupq_n_f32(0.0f)), v, vmulq_f32(v, r));
+	}
+#endif
+
+	inline Float4 Min(Float4 a, Float4 b) { return vminq_f32(a, b); }
+	inline Float4 Max(Float4 a, Float4 b) { return vmaxq_f32(a, b); }
+	inline Float4 Less(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+	inline Float4 Select(Float4 mask, Float4 a, Float4 b) { return vbslq_f32(vreinterpretq_u32_f32(mask), a, b); }
+	inline Float4 Or(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+	inline Float4 Abs(Float4 v) { return vabsq_f32(v); }
+	inline Float4 MulAdd(Float4 a, Float4 b, Float4 c) { return vmlaq_f32(c, a, b); }
+
+	inline int MoveMask(Float4 mask)
+	{
+		const uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(mask), 31);
+		return static_cast<int>(vgetq_lane_u32(bits, 0) | (vgetq_lane_u32(bits, 1) << 1) | (vgetq_lane_u32(bits, 2) << 2) | (vgetq_lane_u32(bits, 3) << 3));
+	}
+
+	template <int Lane>
+	inline Float4 Splat(Float4 v) { return vdupq_n_f32(vgetq_lane_f32(v, Lane)); }
+
+	inline void Transpose4(Float4& r0, Float4& r1, Float4& r2, Float4& r3)
+	{
+		const float32x4x2_t t01 = vtrnq_f32(r0, r1);
+		const float32x4x2_t t23 = vtrnq_f32(r2, r3);
+
+		r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+		r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+		r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+		r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+	}
+#endif
+
+#if NE_MATH_AVX2
+	typedef __m256 Float8;
+
+	inline Float8 Load8(const float* p) { return _mm256_loadu_ps(p); }
+	inline void Store8(float* p, Float8 v) { _mm256_storeu_ps(p, v); }
+	inline Float8 Set8(float s) { return _mm256_set1_ps(s); }
+	inline Float8 Add(Float8 a, Float8 b) { return _mm256_add_ps(a, b); }
+	inline Float8 Sub(Float8 a, Float8 b) { return _mm256_sub_ps(a, b); }
+	inline Float8 Mul(Float8 a, Float8 b) { return _mm256_mul_ps(a, b); }
+	inline Float8 Div(Float8 a, Float8 b) { return _mm256_div_ps(a, b); }
+	inline Float8 Sqrt(Float8 v) { return _mm256_sqrt_ps(v); }
+	inline Float8 Min(Float8 a, Float8 b) { return _mm256_min_ps(a, b); }
+	inline Float8 Max(Float8 a, Float8 b) { return _mm256_max_ps(a, b); }
+	inline Float8 Less(Float8 a, Float8 b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+	inline Float8 Select(Float8 mask, Float8 a, Float8 b) { return _mm256_blendv_ps(b, a, mask); }
+	inline Float8 MulAdd(Float8 a, Float8 b, Float8 c) { return _mm256_fmadd_ps(a, b, c); }
+#endif
+}
+}
@@ -32,39 +32,39 @@ namespace novus
 
 	public:
 
-		Matrix3x3_t();
+		constexpr Matrix3x3_t();
 
-		Matrix3x3_t(const Matrix3x3_t<T>& m);
-		explicit Matrix3x3_t(const T& s);
+		constexpr Matrix3x3_t(const Matrix3x3_t<T>& m);
+		constexpr explicit Matrix3x3_t(const T& s);
 
-		Matrix3x3_t(const row_type& v1, const row_type& v2, const row_type& v3);
-		Matrix3x3_t(
+		constexpr Matrix3x3_t(const row_type& v1, const row_type& v2, const row_type& v3);
+		constexpr Matrix3x3_t(
 			const T& x1, const T& y1, const T& z1,
 			const T& x2, const T& y2, const T& z2,
 			const T& x3, const T& y3, const T& z3);
 
 		//Conversion constructors
 		template <typename B>
-		explicit Matrix3x3_t(const Matrix3x3_t<B>& m);
+		constexpr explicit Matrix3x3_t(const Matrix3x3_t<B>& m);
 
 		template <typename V1, typename V2, typename V3>
-		Matrix3x3_t(const Vector3_t<V1>& v1, const Vector3_t<V2>& v2, const Vector3_t<V3>& v3);
+		constexpr Matrix3x3_t(const Vector3_t<V1>& v1, const Vector3_t<V2>& v2, const Vector3_t<V3>& v3);
 
 		template
 			<typename X1, typename Y1, typename Z1,
 			typename X2, typename Y2, typename Z2,
 			typename X3, typename Y3, typename Z3>
-			Matrix3x3_t(
+			constexpr Matrix3x3_t(
 				const X1& x1, const Y1& y1, const Z1& z1,
 				const X2& x2, const Y2& y2, const Z2& z2,
 				const X3& x3, const Y3& y3, const Z3& z3);
 
-		explicit Matrix3x3_t(const Matrix4x4_t<T>& m);
+		constexpr explicit Matrix3x3_t(const Matrix4x4_t<T>& m);
 
-		size_t size() const;
+		constexpr size_t size() const;
 
 		row_type& operator[] (size_t i);
-		const row_type& operator[] (size_t i) const;
+		constexpr const row_type& operator[] (size_t i) const;
 
 		col_type getAxisVector(size_t i) const;
 
@@ -97,64 +97,64 @@ namespace novus
 
 		static Matrix3x3_t<T> Inverse(const Matrix3x3_t<T>& m);
 
-		static Matrix3x3_t<T> Transpose(const Matrix3x3_t<T>& m);
+		static constexpr Matrix3x3_t<T> Transpose(const Matrix3x3_t<T>& m);
 
-		static Matrix3x3_t<T> Scale(const T& scaleX, const T& scaleY, const T& scaleZ);
+		static constexpr Matrix3x3_t<T> Scale(const T& scaleX, const T& scaleY, const T& scaleZ);
 
 		static Matrix3x3_t<T> RotateX(const T& r);
 		static Matrix3x3_t<T> RotateY(const T& r);
 		static Matrix3x3_t<T> RotateZ(const T& r);
 
-		static Matrix3x3_t<T> Translate(const T& x, const T& y);
+		static constexpr Matrix3x3_t<T> Translate(const T& x, const T& y);
 
-		static Matrix3x3_t<T> SkewSymmetric(const Vector3_t<T>& vec);
-		static Matrix3x3_t<T> IntertiaTensorFromCoeffs(T ix, T iy, T iz, T ixy = 0, T ixz = 0, T iyz = 0);
+		static constexpr Matrix3x3_t<T> SkewSymmetric(const Vector3_t<T>& vec);
+		static constexpr Matrix3x3_t<T> IntertiaTensorFromCoeffs(T ix, T iy, T iz, T ixy = 0, T ixz = 0, T iyz = 0);
 		static Matrix3x3_t<T> BoxInertiaTensor(const Vector3_t<T>& halfSizes, T mass);
-		static Matrix3x3_t<T> SphereSolidInertiaTensor(T radius, T mass);
-		static Matrix3x3_t<T> SphereShellInertiaTensor(T radius, T mass);
+		static constexpr Matrix3x3_t<T> SphereSolidInertiaTensor(T radius, T mass);
+		static constexpr Matrix3x3_t<T> SphereShellInertiaTensor(T radius, T mass);
 	};
 
 	template <typename T>
-	Matrix3x3_t<T> operator- (const Matrix3x3_t<T>& m);
+	constexpr Matrix3x3_t<T> operator- (const Matrix3x3_t<T>& m);
 
 	template <typename T>
-	Matrix3x3_t<T> operator+ (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2);
+	constexpr Matrix3x3_t<T> operator+ (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2);
 
 	template <typename T>
-	Matrix3x3_t<T> operator+ (const Matrix3x3_t<T>& m, const T& s);
+	constexpr Matrix3x3_t<T> operator+ (const Matrix3x3_t<T>& m, const T& s);
 
 	template<typename T>
-	Matrix3x3_t<T> operator+ (const T& s, const Matrix3x3_t<T>& m);
+	constexpr Matrix3x3_t<T> operator+ (const T& s, const Matrix3x3_t<T>& m);
 
 	template <typename T>
-	Matrix3x3_t<T> operator- (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2);
+	constexpr Matrix3x3_t<T> operator- (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2);
 
 	template <typename T>
-	Matrix3x3_t<T> operator- (const Matrix3x3_t<T>& m, const T& s);
+	constexpr Matrix3x3_t<T> operator- (const Matrix3x3_t<T>& m, const T& s);
 
 	template<typename T>
-	Matrix3x3_t<T> operator- (const T& s, const Matrix3x3_t<T>& m);
+	constexpr Matrix3x3_t<T> operator- (const T& s, const Matrix3x3_t<T>& m);
 
 	template <typename T>
-	Matrix3x3_t<T> operator* (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2);
+	constexpr Matrix3x3_t<T> operator* (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2);
 
 	template <typename T>
-	Matrix3x3_t<T> operator* (const Matrix3x3_t<T>& m, const T& s);
+	constexpr Matrix3x3_t<T> operator* (const Matrix3x3_t<T>& m, const T& s);
 
 	template<typename T>
-	Matrix3x3_t<T> operator* (const T& s, const Matrix3x3_t<T>& m);
+	constexpr Matrix3x3_t<T> operator* (const T& s, const Matrix3x3_t<T>& m);
 
 	template <typename T>
-	typename Matrix3x3_t<T>::row_type operator* (const Matrix3x3_t<T>& m, const typename Matrix3x3_t<T>::col_type& v);
+	constexpr typename Matrix3x3_t<T>::row_type operator* (const Matrix3x3_t<T>& m, const typename Matrix3x3_t<T>::col_type& v);
 
 	template <typename T>
-	typename Matrix3x3_t<T>::col_type operator* (const typename Matrix3x3_t<T>::row_type& v, const Matrix3x3_t<T>& m);
+	constexpr typename Matrix3x3_t<T>::col_type operator* (const typename Matrix3x3_t<T>::row_type& v, const Matrix3x3_t<T>& m);
 
 	template <typename T>
-	bool operator== (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2);
+	constexpr bool operator== (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2);
 
 	template <typename T>
-	bool operator!= (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2);
+	constexpr bool operator!= (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2);
 }
 
 /**
@@ -164,92 +164,68 @@ namespace novus
 namespace novus
 {
 	template <typename T>
-	Matrix3x3_t<T>::Matrix3x3_t()
-	{
-		this->value[0] = row_type(1, 0, 0);
-		this->value[1] = row_type(0, 1, 0);
-		this->value[2] = row_type(0, 0, 1);
-	}
+	constexpr Matrix3x3_t<T>::Matrix3x3_t()
+		: value{ row_type(1, 0, 0), row_type(0, 1, 0), row_type(0, 0, 1) }
+	{}
 
 	template <typename T>
-	Matrix3x3_t<T>::Matrix3x3_t(const Matrix3x3_t<T>& m)
-	{
-		this->value[0] = m.value[0];
-		this->value[1] = m.value[1];
-		this->value[2] = m.value[2];
-	}
+	constexpr Matrix3x3_t<T>::Matrix3x3_t(const Matrix3x3_t<T>& m)
+		: value{ m.value[0], m.value[1], m.value[2] }
+	{}
 
 	template <typename T>
-	Matrix3x3_t<T>::Matrix3x3_t(const T& s)
-	{
-		this->value[0] = row_type(s, 0, 0);
-		this->value[1] = row_type(0, s, 0);
-		this->value[2] = row_type(0, 0, s);
-	}
+	constexpr Matrix3x3_t<T>::Matrix3x3_t(const T& s)
+		: value{ row_type(s, 0, 0), row_type(0, s, 0), row_type(0, 0, s) }
+	{}
 
 	template <typename T>
-	Matrix3x3_t<T>::Matrix3x3_t(const row_type& v1, const row_type& v2, const row_type& v3)
-	{
-		this->value[0] = v1;
-		this->value[1] = v2;
-		this->value[2] = v3;
-	}
+	constexpr Matrix3x3_t<T>::Matrix3x3_t(const row_type& v1, const row_type& v2, const row_type& v3)
+		: value{ v1, v2, v3 }
+	{}
 
 	template <typename T>
-	Matrix3x3_t<T>::Matrix3x3_t(
+	constexpr Matrix3x3_t<T>::Matrix3x3_t(
 		const T& x1, const T& y1, const T& z1,
 		const T& x2, const T& y2, const T& z2,
 		const T& x3, const T& y3, const T& z3)
-	{
-		this->value[0] = row_type(x1, y1, z1);
-		this->value[1] = row_type(x2, y2, z2);
-		this->value[2] = row_type(x3, y3, z3);
-	}
+		: value{ row_type(x1, y1, z1), row_type(x2, y2, z2), row_type(x3, y3, z3) }
+	{}
 
 	//Conversion constructors
 	template <typename T>
 	template <typename B>
-	Matrix3x3_t<T>::Matrix3x3_t(const Matrix3x3_t<B>& m)
-	{
-		this->value[0] = row_type(m[0]);
-		this->value[1] = row_type(m[1]);
-		this->value[2] = row_type(m[2]);
-	}
+	constexpr Matrix3x3_t<T>::Matrix3x3_t(const Matrix3x3_t<B>& m)
+		: value{ row_type(m[0]), row_type(m[1]), row_type(m[2]) }
+	{}
 
 	template <typename T>
 	template <typename V1, typename V2, typename V3>
-	Matrix3x3_t<T>::Matrix3x3_t(const Vector3_t<V1>& v1, const Vector3_t<V2>& v2, const Vector3_t<V3>& v3)
-	{
-		this->value[0] = row_type(v1);
-		this->value[1] = row_type(v2);
-		this->value[2] = row_type(v3);
-	}
+	constexpr Matrix3x3_t<T>::Matrix3x3_t(const Vector3_t<V1>& v1, const Vector3_t<V2>& v2, const Vector3_t<V3>& v3)
+		: value{ row_type(v1), row_type(v2), row_type(v3) }
+	{}
 
 	template <typename T>
 	template
 		<typename X1, typename Y1, typename Z1,
 		typename X2, typename Y2, typename Z2,
 		typename X3, typename Y3, typename Z3>
-		Matrix3x3_t<T>::Matrix3x3_t(
+		constexpr Matrix3x3_t<T>::Matrix3x3_t(
 			const X1& x1, const Y1& y1, const Z1& z1,
 			const X2& x2, const Y2& y2, const Z2& z2,
 			const X3& x3, const Y3& y3, const Z3& z3)
-	{
-		this->value[0] = row_type(static_cast<T>(x1), value_type(y1), value_type(z1));
-		this->value[1] = row_type(static_cast<T>(x2), value_type(y2), value_type(z2));
-		this->value[2] = row_type(static_cast<T>(x3), value_type(y3), value_type(z3));
-	}
+		: value{
+			row_type(static_cast<T>(x1), value_type(y1), value_type(z1)),
+			row_type(static_cast<T>(x2), value_type(y2), value_type(z2)),
+			row_type(static_cast<T>(x3), value_type(y3), value_type(z3)) }
+	{}
 
 	template <typename T>
-	Matrix3x3_t<T>::Matrix3x3_t(const Matrix4x4_t<T>& m)
-	{
-		this->value[0] = row_type(m[0]);
-		this->value[1] = row_type(m[1]);
-		this->value[2] = row_type(m[2]);
-	}
+	constexpr Matrix3x3_t<T>::Matrix3x3_t(const Matrix4x4_t<T>& m)
+		: value{ row_type(m[0]), row_type(m[1]), row_type(m[2]) }
+	{}
 
 	template <typename T>
-	size_t Matrix3x3_t<T>::size() const
+	constexpr size_t Matrix3x3_t<T>::size() const
 	{
 		return 3;
 	}
@@ -263,11 +239,9 @@ namespace novus
 	}
 
 	template <typename T>
-	const typename Matrix3x3_t<T>::row_type& Matrix3x3_t<T>::operator[] (size_t i) const
+	constexpr const typename Matrix3x3_t<T>::row_type& Matrix3x3_t<T>::operator[] (size_t i) const
 	{
-		assert(i < this->size());
-
-		return this->value[i];
+		return assert(i < this->size()), this->value[i];
 	}
 
 	template <typename T>
@@ -363,7 +337,7 @@ namespace novus
 	}
 
 	template <typename T>
-	Matrix3x3_t<T> operator- (const Matrix3x3_t<T>& m)
+	constexpr Matrix3x3_t<T> operator- (const Matrix3x3_t<T>& m)
 	{
 		return Matrix3x3_t<T>(
 			-m[0],
@@ -372,7 +346,7 @@ namespace novus
 	}
 
 	template <typename T>
-	Matrix3x3_t<T> operator+ (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2)
+	constexpr Matrix3x3_t<T> operator+ (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2)
 	{
 		return Matrix3x3_t<T>(
 			m1[0] + m2[0],
@@ -381,7 +355,7 @@ namespace novus
 	}
 
 	template <typename T>
-	Matrix3x3_t<T> operator+ (const Matrix3x3_t<T>& m, const T& s)
+	constexpr Matrix3x3_t<T> operator+ (const Matrix3x3_t<T>& m, const T& s)
 	{
 		return Matrix3x3_t<T>(
 			m[0] + s,
@@ -390,7 +364,7 @@ namespace novus
 	}
 
 	template<typename T>
-	Matrix3x3_t<T> operator+ (const T& s, const Matrix3x3_t<T>& m)
+	constexpr Matrix3x3_t<T> operator+ (const T& s, const Matrix3x3_t<T>& m)
 	{
 		return Matrix3x3_t<T>(
 			m[0] + s,
@@ -399,7 +373,7 @@ namespace novus
 	}
 
 	template <typename T>
-	Matrix3x3_t<T> operator- (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2)
+	constexpr Matrix3x3_t<T> operator- (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2)
 	{
 		return Matrix3x3_t<T>(
 			m1[0] - m2[0],
@@ -408,7 +382,7 @@ namespace novus
 	}
 
 	template <typename T>
-	Matrix3x3_t<T> operator- (const Matrix3x3_t<T>& m, const T& s)
+	constexpr Matrix3x3_t<T> operator- (const Matrix3x3_t<T>& m, const T& s)
 	{
 		return Matrix3x3_t<T>(
 			m[0] - s,
@@ -417,7 +391,7 @@ namespace novus
 	}
 
 	template<typename T>
-	Matrix3x3_t<T> operator- (const T& s, const Matrix3x3_t<T>& m)
+	constexpr Matrix3x3_t<T> operator- (const T& s, const Matrix3x3_t<T>& m)
 	{
 		return Matrix3x3_t<T>(
 			s - m[0],
@@ -426,47 +400,12 @@ namespace novus
 	}
 
 	template <typename T>
-	Matrix3x3_t<T> operator* (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2)
+	constexpr Matrix3x3_t<T> operator* (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2)
 	{
-		T const srcA00 = m1[0][0];
-		T const srcA01 = m1[0][1];
-		T const srcA02 = m1[0][2];
-		T const srcA10 = m1[1][0];
-		T const srcA11 = m1[1][1];
-		T const srcA12 = m1[1][2];
-		T const srcA20 = m1[2][0];
-		T const srcA21 = m1[2][1];
-		T const srcA22 = m1[2][2];
-
-		T const srcB00 = m2[0][0];
-		T const srcB01 = m2[0][1];
-		T const srcB02 = m2[0][2];
-		T const srcB10 = m2[1][0];
-		T const srcB11 = m2[1][1];
-		T const srcB12 = m2[1][2];
-		T const srcB20 = m2[2][0];
-		T const srcB21 = m2[2][1];
-		T const srcB22 = m2[2][2];
-
-		Matrix3x3_t<T> result;
-
-		result[0][0] = srcA00 * srcB00 + srcA01 * srcB10 + srcA02 * srcB20;
-		result[0][1] = srcA00 * srcB01 + srcA01 * srcB11 + srcA02 * srcB21;
-		result[0][2] = srcA00 * srcB02 + srcA01 * srcB12 + srcA02 * srcB22;
-
-		result[1][0] = srcA10 * srcB00 + srcA11 * srcB10 + srcA12 * srcB20;
-		result[1][1] = srcA10 * srcB01 + srcA11 * srcB11 + srcA12 * srcB21;
-		result[1][2] = srcA10 * srcB02 + srcA11 * srcB12 + srcA12 * srcB22;
-
-		result[2][0] = srcA20 * srcB00 + srcA21 * srcB10 + srcA22 * srcB20;
-		result[2][1] = srcA20 * srcB01 + srcA21 * srcB11 + srcA22 * srcB21;
-		result[2][2] = srcA20 * srcB02 + srcA21 * srcB12 + srcA22 * srcB22;
-
-		return result;
+		return Matrix3x3_t<T>(m1[0] * m2, m1[1] * m2, m1[2] * m2);
 	}
-
 	template <typename T>
-	Matrix3x3_t<T> operator* (const Matrix3x3_t<T>& m, const T& s)
+	constexpr Matrix3x3_t<T> operator* (const Matrix3x3_t<T>& m, const T& s)
 	{
 		return Matrix3x3_t<T>(
 			m[0] * s,
@@ -475,7 +414,7 @@ namespace novus
 	}
 
 	template<typename T>
-	Matrix3x3_t<T> operator* (const T& s, const Matrix3x3_t<T>& m)
+	constexpr Matrix3x3_t<T> operator* (const T& s, const Matrix3x3_t<T>& m)
 	{
 		return Matrix3x3_t<T>(
 			m[0] * s,
@@ -484,31 +423,25 @@ namespace novus
 	}
 
 	template <typename T>
-	typename Matrix3x3_t<T>::row_type operator* (const Matrix3x3_t<T>& m, const typename Matrix3x3_t<T>::col_type& v)
+	constexpr typename Matrix3x3_t<T>::row_type operator* (const Matrix3x3_t<T>& m, const typename Matrix3x3_t<T>::col_type& v)
 	{
-		return Matrix3x3_t<T>::row_type(
-			m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z,
-			m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
-			m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z);
+		return typename Matrix3x3_t<T>::row_type(Dot(m[0], v), Dot(m[1], v), Dot(m[2], v));
 	}
 
 	template <typename T>
-	typename Matrix3x3_t<T>::col_type operator* (const typename Matrix3x3_t<T>::row_type& v, const Matrix3x3_t<T>& m)
+	constexpr typename Matrix3x3_t<T>::col_type operator* (const typename Matrix3x3_t<T>::row_type& v, const Matrix3x3_t<T>& m)
 	{
-		return Matrix3x3_t<T>::col_type(
-			v.x * m[0][0] + v.y * m[1][0] + v.z * m[2][0],
-			v.x * m[0][1] + v.y * m[1][1] + v.z * m[2][1],
-			v.x * m[0][2] + v.y * m[1][2] + v.z * m[2][2]);
+		return v.x * m[0] + v.y * m[1] + v.z * m[2];
 	}
 
 	template <typename T>
-	bool operator== (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2)
+	constexpr bool operator== (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2)
 	{
 		return (m1[0] == m2[0] && m1[1] == m2[1] && m1[2] == m2[2]);
 	}
 
 	template <typename T>
-	bool operator!= (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2)
+	constexpr bool operator!= (const Matrix3x3_t<T>& m1, const Matrix3x3_t<T>& m2)
 	{
 		return (m1[0] != m2[0] || m1[1] != m2[1] || m1[2] != m2[2]);
 	}
@@ -537,16 +470,16 @@ namespace novus
 	}
 
 	template <typename T>
-	Matrix3x3_t<T> Matrix3x3_t<T>::Transpose(const Matrix3x3_t<T>& m)
+	constexpr Matrix3x3_t<T> Matrix3x3_t<T>::Transpose(const Matrix3x3_t<T>& m)
 	{
 		return Matrix3x3_t<T>(
-			m[0][0], m[1][0], m[2][0],
-			m[0][1], m[1][1], m[2][1],
-			m[0][2], m[1][2], m[2][2]);
+			m[0].x, m[1].x, m[2].x,
+			m[0].y, m[1].y, m[2].y,
+			m[0].z, m[1].z, m[2].z);
 	}
 
 	template <class T>
-	Matrix3x3_t<T> Matrix3x3_t<T>::Scale(const T& scaleX, const T& scaleY, const T& scaleZ)
+	constexpr Matrix3x3_t<T> Matrix3x3_t<T>::Scale(const T& scaleX, const T& scaleY, const T& scaleZ)
 	{
 		return Matrix3x3_t<T>(
 			scaleX, 0, 0,
@@ -582,7 +515,7 @@ namespace novus
 	}
 
 	template <class T>
-	Matrix3x3_t<T> Matrix3x3_t<T>::Translate(const T& x, const T& y)
+	constexpr Matrix3x3_t<T> Matrix3x3_t<T>::Translate(const T& x, const T& y)
 	{
 		return Matrix3x3_t<T>(
 			1, 0, x,
@@ -591,7 +524,7 @@ namespace novus
 	}
 
 	template <class T>
-	Matrix3x3_t<T> Matrix3x3_t<T>::SkewSymmetric(const Vector3_t<T>& vec)
+	constexpr Matrix3x3_t<T> Matrix3x3_t<T>::SkewSymmetric(const Vector3_t<T>& vec)
 	{
 		return Matrix3x3_t<T>(0.0f, -vec.z, vec.y,
 			vec.z, 0.0f, -vec.x,
@@ -599,7 +532,7 @@ namespace novus
 	}
 
 	template <class T>
-	Matrix3x3_t<T> Matrix3x3_t<T>::IntertiaTensorFromCoeffs(T ix, T iy, T iz, T ixy, T ixz, T iyz)
+	constexpr Matrix3x3_t<T> Matrix3x3_t<T>::IntertiaTensorFromCoeffs(T ix, T iy, T iz, T ixy, T ixz, T iyz)
 	{
 		return Matrix3x3_t<T>(ix, -ixy, -ixz,
 			-ixy, iy, -iyz,
@@ -617,7 +550,7 @@ namespace novus
 	}
 
 	template <class T>
-	Matrix3x3_t<T> Matrix3x3_t<T>::SphereSolidInertiaTensor(T radius, T mass)
+	constexpr Matrix3x3_t<T> Matrix3x3_t<T>::SphereSolidInertiaTensor(T radius, T mass)
 	{
 		return IntertiaTensorFromCoeffs((static_cast<T>(2.0) / static_cast<T>(5.0)) * mass * radius * radius,
 			(static_cast<T>(2.0) / static_cast<T>(5.0)) * mass * radius * radius,
@@ -625,7 +558,7 @@ namespace novus
 	}
 
 	template <class T>
-	Matrix3x3_t<T> Matrix3x3_t<T>::SphereShellInertiaTensor(T radius, T mass)
+	constexpr Matrix3x3_t<T> Matrix3x3_t<T>::SphereShellInertiaTensor(T radius, T mass)
 	{
 		return IntertiaTensorFromCoeffs((static_cast<T>(2.0) / static_cast<T>(3.0)) * mass * radius * radius,
 			(static_cast<T>(2.0) / static_cast<T>(3.0)) * mass * radius * radius,
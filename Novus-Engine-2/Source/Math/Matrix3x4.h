@@ -0,0 +1,237 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include "Vector3.h"
+#include "Vector4.h"
+#include "Matrix4.h"
+
+/**
+ *	Affine transform stored as three rows of four, without the constant (0, 0, 0, 1) column of the equivalent Matrix4.
+ *
+ *	Row i holds column i of the Matrix4, so the three rows are the dot products that produce x, y and z of a transformed point.
+ *	This is the layout of a row_major float3x4 in HLSL, used as mul(m, float4(p, 1)), and takes three constant registers instead of four.
+ *
+ *	Products compose in the same order as Matrix4, Matrix3x4(a * b) == Matrix3x4(a) * Matrix3x4(b).
+ */
+
+namespace novus
+{
+	template <typename T> struct Matrix3x4_t;
+
+	typedef Matrix3x4_t<float> Matrix3x4;
+	typedef Matrix3x4_t<double> Matrix3x4d;
+
+	template <typename T>
+	struct Matrix3x4_t
+	{
+		typedef Vector4_t<T> row_type;
+
+		typedef T value_type;
+
+	private:
+		row_type value[3];
+
+	public:
+
+		constexpr Matrix3x4_t();
+
+		constexpr Matrix3x4_t(const row_type& v1, const row_type& v2, const row_type& v3);
+
+		/**
+		 *	Drops the last column of an affine Matrix4
+		 */
+		constexpr explicit Matrix3x4_t(const Matrix4x4_t<T>& m);
+
+		constexpr size_t size() const;
+
+		row_type& operator[] (size_t i);
+		constexpr const row_type& operator[] (size_t i) const;
+
+		Matrix4x4_t<T> ToMatrix4() const;
+
+		Vector3_t<T> TransformPoint(const Vector3_t<T>& p) const;
+
+		//Ignores the translation
+		Vector3_t<T> TransformVector(const Vector3_t<T>& v) const;
+
+		Vector3_t<T> GetTranslation() const;
+
+		static Matrix3x4_t<T> Inverse(const Matrix3x4_t<T>& m);
+	};
+
+	template <typename T>
+	Matrix3x4_t<T> operator* (const Matrix3x4_t<T>& m1, const Matrix3x4_t<T>& m2);
+
+	template <typename T>
+	constexpr bool operator== (const Matrix3x4_t<T>& m1, const Matrix3x4_t<T>& m2);
+
+	template <typename T>
+	constexpr bool operator!= (const Matrix3x4_t<T>& m1, const Matrix3x4_t<T>& m2);
+}
+
+/**
+ *	Matrix3x4 class definition
+ */
+
+namespace novus
+{
+	template <typename T>
+	constexpr Matrix3x4_t<T>::Matrix3x4_t()
+		: value{ row_type(1, 0, 0, 0), row_type(0, 1, 0, 0), row_type(0, 0, 1, 0) }
+	{}
+
+	template <typename T>
+	constexpr Matrix3x4_t<T>::Matrix3x4_t(const row_type& v1, const row_type& v2, const row_type& v3)
+		: value{ v1, v2, v3 }
+	{}
+
+	template <typename T>
+	constexpr Matrix3x4_t<T>::Matrix3x4_t(const Matrix4x4_t<T>& m)
+		: value{ row_type(m[0].x, m[1].x, m[2].x, m[3].x), row_type(m[0].y, m[1].y, m[2].y, m[3].y), row_type(m[0].z, m[1].z, m[2].z, m[3].z) }
+	{}
+
+	template <typename T>
+	constexpr size_t Matrix3x4_t<T>::size() const
+	{
+		return 3;
+	}
+
+	template <typename T>
+	typename Matrix3x4_t<T>::row_type& Matrix3x4_t<T>::operator[] (size_t i)
+	{
+		assert(i < this->size());
+
+		return this->value[i];
+	}
+
+	template <typename T>
+	constexpr const typename Matrix3x4_t<T>::row_type& Matrix3x4_t<T>::operator[] (size_t i) const
+	{
+		return assert(i < this->size()), this->value[i];
+	}
+
+	template <typename T>
+	Matrix4x4_t<T> Matrix3x4_t<T>::ToMatrix4() const
+	{
+		const Matrix3x4_t<T>& m = *this;
+
+		return Matrix4x4_t<T>(
+			m[0][0], m[1][0], m[2][0], 0,
+			m[0][1], m[1][1], m[2][1], 0,
+			m[0][2], m[1][2], m[2][2], 0,
+			m[0][3], m[1][3], m[2][3], 1);
+	}
+
+	template <typename T>
+	Vector3_t<T> Matrix3x4_t<T>::TransformPoint(const Vector3_t<T>& p) const
+	{
+		const Matrix3x4_t<T>& m = *this;
+
+		return Vector3_t<T>(
+			m[0][0] * p.x + m[0][1] * p.y + m[0][2] * p.z + m[0][3],
+			m[1][0] * p.x + m[1][1] * p.y + m[1][2] * p.z + m[1][3],
+			m[2][0] * p.x + m[2][1] * p.y + m[2][2] * p.z + m[2][3]);
+	}
+
+	template <typename T>
+	Vector3_t<T> Matrix3x4_t<T>::TransformVector(const Vector3_t<T>& v) const
+	{
+		const Matrix3x4_t<T>& m = *this;
+
+		return Vector3_t<T>(
+			m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z,
+			m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
+			m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z);
+	}
+
+	template <typename T>
+	Vector3_t<T> Matrix3x4_t<T>::GetTranslation() const
+	{
+		return Vector3_t<T>(this->value[0][3], this->value[1][3], this->value[2][3]);
+	}
+
+	template <typename T>
+	Matrix3x4_t<T> Matrix3x4_t<T>::Inverse(const Matrix3x4_t<T>& m)
+	{
+		//Columns of the 3x3 part are the rows of the equivalent Matrix4, their cross products are the columns of the transposed cofactor matrix
+		const Vector3_t<T> a0(m[0][0], m[1][0], m[2][0]);
+		const Vector3_t<T> a1(m[0][1], m[1][1], m[2][1]);
+		const Vector3_t<T> a2(m[0][2], m[1][2], m[2][2]);
+
+		const Vector3_t<T> c0 = Cross(a1, a2);
+		const T OneOverDeterminant = static_cast<T>(1) / Dot(a0, c0);
+
+		const Vector3_t<T> i0 = c0 * OneOverDeterminant;
+		const Vector3_t<T> i1 = Cross(a2, a0) * OneOverDeterminant;
+		const Vector3_t<T> i2 = Cross(a0, a1) * OneOverDeterminant;
+
+		const Vector3_t<T> t = m.GetTranslation();
+
+		return Matrix3x4_t<T>(
+			row_type(i0, -Dot(i0, t)),
+			row_type(i1, -Dot(i1, t)),
+			row_type(i2, -Dot(i2, t)));
+	}
+
+	template <typename T>
+	Matrix3x4_t<T> operator* (const Matrix3x4_t<T>& m1, const Matrix3x4_t<T>& m2)
+	{
+		//m1 is applied first, so each row is a row of m2 transforming the columns of m1. The implied last row of m1 only adds m2's translation
+		Matrix3x4_t<T> result;
+
+		for (size_t i = 0; i < 3; i++)
+		{
+			const Vector4_t<T>& r = m2[i];
+
+			result[i] = Vector4_t<T>(
+				r.x * m1[0][0] + r.y * m1[1][0] + r.z * m1[2][0],
+				r.x * m1[0][1] + r.y * m1[1][1] + r.z * m1[2][1],
+				r.x * m1[0][2] + r.y * m1[1][2] + r.z * m1[2][2],
+				r.x * m1[0][3] + r.y * m1[1][3] + r.z * m1[2][3] + r.w);
+		}
+
+		return result;
+	}
+
+	template <typename T>
+	constexpr bool operator== (const Matrix3x4_t<T>& m1, const Matrix3x4_t<T>& m2)
+	{
+		return (m1[0] == m2[0] && m1[1] == m2[1] && m1[2] == m2[2]);
+	}
+
+	template <typename T>
+	constexpr bool operator!= (const Matrix3x4_t<T>& m1, const Matrix3x4_t<T>& m2)
+	{
+		return (m1[0] != m2[0] || m1[1] != m2[1] || m1[2] != m2[2]);
+	}
+}
+
+#if NE_MATH_SSE || NE_MATH_NEON
+
+namespace novus
+{
+	template <>
+	inline Matrix3x4_t<float> operator*<float> (const Matrix3x4_t<float>& m1, const Matrix3x4_t<float>& m2)
+	{
+		const simd::Float4 a0 = simd::Load4(&m1[0].x);
+		const simd::Float4 a1 = simd::Load4(&m1[1].x);
+		const simd::Float4 a2 = simd::Load4(&m1[2].x);
+		const simd::Float4 a3 = simd::Set4(0.0f, 0.0f, 0.0f, 1.0f);
+
+		Matrix3x4_t<float> result;
+
+		simd::Store4(&result[0].x, detail::Matrix4TransformRow(simd::Load4(&m2[0].x), a0, a1, a2, a3));
+		simd::Store4(&result[1].x, detail::Matrix4TransformRow(simd::Load4(&m2[1].x), a0, a1, a2, a3));
+		simd::Store4(&result[2].x, detail::Matrix4TransformRow(simd::Load4(&m2[2].x), a0, a1, a2, a3));
+
+		return result;
+	}
+}
+
+#endif
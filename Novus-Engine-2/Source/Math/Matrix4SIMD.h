@@ -0,0 +1,327 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+/**
+ *	SIMD specializations of the Matrix4 operations for float, included at the end of Matrix4.h.
+ *	The scalar versions stay available as detail::Matrix4*Scalar.
+ *	Results can differ from the scalar versions in the last bits since operations are reordered (and fused with NE_MATH_FMA).
+ *	Relative to the largest element of the result, the benchmark's --verify allows 1e-6 for products, RigidInverse and InverseTranspose3x3,
+ *	2e-6 for Inverse and AffineInverse of affine matrices, 1e-5 for Matrix4 * Vector4, and 5e-4 for Inverse of projections with a near plane of 0.1.
+ */
+
+#include "MathSIMD.h"
+
+#if NE_MATH_SSE || NE_MATH_NEON
+
+namespace novus
+{
+	namespace detail
+	{
+		inline const float* Matrix4Data(const Matrix4x4_t<float>& m) { return &m[0].x; }
+		inline float* Matrix4Data(Matrix4x4_t<float>& m) { return &m[0].x; }
+
+		//Row of the product of a row with a matrix
+		inline simd::Float4 Matrix4TransformRow(simd::Float4 row, simd::Float4 b0, simd::Float4 b1, simd::Float4 b2, simd::Float4 b3)
+		{
+			simd::Float4 result = simd::Mul(simd::Splat<0>(row), b0);
+			result = simd::MulAdd(simd::Splat<1>(row), b1, result);
+			result = simd::MulAdd(simd::Splat<2>(row), b2, result);
+			return simd::MulAdd(simd::Splat<3>(row), b3, result);
+		}
+	}
+
+	template <>
+	inline Matrix4x4_t<float> operator*<float> (const Matrix4x4_t<float>& m1, const Matrix4x4_t<float>& m2)
+	{
+		const float* a = detail::Matrix4Data(m1);
+		const float* b = detail::Matrix4Data(m2);
+
+		const simd::Float4 b0 = simd::Load4(b);
+		const simd::Float4 b1 = simd::Load4(b + 4);
+		const simd::Float4 b2 = simd::Load4(b + 8);
+		const simd::Float4 b3 = simd::Load4(b + 12);
+
+		Matrix4x4_t<float> result;
+		float* r = detail::Matrix4Data(result);
+
+		simd::Store4(r, detail::Matrix4TransformRow(simd::Load4(a), b0, b1, b2, b3));
+		simd::Store4(r + 4, detail::Matrix4TransformRow(simd::Load4(a + 4), b0, b1, b2, b3));
+		simd::Store4(r + 8, detail::Matrix4TransformRow(simd::Load4(a + 8), b0, b1, b2, b3));
+		simd::Store4(r + 12, detail::Matrix4TransformRow(simd::Load4(a + 12), b0, b1, b2, b3));
+
+		return result;
+	}
+
+	template <>
+	inline Matrix4x4_t<float>::row_type operator*<float> (const Matrix4x4_t<float>& m, const Matrix4x4_t<float>::col_type& v)
+	{
+		const float* a = detail::Matrix4Data(m);
+		const simd::Float4 vec = simd::Load4(&v.x);
+
+		simd::Float4 r0 = simd::Mul(simd::Load4(a), vec);
+		simd::Float4 r1 = simd::Mul(simd::Load4(a + 4), vec);
+		simd::Float4 r2 = simd::Mul(simd::Load4(a + 8), vec);
+		simd::Float4 r3 = simd::Mul(simd::Load4(a + 12), vec);
+
+#if NE_MATH_SSE
+		//Horizontal sums of the four products without SSE3
+		const simd::Float4 s01 = _mm_add_ps(_mm_unpacklo_ps(r0, r1), _mm_unpackhi_ps(r0, r1));
+		const simd::Float4 s23 = _mm_add_ps(_mm_unpacklo_ps(r2, r3), _mm_unpackhi_ps(r2, r3));
+		const simd::Float4 sum = _mm_add_ps(_mm_movelh_ps(s01, s23), _mm_movehl_ps(s23, s01));
+#else
+		simd::Transpose4(r0, r1, r2, r3);
+		const simd::Float4 sum = simd::Add(simd::Add(r0, r1), simd::Add(r2, r3));
+#endif
+
+		Vector4_t<float> result;
+		simd::Store4(&result.x, sum);
+
+		return result;
+	}
+
+	template <>
+	inline Matrix4x4_t<float>::col_type operator*<float> (const Matrix4x4_t<float>::row_type& v, const Matrix4x4_t<float>& m)
+	{
+		const float* b = detail::Matrix4Data(m);
+
+		Vector4_t<float> result;
+		simd::Store4(&result.x, detail::Matrix4TransformRow(simd::Load4(&v.x), simd::Load4(b), simd::Load4(b + 4), simd::Load4(b + 8), simd::Load4(b + 12)));
+
+		return result;
+	}
+
+	template <>
+	inline Matrix4x4_t<float> Matrix4x4_t<float>::Transpose(const Matrix4x4_t<float>& m)
+	{
+		const float* a = detail::Matrix4Data(m);
+
+		simd::Float4 r0 = simd::Load4(a);
+		simd::Float4 r1 = simd::Load4(a + 4);
+		simd::Float4 r2 = simd::Load4(a + 8);
+		simd::Float4 r3 = simd::Load4(a + 12);
+
+		simd::Transpose4(r0, r1, r2, r3);
+
+		Matrix4x4_t<float> result;
+		float* r = detail::Matrix4Data(result);
+
+		simd::Store4(r, r0);
+		simd::Store4(r + 4, r1);
+		simd::Store4(r + 8, r2);
+		simd::Store4(r + 12, r3);
+
+		return result;
+	}
+
+	template <>
+	inline Matrix4x4_t<float> Matrix4x4_t<float>::RigidInverse(const Matrix4x4_t<float>& m)
+	{
+		const float* a = detail::Matrix4Data(m);
+
+		//Transposing with a zero row transposes the rotation and clears the last column
+		simd::Float4 r0 = simd::Load4(a);
+		simd::Float4 r1 = simd::Load4(a + 4);
+		simd::Float4 r2 = simd::Load4(a + 8);
+		simd::Float4 r3 = simd::Set4(0.0f, 0.0f, 0.0f, 0.0f);
+		const simd::Float4 translation = simd::Load4(a + 12);
+
+		simd::Transpose4(r0, r1, r2, r3);
+
+		const simd::Float4 rotatedTranslation = simd::MulAdd(simd::Splat<0>(translation), r0,
+			simd::MulAdd(simd::Splat<1>(translation), r1, simd::Mul(simd::Splat<2>(translation), r2)));
+
+		Matrix4x4_t<float> result;
+		float* r = detail::Matrix4Data(result);
+
+		simd::Store4(r, r0);
+		simd::Store4(r + 4, r1);
+		simd::Store4(r + 8, r2);
+		simd::Store4(r + 12, simd::Sub(simd::Set4(0.0f, 0.0f, 0.0f, 1.0f), rotatedTranslation));
+
+		return result;
+	}
+
+#if NE_MATH_SSE
+	namespace detail
+	{
+		inline simd::Float4 Cross3(simd::Float4 a, simd::Float4 b)
+		{
+			return _mm_sub_ps(
+				_mm_mul_ps(NE_SIMD_SWIZZLE(a, 1, 2, 0, 3), NE_SIMD_SWIZZLE(b, 2, 0, 1, 3)),
+				_mm_mul_ps(NE_SIMD_SWIZZLE(a, 2, 0, 1, 3), NE_SIMD_SWIZZLE(b, 1, 2, 0, 3)));
+		}
+
+		//Sum of all four lanes in every lane
+		inline simd::Float4 HorizontalSum(simd::Float4 v)
+		{
+			v = _mm_add_ps(v, NE_SIMD_SWIZZLE(v, 1, 0, 3, 2));
+			return _mm_add_ps(v, NE_SIMD_SWIZZLE(v, 2, 3, 0, 1));
+		}
+
+		/**
+		 *	Cofactor rows of the upper 3x3 of m scaled by the reciprocal determinant, so they are the rows of the inverse transpose.
+		 *	The w lanes are zero when the last column of m is.
+		 */
+		inline void Matrix4InverseTranspose3x3(const Matrix4x4_t<float>& m, simd::Float4& c0, simd::Float4& c1, simd::Float4& c2)
+		{
+			const float* data = Matrix4Data(m);
+
+			//The w lanes are masked off so matrices with a projective column still get the 3x3 result
+			const simd::Float4 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+			const simd::Float4 r0 = _mm_and_ps(simd::Load4(data), mask);
+			const simd::Float4 r1 = _mm_and_ps(simd::Load4(data + 4), mask);
+			const simd::Float4 r2 = _mm_and_ps(simd::Load4(data + 8), mask);
+
+			c0 = Cross3(r1, r2);
+			c1 = Cross3(r2, r0);
+			c2 = Cross3(r0, r1);
+
+			const simd::Float4 invDet = _mm_div_ps(_mm_set1_ps(1.0f), HorizontalSum(_mm_mul_ps(r0, c0)));
+
+			c0 = _mm_mul_ps(c0, invDet);
+			c1 = _mm_mul_ps(c1, invDet);
+			c2 = _mm_mul_ps(c2, invDet);
+		}
+	}
+
+	template <>
+	inline Matrix4x4_t<float> Matrix4x4_t<float>::AffineInverse(const Matrix4x4_t<float>& m)
+	{
+		simd::Float4 r0, r1, r2;
+		detail::Matrix4InverseTranspose3x3(m, r0, r1, r2);
+
+		simd::Float4 r3 = _mm_setzero_ps();
+		simd::Transpose4(r0, r1, r2, r3);
+
+		const simd::Float4 translation = simd::Load4(detail::Matrix4Data(m) + 12);
+		const simd::Float4 transformedTranslation = simd::MulAdd(simd::Splat<0>(translation), r0,
+			simd::MulAdd(simd::Splat<1>(translation), r1, simd::Mul(simd::Splat<2>(translation), r2)));
+
+		Matrix4x4_t<float> result;
+		float* r = detail::Matrix4Data(result);
+
+		simd::Store4(r, r0);
+		simd::Store4(r + 4, r1);
+		simd::Store4(r + 8, r2);
+		simd::Store4(r + 12, _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), transformedTranslation));
+
+		return result;
+	}
+
+	template <>
+	inline Matrix3x3_t<float> Matrix4x4_t<float>::InverseTranspose3x3(const Matrix4x4_t<float>& m)
+	{
+		simd::Float4 c0, c1, c2;
+		detail::Matrix4InverseTranspose3x3(m, c0, c1, c2);
+
+		//Matrix3 rows are three floats, store through a padded copy
+		float rows[12];
+		simd::Store4(rows, c0);
+		simd::Store4(rows + 4, c1);
+		simd::Store4(rows + 8, c2);
+
+		return Matrix3x3_t<float>(
+			rows[0], rows[1], rows[2],
+			rows[4], rows[5], rows[6],
+			rows[8], rows[9], rows[10]);
+	}
+
+	namespace detail
+	{
+		//Products of 2x2 matrices stored row major in one register, # is the adjugate
+
+		//A * B
+		inline simd::Float4 Matrix2Multiply(simd::Float4 a, simd::Float4 b)
+		{
+			return _mm_add_ps(_mm_mul_ps(a, NE_SIMD_SWIZZLE(b, 0, 3, 0, 3)), _mm_mul_ps(NE_SIMD_SWIZZLE(a, 1, 0, 3, 2), NE_SIMD_SWIZZLE(b, 2, 1, 2, 1)));
+		}
+
+		//A# * B
+		inline simd::Float4 Matrix2AdjMultiply(simd::Float4 a, simd::Float4 b)
+		{
+			return _mm_sub_ps(_mm_mul_ps(NE_SIMD_SWIZZLE(a, 3, 3, 0, 0), b), _mm_mul_ps(NE_SIMD_SWIZZLE(a, 1, 1, 2, 2), NE_SIMD_SWIZZLE(b, 2, 3, 0, 1)));
+		}
+
+		//A * B#
+		inline simd::Float4 Matrix2MultiplyAdj(simd::Float4 a, simd::Float4 b)
+		{
+			return _mm_sub_ps(_mm_mul_ps(a, NE_SIMD_SWIZZLE(b, 3, 0, 3, 0)), _mm_mul_ps(NE_SIMD_SWIZZLE(a, 1, 0, 3, 2), NE_SIMD_SWIZZLE(b, 2, 1, 2, 1)));
+		}
+	}
+
+	/**
+	 *	Blockwise inversion, the matrix is split into four 2x2 matrices
+	 *	| A B |
+	 *	| C D |
+	 *	which are combined using their determinants and adjugates.
+	 */
+	template <>
+	inline Matrix4x4_t<float> Matrix4x4_t<float>::Inverse(const Matrix4x4_t<float>& m)
+	{
+		const float* data = detail::Matrix4Data(m);
+
+		const simd::Float4 r0 = simd::Load4(data);
+		const simd::Float4 r1 = simd::Load4(data + 4);
+		const simd::Float4 r2 = simd::Load4(data + 8);
+		const simd::Float4 r3 = simd::Load4(data + 12);
+
+		const simd::Float4 A = _mm_movelh_ps(r0, r1);
+		const simd::Float4 B = _mm_movehl_ps(r1, r0);
+		const simd::Float4 C = _mm_movelh_ps(r2, r3);
+		const simd::Float4 D = _mm_movehl_ps(r3, r2);
+
+		//Determinants of the sub matrices as (|A| |B| |C| |D|)
+		const simd::Float4 detSub = _mm_sub_ps(
+			_mm_mul_ps(NE_SIMD_SHUFFLE(r0, r2, 0, 2, 0, 2), NE_SIMD_SHUFFLE(r1, r3, 1, 3, 1, 3)),
+			_mm_mul_ps(NE_SIMD_SHUFFLE(r0, r2, 1, 3, 1, 3), NE_SIMD_SHUFFLE(r1, r3, 0, 2, 0, 2)));
+
+		const simd::Float4 detA = simd::Splat<0>(detSub);
+		const simd::Float4 detB = simd::Splat<1>(detSub);
+		const simd::Float4 detC = simd::Splat<2>(detSub);
+		const simd::Float4 detD = simd::Splat<3>(detSub);
+
+		const simd::Float4 DC = detail::Matrix2AdjMultiply(D, C);
+		const simd::Float4 AB = detail::Matrix2AdjMultiply(A, B);
+
+		//Adjugates of the blocks of the inverse
+		simd::Float4 X = _mm_sub_ps(_mm_mul_ps(detD, A), detail::Matrix2Multiply(B, DC));
+		simd::Float4 W = _mm_sub_ps(_mm_mul_ps(detA, D), detail::Matrix2Multiply(C, AB));
+		simd::Float4 Y = _mm_sub_ps(_mm_mul_ps(detB, C), detail::Matrix2MultiplyAdj(D, AB));
+		simd::Float4 Z = _mm_sub_ps(_mm_mul_ps(detC, B), detail::Matrix2MultiplyAdj(A, DC));
+
+		//|M| = |A||D| + |B||C| - tr((A#B)(D#C))
+		simd::Float4 trace = _mm_mul_ps(AB, NE_SIMD_SWIZZLE(DC, 0, 2, 1, 3));
+		trace = _mm_add_ps(trace, NE_SIMD_SWIZZLE(trace, 2, 3, 0, 1));
+		trace = _mm_add_ps(trace, NE_SIMD_SWIZZLE(trace, 1, 0, 3, 2));
+
+		const simd::Float4 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+		//Signs of the adjugate folded into the reciprocal
+		const simd::Float4 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+
+		X = _mm_mul_ps(X, invDet);
+		Y = _mm_mul_ps(Y, invDet);
+		Z = _mm_mul_ps(Z, invDet);
+		W = _mm_mul_ps(W, invDet);
+
+		Matrix4x4_t<float> result;
+		float* r = detail::Matrix4Data(result);
+
+		//Takes the adjugates back and reassembles the rows in the same shuffle
+		simd::Store4(r, NE_SIMD_SHUFFLE(X, Y, 3, 1, 3, 1));
+		simd::Store4(r + 4, NE_SIMD_SHUFFLE(X, Y, 2, 0, 2, 0));
+		simd::Store4(r + 8, NE_SIMD_SHUFFLE(Z, W, 3, 1, 3, 1));
+		simd::Store4(r + 12, NE_SIMD_SHUFFLE(Z, W, 2, 0, 2, 0));
+
+		return result;
+	}
+#endif
+}
+
+#endif
@@ -0,0 +1,370 @@
+#include "Packing.h"
+#include "MathSIMD.h"
+#include "Utility/Platform/CpuFeatures.h"
+
+#if NE_PLATFORM_X86
+#include <immintrin.h>
+#endif
+
+namespace novus
+{
+
+static_assert(sizeof(Vector3) == 3 * sizeof(float), "Normal packing assumes Vector3 is three packed floats");
+
+namespace
+{
+#if NE_MATH_SSE
+	/**
+	 *	FloatToHalf on four lanes, the upper 16 bits of each lane are copies of the sign so _mm_packs_epi32 keeps the half as is
+	 */
+	inline __m128i FloatToHalf4(__m128 f)
+	{
+		const __m128i halfMax = _mm_set1_epi32((127 + 16) << 23);
+		const __m128i minNormal = _mm_set1_epi32((127 - 14) << 23);
+		const __m128i denormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+		const __m128i normalBias = _mm_set1_epi32(0xFFF - ((127 - 15) << 23));
+
+		const __m128 sign = _mm_and_ps(f, _mm_castsi128_ps(_mm_set1_epi32(0x80000000u)));
+		const __m128 absolute = _mm_xor_ps(f, sign);
+		const __m128i absoluteBits = _mm_castps_si128(absolute);
+
+		//0x7C00 for infinity, 0x7E00 for NaN
+		const __m128i nanBit = _mm_and_si128(_mm_castps_si128(_mm_cmpunord_ps(absolute, absolute)), _mm_set1_epi32(0x200));
+		const __m128i infinityOrNaN = _mm_or_si128(nanBit, _mm_set1_epi32(0x7C00));
+
+		const __m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(absolute, _mm_castsi128_ps(denormalMagic))), denormalMagic);
+
+		//All ones when the lowest kept mantissa bit is set, subtracting it adds the round to even bit
+		const __m128i mantissaOdd = _mm_srai_epi32(_mm_slli_epi32(absoluteBits, 31 - 13), 31);
+		const __m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(absoluteBits, normalBias), mantissaOdd), 13);
+
+		const __m128i bDenormal = _mm_cmpgt_epi32(minNormal, absoluteBits);
+		const __m128i bFinite = _mm_cmpgt_epi32(halfMax, absoluteBits);
+
+		const __m128i finite = _mm_or_si128(_mm_and_si128(bDenormal, denormal), _mm_andnot_si128(bDenormal, normal));
+		const __m128i result = _mm_or_si128(_mm_and_si128(bFinite, finite), _mm_andnot_si128(bFinite, infinityOrNaN));
+
+		return _mm_or_si128(result, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+	}
+
+	/**
+	 *	HalfToFloat on four lanes of zero extended halves.
+	 *	Like the scalar version, half denormals go through float denormals and become zero when the thread flushes them.
+	 */
+	inline __m128 HalfToFloat4(__m128i h)
+	{
+		const __m128i exponentMantissa = _mm_and_si128(h, _mm_set1_epi32(0x7FFF));
+		const __m128i sign = _mm_slli_epi32(_mm_xor_si128(h, exponentMantissa), 16);
+
+		const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponentMantissa, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+		const __m128i bInfinityOrNaN = _mm_cmpgt_epi32(exponentMantissa, _mm_set1_epi32(0x7BFF));
+		const __m128i topExponent = _mm_and_si128(bInfinityOrNaN, _mm_set1_epi32(255 << 23));
+
+		return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, topExponent)));
+	}
+
+	//Clamps with NaN going to -1 like PackSnorm16, the result is in 32 bit lanes
+	inline __m128i FloatToSnorm16x4(__m128 f)
+	{
+		const __m128 clamped = _mm_min_ps(_mm_max_ps(f, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+		return _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(32767.0f)));
+	}
+
+	inline __m128 Snorm16ToFloat4(__m128i s)
+	{
+		return _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(s), _mm_set1_ps(1.0f / 32767.0f)), _mm_set1_ps(-1.0f));
+	}
+
+	inline __m128 Abs4(__m128 x)
+	{
+		return _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+	}
+
+	inline __m128 Select4(__m128 mask, __m128 a, __m128 b)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	//value where sign >= 0, -value elsewhere
+	inline __m128 CopySignNonZero4(__m128 value, __m128 sign)
+	{
+		const __m128 bNegative = _mm_cmplt_ps(sign, _mm_setzero_ps());
+		return _mm_xor_ps(value, _mm_and_ps(bNegative, _mm_set1_ps(-0.0f)));
+	}
+
+	/**
+	 *	PackOctahedralSnorm16 of four normals given as components
+	 */
+	inline __m128i PackOctahedral4(__m128 x, __m128 y, __m128 z)
+	{
+		const __m128 inverseL1 = _mm_div_ps(_mm_set1_ps(1.0f), _mm_add_ps(_mm_add_ps(Abs4(x), Abs4(y)), Abs4(z)));
+		const __m128 px = _mm_mul_ps(x, inverseL1);
+		const __m128 py = _mm_mul_ps(y, inverseL1);
+
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 fx = CopySignNonZero4(_mm_sub_ps(one, Abs4(py)), px);
+		const __m128 fy = CopySignNonZero4(_mm_sub_ps(one, Abs4(px)), py);
+
+		const __m128 bLower = _mm_cmplt_ps(z, _mm_setzero_ps());
+		const __m128i ex = FloatToSnorm16x4(Select4(bLower, fx, px));
+		const __m128i ey = FloatToSnorm16x4(Select4(bLower, fy, py));
+
+		return _mm_or_si128(_mm_and_si128(ex, _mm_set1_epi32(0xFFFF)), _mm_slli_epi32(ey, 16));
+	}
+
+	inline void UnpackOctahedral4(__m128i packed, __m128& x, __m128& y, __m128& z)
+	{
+		//Sign extends each half of the lanes
+		x = Snorm16ToFloat4(_mm_srai_epi32(_mm_slli_epi32(packed, 16), 16));
+		y = Snorm16ToFloat4(_mm_srai_epi32(packed, 16));
+		z = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), Abs4(x)), Abs4(y));
+
+		const __m128 t = _mm_and_ps(_mm_cmplt_ps(z, _mm_setzero_ps()), _mm_xor_ps(z, _mm_set1_ps(-0.0f)));
+		x = _mm_add_ps(x, CopySignNonZero4(_mm_xor_ps(t, _mm_set1_ps(-0.0f)), x));
+		y = _mm_add_ps(y, CopySignNonZero4(_mm_xor_ps(t, _mm_set1_ps(-0.0f)), y));
+
+		const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+		x = _mm_div_ps(x, length);
+		y = _mm_div_ps(y, length);
+		z = _mm_div_ps(z, length);
+	}
+#endif
+
+#if NE_PLATFORM_X86
+	//Whole groups of eight, returns how many elements were converted
+	NE_TARGET("avx,f16c") size_t FloatsToHalvesF16C(const float* in, uint16_t* out, size_t count)
+	{
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+
+		return i;
+	}
+
+	NE_TARGET("avx,f16c") size_t HalvesToFloatsF16C(const uint16_t* in, float* out, size_t count)
+	{
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+
+		return i;
+	}
+#endif
+
+	PackingKernel SelectFastestKernel()
+	{
+		if (IsPackingKernelSupported(PackingKernel::F16C))
+			return PackingKernel::F16C;
+
+		if (IsPackingKernelSupported(PackingKernel::SSE2))
+			return PackingKernel::SSE2;
+
+		return PackingKernel::Scalar;
+	}
+
+	PackingKernel& GetKernelSelection()
+	{
+		static PackingKernel selection = SelectFastestKernel();
+
+		return selection;
+	}
+}
+
+void FloatsToHalves(const float* in, uint16_t* out, size_t count)
+{
+	size_t i = 0;
+
+#if NE_PLATFORM_X86
+	if (GetKernelSelection() == PackingKernel::F16C)
+	{
+		i = FloatsToHalvesF16C(in, out, count);
+	}
+#endif
+
+#if NE_MATH_SSE
+	const size_t simdCount = GetKernelSelection() != PackingKernel::Scalar ? count : 0;
+
+	for (; i + 8 <= simdCount; i += 8)
+	{
+		const __m128i low = FloatToHalf4(_mm_loadu_ps(in + i));
+		const __m128i high = FloatToHalf4(_mm_loadu_ps(in + i + 4));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(low, high));
+	}
+#endif
+
+	for (; i < count; i++)
+		out[i] = FloatToHalf(in[i]);
+}
+
+void HalvesToFloats(const uint16_t* in, float* out, size_t count)
+{
+	size_t i = 0;
+
+#if NE_PLATFORM_X86
+	if (GetKernelSelection() == PackingKernel::F16C)
+	{
+		i = HalvesToFloatsF16C(in, out, count);
+	}
+#endif
+
+#if NE_MATH_SSE
+	const size_t simdCount = GetKernelSelection() != PackingKernel::Scalar ? count : 0;
+
+	for (; i + 8 <= simdCount; i += 8)
+	{
+		const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+		_mm_storeu_ps(out + i, HalfToFloat4(_mm_unpacklo_epi16(halves, _mm_setzero_si128())));
+		_mm_storeu_ps(out + i + 4, HalfToFloat4(_mm_unpackhi_epi16(halves, _mm_setzero_si128())));
+	}
+#endif
+
+	for (; i < count; i++)
+		out[i] = HalfToFloat(in[i]);
+}
+
+void FloatsToSnorm16(const float* in, int16_t* out, size_t count)
+{
+	size_t i = 0;
+
+#if NE_MATH_SSE
+	const size_t simdCount = GetKernelSelection() != PackingKernel::Scalar ? count : 0;
+
+	for (; i + 8 <= simdCount; i += 8)
+	{
+		const __m128i low = FloatToSnorm16x4(_mm_loadu_ps(in + i));
+		const __m128i high = FloatToSnorm16x4(_mm_loadu_ps(in + i + 4));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(low, high));
+	}
+#endif
+
+	for (; i < count; i++)
+		out[i] = PackSnorm16(in[i]);
+}
+
+void Snorm16ToFloats(const int16_t* in, float* out, size_t count)
+{
+	size_t i = 0;
+
+#if NE_MATH_SSE
+	const size_t simdCount = GetKernelSelection() != PackingKernel::Scalar ? count : 0;
+
+	for (; i + 8 <= simdCount; i += 8)
+	{
+		//Unpacking a register with itself puts each value in the top half of a lane, the arithmetic shift sign extends it
+		const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+		_mm_storeu_ps(out + i, Snorm16ToFloat4(_mm_srai_epi32(_mm_unpacklo_epi16(values, values), 16)));
+		_mm_storeu_ps(out + i + 4, Snorm16ToFloat4(_mm_srai_epi32(_mm_unpackhi_epi16(values, values), 16)));
+	}
+#endif
+
+	for (; i < count; i++)
+		out[i] = UnpackSnorm16(in[i]);
+}
+
+void PackOctahedralNormals(const Vector3* in, size_t inStride, uint32_t* out, size_t outStride, size_t count)
+{
+	const uint8_t* src = reinterpret_cast<const uint8_t*>(in);
+	uint8_t* dst = reinterpret_cast<uint8_t*>(out);
+	size_t i = 0;
+
+#if NE_MATH_SSE
+	const size_t simdCount = GetKernelSelection() != PackingKernel::Scalar ? count : 0;
+
+	for (; i + 4 <= simdCount; i += 4)
+	{
+		const Vector3& n0 = *reinterpret_cast<const Vector3*>(src + i * inStride);
+		const Vector3& n1 = *reinterpret_cast<const Vector3*>(src + (i + 1) * inStride);
+		const Vector3& n2 = *reinterpret_cast<const Vector3*>(src + (i + 2) * inStride);
+		const Vector3& n3 = *reinterpret_cast<const Vector3*>(src + (i + 3) * inStride);
+
+		const __m128 x = _mm_setr_ps(n0.x, n1.x, n2.x, n3.x);
+		const __m128 y = _mm_setr_ps(n0.y, n1.y, n2.y, n3.y);
+		const __m128 z = _mm_setr_ps(n0.z, n1.z, n2.z, n3.z);
+
+		alignas(16) uint32_t packed[4];
+		_mm_store_si128(reinterpret_cast<__m128i*>(packed), PackOctahedral4(x, y, z));
+
+		for (size_t lane = 0; lane < 4; lane++)
+			*reinterpret_cast<uint32_t*>(dst + (i + lane) * outStride) = packed[lane];
+	}
+#endif
+
+	for (; i < count; i++)
+		*reinterpret_cast<uint32_t*>(dst + i * outStride) = PackOctahedralSnorm16(*reinterpret_cast<const Vector3*>(src + i * inStride));
+}
+
+void UnpackOctahedralNormals(const uint32_t* in, size_t inStride, Vector3* out, size_t outStride, size_t count)
+{
+	const uint8_t* src = reinterpret_cast<const uint8_t*>(in);
+	uint8_t* dst = reinterpret_cast<uint8_t*>(out);
+	size_t i = 0;
+
+#if NE_MATH_SSE
+	const size_t simdCount = GetKernelSelection() != PackingKernel::Scalar ? count : 0;
+
+	for (; i + 4 <= simdCount; i += 4)
+	{
+		alignas(16) uint32_t packed[4];
+
+		for (size_t lane = 0; lane < 4; lane++)
+			packed[lane] = *reinterpret_cast<const uint32_t*>(src + (i + lane) * inStride);
+
+		__m128 x, y, z;
+		UnpackOctahedral4(_mm_load_si128(reinterpret_cast<const __m128i*>(packed)), x, y, z);
+
+		alignas(16) float components[3][4];
+		_mm_store_ps(components[0], x);
+		_mm_store_ps(components[1], y);
+		_mm_store_ps(components[2], z);
+
+		for (size_t lane = 0; lane < 4; lane++)
+			*reinterpret_cast<Vector3*>(dst + (i + lane) * outStride) = Vector3(components[0][lane], components[1][lane], components[2][lane]);
+	}
+#endif
+
+	for (; i < count; i++)
+		*reinterpret_cast<Vector3*>(dst + i * outStride) = UnpackOctahedralSnorm16(*reinterpret_cast<const uint32_t*>(src + i * inStride));
+}
+
+bool IsPackingKernelSupported(PackingKernel kernel)
+{
+	switch (kernel)
+	{
+	case PackingKernel::Scalar:
+		return true;
+#if NE_MATH_SSE
+	case PackingKernel::SSE2:
+		return true;
+#endif
+#if NE_PLATFORM_X86
+	case PackingKernel::F16C:
+		return GetCpuFeatures().bF16C;
+#endif
+	default:
+		return false;
+	}
+}
+
+bool SetPackingKernel(PackingKernel kernel)
+{
+	if (!IsPackingKernelSupported(kernel))
+		return false;
+
+	GetKernelSelection() = kernel;
+
+	return true;
+}
+
+void ResetPackingKernel()
+{
+	GetKernelSelection() = SelectFastestKernel();
+}
+
+PackingKernel GetPackingKernel()
+{
+	return GetKernelSelection();
+}
+
+}
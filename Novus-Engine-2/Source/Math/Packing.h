@@ -0,0 +1,280 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <cmath>
+#include <cstring>
+#include "Vector2.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+/**
+ *	Conversions between floats and the compact formats used for vertex attributes and GPU buffers.
+ *
+ *	Each packed value has the bit layout of the DXGI format named in its comment, so it can be copied into a buffer as is.
+ *	The single value functions are inline. The array functions convert whole streams with SSE2, and with F16C where
+ *	the CPU has it, and give the same bits as the single value functions.
+ */
+
+namespace novus
+{
+
+/**
+ *	IEEE half, DXGI_FORMAT_R16_FLOAT. Rounds to nearest even, overflows to infinity, keeps denormals, NaNs stay NaN.
+ */
+uint16_t FloatToHalf(float f);
+
+float HalfToFloat(uint16_t h);
+
+/**
+ *	DXGI_FORMAT_R16_SNORM. Clamps to [-1, 1] and rounds to nearest, -32768 is never produced and unpacks to -1 like 32767 does to 1.
+ */
+int16_t PackSnorm16(float f);
+
+float UnpackSnorm16(int16_t s);
+
+/**
+ *	Octahedral mapping of a unit vector onto [-1, 1]^2 by Cigolle et al.
+ *	The unit sphere is projected onto an octahedron and its lower half folded over the upper one.
+ */
+Vector2 OctahedralEncode(const Vector3& n);
+
+//Normalized vector from an octahedral encoding
+Vector3 OctahedralDecode(const Vector2& e);
+
+/**
+ *	Unit vector as an octahedral encoding in two snorm16s, DXGI_FORMAT_R16G16_SNORM with x in the low half.
+ *	The angle to the original vector is below 0.005 degrees.
+ */
+uint32_t PackOctahedralSnorm16(const Vector3& n);
+
+Vector3 UnpackOctahedralSnorm16(uint32_t packed);
+
+/**
+ *	DXGI_FORMAT_R10G10B10A2_UNORM, each component clamped to [0, 1]. x is in the lowest 10 bits, w in the top 2.
+ */
+uint32_t PackUnorm1010102(const Vector4& v);
+
+Vector4 UnpackUnorm1010102(uint32_t packed);
+
+//Two halves, DXGI_FORMAT_R16G16_FLOAT with x in the low half
+uint32_t PackHalf2(const Vector2& v);
+
+Vector2 UnpackHalf2(uint32_t packed);
+
+/**
+ *	Array versions, in and out must not overlap.
+ *	F16C keeps NaN payloads where the single value functions give the default NaN, otherwise the results are the same.
+ */
+void FloatsToHalves(const float* in, uint16_t* out, size_t count);
+
+void HalvesToFloats(const uint16_t* in, float* out, size_t count);
+
+void FloatsToSnorm16(const float* in, int16_t* out, size_t count);
+
+void Snorm16ToFloats(const int16_t* in, float* out, size_t count);
+
+/**
+ *	PackOctahedralSnorm16 of a stream of normals, with byte strides so they can be fields of larger vertex structs
+ */
+void PackOctahedralNormals(const Vector3* in, size_t inStride, uint32_t* out, size_t outStride, size_t count);
+
+void UnpackOctahedralNormals(const uint32_t* in, size_t inStride, Vector3* out, size_t outStride, size_t count);
+
+/**
+ *	Implementations of the array functions, the fastest one the CPU supports is picked automatically
+ */
+enum class PackingKernel
+{
+	//The single value functions in a loop
+	Scalar,
+	//Four lanes at a time, available whenever NE_MATH_SSE is
+	SSE2,
+	//Hardware half conversions for FloatsToHalves and HalvesToFloats, the other functions use SSE2
+	F16C
+};
+
+bool IsPackingKernelSupported(PackingKernel kernel);
+
+/**
+ *	Overrides the kernel picked from the CPU features, for testing and benchmarks. Not thread safe.
+ *	@return false if the CPU does not support the kernel, the current selection is kept
+ */
+bool SetPackingKernel(PackingKernel kernel);
+
+/**
+ *	Goes back to the fastest kernel the CPU supports
+ */
+void ResetPackingKernel();
+
+PackingKernel GetPackingKernel();
+
+}
+
+/**
+ *	Packing definitions
+ */
+
+namespace novus
+{
+
+namespace detail
+{
+	inline uint32_t FloatBits(float f)
+	{
+		uint32_t bits;
+		std::memcpy(&bits, &f, sizeof(bits));
+		return bits;
+	}
+
+	inline float BitsToFloat(uint32_t bits)
+	{
+		float f;
+		std::memcpy(&f, &bits, sizeof(f));
+		return f;
+	}
+
+	//Round to nearest even like the SIMD conversions, with the rounding mode the process runs with
+	inline int32_t RoundToInt(float f)
+	{
+		return static_cast<int32_t>(std::nearbyint(f));
+	}
+
+	//Clamp to [0, 1], NaN gives 0
+	inline float Saturate(float f)
+	{
+		return f > 0.0f ? (f < 1.0f ? f : 1.0f) : 0.0f;
+	}
+
+	inline float CopySignNonZero(float value, float sign)
+	{
+		return sign >= 0.0f ? value : -value;
+	}
+}
+
+inline uint16_t FloatToHalf(float f)
+{
+	//Giesen's rounding float to half conversion, the SSE2 array version is the same steps on four lanes
+	const uint32_t bits = detail::FloatBits(f);
+	const uint32_t sign = bits & 0x80000000u;
+	const uint32_t absolute = bits ^ sign;
+
+	uint32_t result;
+
+	if (absolute >= ((127 + 16) << 23))
+	{
+		//Too large for a half, infinity or NaN
+		result = absolute > (255u << 23) ? 0x7E00u : 0x7C00u;
+	}
+	else if (absolute < ((127 - 14) << 23))
+	{
+		//Half denormal or zero, adding 0.5 shifts the mantissa into place and the FPU rounds it
+		const uint32_t denormalMagic = ((127 - 15) + (23 - 10) + 1) << 23;
+		result = detail::FloatBits(detail::BitsToFloat(absolute) + detail::BitsToFloat(denormalMagic)) - denormalMagic;
+	}
+	else
+	{
+		//Rebias the exponent and round the dropped 13 bits to nearest even
+		const uint32_t mantissaOdd = (absolute >> 13) & 1;
+		result = (absolute + (static_cast<uint32_t>(15 - 127) << 23) + 0xFFF + mantissaOdd) >> 13;
+	}
+
+	return static_cast<uint16_t>(result | (sign >> 16));
+}
+
+inline float HalfToFloat(uint16_t h)
+{
+	//Multiplying by 2^112 rebiases normals and normalizes denormals in one step, infinities and NaNs get the top exponent back
+	const uint32_t exponentMantissa = h & 0x7FFFu;
+	uint32_t bits = detail::FloatBits(detail::BitsToFloat(exponentMantissa << 13) * detail::BitsToFloat((254 - 15) << 23));
+
+	if (exponentMantissa >= 0x7C00u)
+		bits |= 255u << 23;
+
+	return detail::BitsToFloat(bits | (static_cast<uint32_t>(h & 0x8000u) << 16));
+}
+
+inline int16_t PackSnorm16(float f)
+{
+	//NaN clamps to -1 like the SIMD min and max do
+	const float clamped = f > -1.0f ? (f < 1.0f ? f : 1.0f) : -1.0f;
+	return static_cast<int16_t>(detail::RoundToInt(clamped * 32767.0f));
+}
+
+inline float UnpackSnorm16(int16_t s)
+{
+	const float f = static_cast<float>(s) * (1.0f / 32767.0f);
+	return f < -1.0f ? -1.0f : f;
+}
+
+inline Vector2 OctahedralEncode(const Vector3& n)
+{
+	const float inverseL1 = 1.0f / (std::fabs(n.x) + std::fabs(n.y) + std::fabs(n.z));
+	const float x = n.x * inverseL1;
+	const float y = n.y * inverseL1;
+
+	if (n.z >= 0.0f)
+		return Vector2(x, y);
+
+	return Vector2(detail::CopySignNonZero(1.0f - std::fabs(y), x), detail::CopySignNonZero(1.0f - std::fabs(x), y));
+}
+
+inline Vector3 OctahedralDecode(const Vector2& e)
+{
+	Vector3 n(e.x, e.y, 1.0f - std::fabs(e.x) - std::fabs(e.y));
+
+	//Unfolds the lower half, t is zero in the upper half
+	const float t = n.z < 0.0f ? -n.z : 0.0f;
+	n.x += n.x >= 0.0f ? -t : t;
+	n.y += n.y >= 0.0f ? -t : t;
+
+	return Normalize(n);
+}
+
+inline uint32_t PackOctahedralSnorm16(const Vector3& n)
+{
+	const Vector2 e = OctahedralEncode(n);
+	return static_cast<uint16_t>(PackSnorm16(e.x)) | (static_cast<uint32_t>(static_cast<uint16_t>(PackSnorm16(e.y))) << 16);
+}
+
+inline Vector3 UnpackOctahedralSnorm16(uint32_t packed)
+{
+	const Vector2 e(UnpackSnorm16(static_cast<int16_t>(packed & 0xFFFFu)), UnpackSnorm16(static_cast<int16_t>(packed >> 16)));
+	return OctahedralDecode(e);
+}
+
+inline uint32_t PackUnorm1010102(const Vector4& v)
+{
+	return static_cast<uint32_t>(detail::RoundToInt(detail::Saturate(v.x) * 1023.0f)) |
+		(static_cast<uint32_t>(detail::RoundToInt(detail::Saturate(v.y) * 1023.0f)) << 10) |
+		(static_cast<uint32_t>(detail::RoundToInt(detail::Saturate(v.z) * 1023.0f)) << 20) |
+		(static_cast<uint32_t>(detail::RoundToInt(detail::Saturate(v.w) * 3.0f)) << 30);
+}
+
+inline Vector4 UnpackUnorm1010102(uint32_t packed)
+{
+	return Vector4(
+		static_cast<float>(packed & 0x3FFu) * (1.0f / 1023.0f),
+		static_cast<float>((packed >> 10) & 0x3FFu) * (1.0f / 1023.0f),
+		static_cast<float>((packed >> 20) & 0x3FFu) * (1.0f / 1023.0f),
+		static_cast<float>(packed >> 30) * (1.0f / 3.0f));
+}
+
+inline uint32_t PackHalf2(const Vector2& v)
+{
+	return FloatToHalf(v.x) | (static_cast<uint32_t>(FloatToHalf(v.y)) << 16);
+}
+
+inline Vector2 UnpackHalf2(uint32_t packed)
+{
+	return Vector2(HalfToFloat(static_cast<uint16_t>(packed & 0xFFFFu)), HalfToFloat(static_cast<uint16_t>(packed >> 16)));
+}
+
+}
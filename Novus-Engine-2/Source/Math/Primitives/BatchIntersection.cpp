@@ -0,0 +1,338 @@
+#include "BatchIntersection.h"
+#include "Math/MathSIMD.h"
+#include "Utility/Platform/CpuFeatures.h"
+
+#if NE_PLATFORM_X86
+#include <immintrin.h>
+#endif
+
+namespace novus
+{
+
+/**
+ *	The SIMD versions use separate multiplies and adds in the order of the scalar tests, not MulAdd, so the results match them exactly
+ */
+
+namespace
+{
+	inline bool IsSphereCulled(const Plane* planes, size_t planeCount, const SphereArrays& spheres, size_t i)
+	{
+		const Sphere sphere(Vector3(spheres.CenterX[i], spheres.CenterY[i], spheres.CenterZ[i]), spheres.Radius[i]);
+		int culled = 0;
+
+		for (size_t j = 0; j < planeCount; j++)
+			culled |= Classify(planes[j], sphere) == PlaneSide::Back;
+
+		return culled != 0;
+	}
+
+	inline AABB GetBox(const AABBArrays& boxes, size_t i)
+	{
+		return AABB(Vector3(boxes.MinX[i], boxes.MinY[i], boxes.MinZ[i]), Vector3(boxes.MaxX[i], boxes.MaxY[i], boxes.MaxZ[i]));
+	}
+
+	inline bool IsAABBCulled(const Plane* planes, size_t planeCount, const AABBArrays& boxes, size_t i)
+	{
+		const AABB box = GetBox(boxes, i);
+		int culled = 0;
+
+		for (size_t j = 0; j < planeCount; j++)
+			culled |= Classify(planes[j], box) == PlaneSide::Back;
+
+		return culled != 0;
+	}
+
+	inline void WriteVisible(uint8_t* visible, int culledMask, int width)
+	{
+		for (int lane = 0; lane < width; lane++)
+			visible[lane] = static_cast<uint8_t>(((culledMask >> lane) & 1) ^ 1);
+	}
+
+#if NE_MATH_SSE || NE_MATH_NEON
+	struct PlaneLanes4
+	{
+		simd::Float4 NormalX, NormalY, NormalZ, D;
+		simd::Float4 AbsNormalX, AbsNormalY, AbsNormalZ;
+
+		explicit PlaneLanes4(const Plane& plane)
+			: NormalX(simd::Set1(plane.Normal.x)), NormalY(simd::Set1(plane.Normal.y)), NormalZ(simd::Set1(plane.Normal.z)), D(simd::Set1(plane.D)),
+			AbsNormalX(simd::Set1(std::fabs(plane.Normal.x))), AbsNormalY(simd::Set1(std::fabs(plane.Normal.y))), AbsNormalZ(simd::Set1(std::fabs(plane.Normal.z)))
+		{}
+
+		simd::Float4 SignedDistance(simd::Float4 x, simd::Float4 y, simd::Float4 z) const
+		{
+			using namespace simd;
+			return Add(Add(Add(Mul(NormalX, x), Mul(NormalY, y)), Mul(NormalZ, z)), D);
+		}
+
+		simd::Float4 ProjectedExtent(simd::Float4 x, simd::Float4 y, simd::Float4 z) const
+		{
+			using namespace simd;
+			return Add(Add(Mul(AbsNormalX, x), Mul(AbsNormalY, y)), Mul(AbsNormalZ, z));
+		}
+	};
+
+	//Bit i is set where lane i is behind a plane
+	inline int CullSpheres4(const Plane* planes, size_t planeCount, simd::Float4 x, simd::Float4 y, simd::Float4 z, simd::Float4 radius)
+	{
+		using namespace simd;
+
+		const Float4 negativeRadius = Sub(Set1(0.0f), radius);
+		Float4 culled = Set1(0.0f);
+
+		for (size_t j = 0; j < planeCount; j++)
+			culled = Or(culled, Less(PlaneLanes4(planes[j]).SignedDistance(x, y, z), negativeRadius));
+
+		return MoveMask(culled);
+	}
+#endif
+
+#if NE_PLATFORM_X86
+	//Broadcast again for every group rather than kept in an array, heap memory isn't 32 byte aligned before C++17
+	struct PlaneLanes8
+	{
+		__m256 NormalX, NormalY, NormalZ, D;
+		__m256 AbsNormalX, AbsNormalY, AbsNormalZ;
+	};
+
+	NE_TARGET("avx") inline PlaneLanes8 GetPlaneLanes8(const Plane& plane)
+	{
+		PlaneLanes8 lanes;
+		lanes.NormalX = _mm256_set1_ps(plane.Normal.x);
+		lanes.NormalY = _mm256_set1_ps(plane.Normal.y);
+		lanes.NormalZ = _mm256_set1_ps(plane.Normal.z);
+		lanes.D = _mm256_set1_ps(plane.D);
+		lanes.AbsNormalX = _mm256_set1_ps(std::fabs(plane.Normal.x));
+		lanes.AbsNormalY = _mm256_set1_ps(std::fabs(plane.Normal.y));
+		lanes.AbsNormalZ = _mm256_set1_ps(std::fabs(plane.Normal.z));
+		return lanes;
+	}
+
+	NE_TARGET("avx") inline __m256 SignedDistance8(const PlaneLanes8& plane, __m256 x, __m256 y, __m256 z)
+	{
+		const __m256 dot = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(plane.NormalX, x), _mm256_mul_ps(plane.NormalY, y)), _mm256_mul_ps(plane.NormalZ, z));
+		return _mm256_add_ps(dot, plane.D);
+	}
+
+	//Whole groups of eight, returns how many were tested
+	NE_TARGET("avx") size_t CullSpheresAVX(const Plane* planes, size_t planeCount, const SphereArrays& spheres, uint8_t* visible, size_t count)
+	{
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 x = _mm256_loadu_ps(spheres.CenterX + i);
+			const __m256 y = _mm256_loadu_ps(spheres.CenterY + i);
+			const __m256 z = _mm256_loadu_ps(spheres.CenterZ + i);
+			const __m256 negativeRadius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(spheres.Radius + i));
+
+			__m256 culled = _mm256_setzero_ps();
+
+			for (size_t j = 0; j < planeCount; j++)
+				culled = _mm256_or_ps(culled, _mm256_cmp_ps(SignedDistance8(GetPlaneLanes8(planes[j]), x, y, z), negativeRadius, _CMP_LT_OQ));
+
+			WriteVisible(visible + i, _mm256_movemask_ps(culled), 8);
+		}
+
+		return i;
+	}
+
+	NE_TARGET("avx") size_t CullAABBsAVX(const Plane* planes, size_t planeCount, const AABBArrays& boxes, uint8_t* visible, size_t count)
+	{
+		const __m256 half = _mm256_set1_ps(0.5f);
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 minX = _mm256_loadu_ps(boxes.MinX + i);
+			const __m256 minY = _mm256_loadu_ps(boxes.MinY + i);
+			const __m256 minZ = _mm256_loadu_ps(boxes.MinZ + i);
+			const __m256 maxX = _mm256_loadu_ps(boxes.MaxX + i);
+			const __m256 maxY = _mm256_loadu_ps(boxes.MaxY + i);
+			const __m256 maxZ = _mm256_loadu_ps(boxes.MaxZ + i);
+
+			const __m256 centerX = _mm256_mul_ps(_mm256_add_ps(minX, maxX), half);
+			const __m256 centerY = _mm256_mul_ps(_mm256_add_ps(minY, maxY), half);
+			const __m256 centerZ = _mm256_mul_ps(_mm256_add_ps(minZ, maxZ), half);
+			const __m256 extentX = _mm256_mul_ps(_mm256_sub_ps(maxX, minX), half);
+			const __m256 extentY = _mm256_mul_ps(_mm256_sub_ps(maxY, minY), half);
+			const __m256 extentZ = _mm256_mul_ps(_mm256_sub_ps(maxZ, minZ), half);
+
+			__m256 culled = _mm256_setzero_ps();
+
+			for (size_t j = 0; j < planeCount; j++)
+			{
+				const PlaneLanes8 plane = GetPlaneLanes8(planes[j]);
+				const __m256 extent = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(plane.AbsNormalX, extentX), _mm256_mul_ps(plane.AbsNormalY, extentY)),
+					_mm256_mul_ps(plane.AbsNormalZ, extentZ));
+				const __m256 negativeExtent = _mm256_sub_ps(_mm256_setzero_ps(), extent);
+
+				culled = _mm256_or_ps(culled, _mm256_cmp_ps(SignedDistance8(plane, centerX, centerY, centerZ), negativeExtent, _CMP_LT_OQ));
+			}
+
+			WriteVisible(visible + i, _mm256_movemask_ps(culled), 8);
+		}
+
+		return i;
+	}
+
+	NE_TARGET("avx") size_t IntersectRayAABBsAVX(const Vector3& origin, const Vector3& inverseDirection, float maxDistance, const AABBArrays& boxes,
+		float* distances, size_t count)
+	{
+		const __m256 originX = _mm256_set1_ps(origin.x);
+		const __m256 originY = _mm256_set1_ps(origin.y);
+		const __m256 originZ = _mm256_set1_ps(origin.z);
+		const __m256 inverseX = _mm256_set1_ps(inverseDirection.x);
+		const __m256 inverseY = _mm256_set1_ps(inverseDirection.y);
+		const __m256 inverseZ = _mm256_set1_ps(inverseDirection.z);
+		const __m256 tMin = _mm256_setzero_ps();
+		const __m256 tMax = _mm256_set1_ps(maxDistance);
+		const __m256 miss = _mm256_set1_ps(Math::Infinity);
+
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 t1x = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(boxes.MinX + i), originX), inverseX);
+			const __m256 t1y = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(boxes.MinY + i), originY), inverseY);
+			const __m256 t1z = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(boxes.MinZ + i), originZ), inverseZ);
+			const __m256 t2x = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(boxes.MaxX + i), originX), inverseX);
+			const __m256 t2y = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(boxes.MaxY + i), originY), inverseY);
+			const __m256 t2z = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(boxes.MaxZ + i), originZ), inverseZ);
+
+			const __m256 tNear = _mm256_max_ps(_mm256_max_ps(_mm256_min_ps(t1x, t2x), _mm256_min_ps(t1y, t2y)), _mm256_max_ps(_mm256_min_ps(t1z, t2z), tMin));
+			const __m256 tFar = _mm256_min_ps(_mm256_min_ps(_mm256_max_ps(t1x, t2x), _mm256_max_ps(t1y, t2y)), _mm256_min_ps(_mm256_max_ps(t1z, t2z), tMax));
+
+			_mm256_storeu_ps(distances + i, _mm256_blendv_ps(miss, tNear, _mm256_cmp_ps(tNear, tFar, _CMP_LE_OQ)));
+		}
+
+		return i;
+	}
+#endif
+}
+
+void CullSpheres(const Plane* planes, size_t planeCount, const SphereArrays& spheres, uint8_t* visible, size_t count)
+{
+	size_t i = 0;
+
+#if NE_PLATFORM_X86
+	if (GetCpuFeatures().bAVX)
+	{
+		i = CullSpheresAVX(planes, planeCount, spheres, visible, count);
+	}
+#endif
+
+#if NE_MATH_SSE || NE_MATH_NEON
+	for (; i + 4 <= count; i += 4)
+	{
+		const int culled = CullSpheres4(planes, planeCount, simd::Load4(spheres.CenterX + i), simd::Load4(spheres.CenterY + i), simd::Load4(spheres.CenterZ + i),
+			simd::Load4(spheres.Radius + i));
+
+		WriteVisible(visible + i, culled, 4);
+	}
+#endif
+
+	for (; i < count; i++)
+		visible[i] = IsSphereCulled(planes, planeCount, spheres, i) ? 0 : 1;
+}
+
+void CullAABBs(const Plane* planes, size_t planeCount, const AABBArrays& boxes, uint8_t* visible, size_t count)
+{
+	size_t i = 0;
+
+#if NE_PLATFORM_X86
+	if (GetCpuFeatures().bAVX)
+	{
+		i = CullAABBsAVX(planes, planeCount, boxes, visible, count);
+	}
+#endif
+
+#if NE_MATH_SSE || NE_MATH_NEON
+	using namespace simd;
+
+	const Float4 half = Set1(0.5f);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		const Float4 minX = Load4(boxes.MinX + i);
+		const Float4 minY = Load4(boxes.MinY + i);
+		const Float4 minZ = Load4(boxes.MinZ + i);
+		const Float4 maxX = Load4(boxes.MaxX + i);
+		const Float4 maxY = Load4(boxes.MaxY + i);
+		const Float4 maxZ = Load4(boxes.MaxZ + i);
+
+		const Float4 centerX = Mul(Add(minX, maxX), half);
+		const Float4 centerY = Mul(Add(minY, maxY), half);
+		const Float4 centerZ = Mul(Add(minZ, maxZ), half);
+		const Float4 extentX = Mul(Sub(maxX, minX), half);
+		const Float4 extentY = Mul(Sub(maxY, minY), half);
+		const Float4 extentZ = Mul(Sub(maxZ, minZ), half);
+
+		Float4 culled = Set1(0.0f);
+
+		for (size_t j = 0; j < planeCount; j++)
+		{
+			const PlaneLanes4 plane(planes[j]);
+			const Float4 negativeExtent = Sub(Set1(0.0f), plane.ProjectedExtent(extentX, extentY, extentZ));
+			culled = Or(culled, Less(plane.SignedDistance(centerX, centerY, centerZ), negativeExtent));
+		}
+
+		WriteVisible(visible + i, MoveMask(culled), 4);
+	}
+#endif
+
+	for (; i < count; i++)
+		visible[i] = IsAABBCulled(planes, planeCount, boxes, i) ? 0 : 1;
+}
+
+void IntersectRayAABBs(const Ray& ray, float maxDistance, const AABBArrays& boxes, float* distances, size_t count)
+{
+	const Vector3 inverseDirection = detail::Reciprocal(ray.Direction);
+	size_t i = 0;
+
+#if NE_PLATFORM_X86
+	if (GetCpuFeatures().bAVX)
+	{
+		i = IntersectRayAABBsAVX(ray.Origin, inverseDirection, maxDistance, boxes, distances, count);
+	}
+#endif
+
+#if NE_MATH_SSE || NE_MATH_NEON
+	using namespace simd;
+
+	const Float4 originX = Set1(ray.Origin.x);
+	const Float4 originY = Set1(ray.Origin.y);
+	const Float4 originZ = Set1(ray.Origin.z);
+	const Float4 inverseX = Set1(inverseDirection.x);
+	const Float4 inverseY = Set1(inverseDirection.y);
+	const Float4 inverseZ = Set1(inverseDirection.z);
+	const Float4 tMin = Set1(0.0f);
+	const Float4 tMax = Set1(maxDistance);
+	const Float4 miss = Set1(Math::Infinity);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		const Float4 t1x = Mul(Sub(Load4(boxes.MinX + i), originX), inverseX);
+		const Float4 t1y = Mul(Sub(Load4(boxes.MinY + i), originY), inverseY);
+		const Float4 t1z = Mul(Sub(Load4(boxes.MinZ + i), originZ), inverseZ);
+		const Float4 t2x = Mul(Sub(Load4(boxes.MaxX + i), originX), inverseX);
+		const Float4 t2y = Mul(Sub(Load4(boxes.MaxY + i), originY), inverseY);
+		const Float4 t2z = Mul(Sub(Load4(boxes.MaxZ + i), originZ), inverseZ);
+
+		const Float4 tNear = Max(Max(Min(t1x, t2x), Min(t1y, t2y)), Max(Min(t1z, t2z), tMin));
+		const Float4 tFar = Min(Min(Max(t1x, t2x), Max(t1y, t2y)), Min(Max(t1z, t2z), tMax));
+
+		//Hit where tNear <= tFar, the same as not tFar < tNear for numbers
+		Store4(distances + i, Select(Less(tFar, tNear), miss, tNear));
+	}
+#endif
+
+	for (; i < count; i++)
+	{
+		float distance;
+		const bool bHit = detail::IntersectSlabs(ray.Origin, inverseDirection, GetBox(boxes, i), 0.0f, maxDistance, distance);
+		distances[i] = bHit ? distance : Math::Infinity;
+	}
+}
+
+}
@@ -0,0 +1,58 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Plane.h"
+#include "Ray.h"
+
+/**
+ *	Culling and picking tests over whole arrays of primitives.
+ *
+ *	The primitives are stored as separate arrays per component, so the functions test 8 primitives per step with AVX where the CPU has it,
+ *	4 with SSE2 or NEON otherwise, and the rest one at a time. Each result is the same as the single primitive test in the primitive headers.
+ */
+
+namespace novus
+{
+
+struct SphereArrays
+{
+	const float* CenterX;
+	const float* CenterY;
+	const float* CenterZ;
+	const float* Radius;
+};
+
+struct AABBArrays
+{
+	const float* MinX;
+	const float* MinY;
+	const float* MinZ;
+	const float* MaxX;
+	const float* MaxY;
+	const float* MaxZ;
+};
+
+/**
+ *	visible[i] is 0 if sphere i is behind any of the planes, Classify(planes[j], sphere) == PlaneSide::Back, and 1 otherwise.
+ *	With the planes from ExtractFrustumPlanes this is frustum culling, spheres near the corners of the frustum may be kept although they are outside.
+ */
+void CullSpheres(const Plane* planes, size_t planeCount, const SphereArrays& spheres, uint8_t* visible, size_t count);
+
+//CullSpheres for boxes
+void CullAABBs(const Plane* planes, size_t planeCount, const AABBArrays& boxes, uint8_t* visible, size_t count);
+
+/**
+ *	distances[i] is where the ray enters box i, 0 when the origin is inside, or Math::Infinity when it misses or only hits beyond maxDistance.
+ *	The same results as Intersects(ray, box, distance), including rays grazing a face of the box.
+ */
+void IntersectRayAABBs(const Ray& ray, float maxDistance, const AABBArrays& boxes, float* distances, size_t count);
+
+}
@@ -1 +1,193 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
 #pragma once
+
+#include "Plane.h"
+#include "Sphere.h"
+#include "Math/Matrix3.h"
+
+namespace novus
+{
+
+namespace detail
+{
+	//Per component Math::Min and Math::Max, which return b when either is NaN like minps and maxps
+	inline Vector3 Min3(const Vector3& a, const Vector3& b)
+	{
+		return Vector3(Math::Min(a.x, b.x), Math::Min(a.y, b.y), Math::Min(a.z, b.z));
+	}
+
+	inline Vector3 Max3(const Vector3& a, const Vector3& b)
+	{
+		return Vector3(Math::Max(a.x, b.x), Math::Max(a.y, b.y), Math::Max(a.z, b.z));
+	}
+
+	inline Vector3 Abs3(const Vector3& v)
+	{
+		return Vector3(std::fabs(v.x), std::fabs(v.y), std::fabs(v.z));
+	}
+}
+
+/**
+ *	Axis aligned box between Min and Max. A box with Min > Max on any axis is empty, contains nothing and intersects nothing.
+ */
+struct AABB
+{
+	Vector3 Min;
+	Vector3 Max;
+
+	//Empty, merging anything into it gives that thing's bounds
+	AABB()
+		: Min(Math::Infinity), Max(-Math::Infinity)
+	{}
+
+	AABB(const Vector3& min, const Vector3& max)
+		: Min(min), Max(max)
+	{}
+
+	static AABB FromCenterExtents(const Vector3& center, const Vector3& extents)
+	{
+		return AABB(center - extents, center + extents);
+	}
+
+	Vector3 GetCenter() const { return (Min + Max) * 0.5f; }
+
+	//Half the size on each axis
+	Vector3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+	bool IsEmpty() const
+	{
+		return ((Min.x > Max.x) | (Min.y > Max.y) | (Min.z > Max.z)) != 0;
+	}
+
+	bool Contains(const Vector3& p) const
+	{
+		return ((p.x >= Min.x) & (p.x <= Max.x) & (p.y >= Min.y) & (p.y <= Max.y) & (p.z >= Min.z) & (p.z <= Max.z)) != 0;
+	}
+
+	bool Contains(const AABB& box) const
+	{
+		return ((box.Min.x >= Min.x) & (box.Max.x <= Max.x) & (box.Min.y >= Min.y) & (box.Max.y <= Max.y) & (box.Min.z >= Min.z) & (box.Max.z <= Max.z)) != 0;
+	}
+
+	bool Intersects(const AABB& box) const
+	{
+		return ((box.Min.x <= Max.x) & (box.Max.x >= Min.x) & (box.Min.y <= Max.y) & (box.Max.y >= Min.y) & (box.Min.z <= Max.z) & (box.Max.z >= Min.z)) != 0;
+	}
+
+	bool Intersects(const Sphere& sphere) const
+	{
+		const Vector3 closest = detail::Min3(detail::Max3(sphere.Center, Min), Max);
+		return LengthSq(closest - sphere.Center) <= sphere.Radius * sphere.Radius;
+	}
+
+	void Merge(const Vector3& p)
+	{
+		Min = detail::Min3(Min, p);
+		Max = detail::Max3(Max, p);
+	}
+
+	void Merge(const AABB& box)
+	{
+		Min = detail::Min3(Min, box.Min);
+		Max = detail::Max3(Max, box.Max);
+	}
+
+	/**
+	 *	Bounds of the box transformed by an affine matrix, by Arvo's method of summing the extents of the rotated axes
+	 */
+	static AABB Transform(const AABB& box, const Matrix4& m)
+	{
+		const Vector3 center = box.GetCenter();
+		const Vector3 extents = box.GetExtents();
+
+		const Vector3 newCenter = Vector3(Vector4(center, 1.0f) * m);
+		const Vector3 newExtents =
+			detail::Abs3(Vector3(m[0])) * extents.x +
+			detail::Abs3(Vector3(m[1])) * extents.y +
+			detail::Abs3(Vector3(m[2])) * extents.z;
+
+		return FromCenterExtents(newCenter, newExtents);
+	}
+};
+
+/**
+ *	Box with its own orientation. Row i of Orientation is the direction of local axis i in world space, so local * Orientation + Center is a world position.
+ *	Orientation must be a rotation.
+ */
+struct OBB
+{
+	Vector3 Center;
+	Vector3 Extents;
+	Matrix3 Orientation;
+
+	OBB()
+		: Orientation(1.0f)
+	{}
+
+	OBB(const Vector3& center, const Vector3& extents, const Matrix3& orientation)
+		: Center(center), Extents(extents), Orientation(orientation)
+	{}
+
+	/**
+	 *	box transformed by a rotation, uniform or non-uniform scale and translation. Shear is not representable and is dropped.
+	 */
+	static OBB FromAABB(const AABB& box, const Matrix4& m)
+	{
+		const Vector3 center = Vector3(Vector4(box.GetCenter(), 1.0f) * m);
+		const Vector3 extents = box.GetExtents();
+
+		Vector3 axes[3] = { Vector3(m[0]), Vector3(m[1]), Vector3(m[2]) };
+		const Vector3 scale(Length(axes[0]), Length(axes[1]), Length(axes[2]));
+
+		return OBB(center, extents * scale, Matrix3(axes[0] / scale.x, axes[1] / scale.y, axes[2] / scale.z));
+	}
+
+	//World position p in the box's local frame, centered at the origin
+	Vector3 ToLocal(const Vector3& p) const
+	{
+		return Orientation * (p - Center);
+	}
+
+	bool Contains(const Vector3& p) const
+	{
+		const Vector3 local = detail::Abs3(ToLocal(p));
+		return ((local.x <= Extents.x) & (local.y <= Extents.y) & (local.z <= Extents.z)) != 0;
+	}
+
+	//Bounds in world space
+	AABB GetBounds() const
+	{
+		const Vector3 extents =
+			detail::Abs3(Orientation[0]) * Extents.x +
+			detail::Abs3(Orientation[1]) * Extents.y +
+			detail::Abs3(Orientation[2]) * Extents.z;
+
+		return AABB::FromCenterExtents(Center, extents);
+	}
+};
+
+/**
+ *	A box is as far in front of a plane as its center, minus its extents projected onto the normal
+ */
+inline PlaneSide Classify(const Plane& plane, const AABB& box)
+{
+	const Vector3 extents = box.GetExtents();
+	const Vector3 n = detail::Abs3(plane.Normal);
+
+	return ClassifyDistance(plane.SignedDistance(box.GetCenter()), n.x * extents.x + n.y * extents.y + n.z * extents.z);
+}
+
+inline PlaneSide Classify(const Plane& plane, const OBB& box)
+{
+	const Vector3 n = detail::Abs3(box.Orientation * plane.Normal);
+
+	return ClassifyDistance(plane.SignedDistance(box.Center), n.x * box.Extents.x + n.y * box.Extents.y + n.z * box.Extents.z);
+}
+
+}
@@ -1 +1,89 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
 #pragma once
+
+#include "Ray.h"
+
+namespace novus
+{
+
+/**
+ *	Segment from Start to End, positions along it are t in [0, 1]
+ */
+struct LineSegment
+{
+	Vector3 Start;
+	Vector3 End;
+
+	LineSegment()
+	{}
+
+	LineSegment(const Vector3& start, const Vector3& end)
+		: Start(start), End(end)
+	{}
+
+	Vector3 GetDirection() const { return End - Start; }
+
+	float GetLength() const { return Length(End - Start); }
+
+	Vector3 GetPoint(float t) const
+	{
+		return Start + (End - Start) * t;
+	}
+
+	//t of the point on the segment closest to p
+	float ClosestParameter(const Vector3& p) const
+	{
+		const Vector3 direction = End - Start;
+		const float lengthSq = LengthSq(direction);
+
+		//A degenerate segment is its start point
+		const float t = Dot(p - Start, direction) / Math::Max(lengthSq, FLT_MIN);
+		return Math::Clamp(t, 0.0f, 1.0f);
+	}
+
+	Vector3 ClosestPoint(const Vector3& p) const
+	{
+		return GetPoint(ClosestParameter(p));
+	}
+
+	float DistanceSq(const Vector3& p) const
+	{
+		return LengthSq(ClosestPoint(p) - p);
+	}
+};
+
+/**
+ *	True if the segment touches the box, t is where it enters
+ */
+inline bool Intersects(const LineSegment& segment, const AABB& box, float& t)
+{
+	return detail::IntersectSlabs(segment.Start, detail::Reciprocal(segment.GetDirection()), box, 0.0f, 1.0f, t);
+}
+
+inline bool Intersects(const LineSegment& segment, const Sphere& sphere)
+{
+	return segment.DistanceSq(sphere.Center) <= sphere.Radius * sphere.Radius;
+}
+
+/**
+ *	True if the end points are on opposite sides of the plane or one is on it, t is where it crosses.
+ *	A segment lying in the plane gives t = 0.
+ */
+inline bool Intersects(const LineSegment& segment, const Plane& plane, float& t)
+{
+	const float startDistance = plane.SignedDistance(segment.Start);
+	const float endDistance = plane.SignedDistance(segment.End);
+
+	const float denominator = startDistance - endDistance;
+	t = denominator != 0.0f ? startDistance / denominator : 0.0f;
+
+	return startDistance * endDistance <= 0.0f;
+}
+
+}
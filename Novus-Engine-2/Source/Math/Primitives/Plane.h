@@ -1 +1,111 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
 #pragma once
+
+#include <cmath>
+#include "Math/Math.h"
+#include "Math/Vector3.h"
+#include "Math/Matrix4.h"
+
+/**
+ *	Geometric primitives for culling and picking, in Plane.h, Sphere.h, Box.h, Ray.h, LineSegment.h and Rectangle.h.
+ *
+ *	The intersection and containment tests have no data dependent branches, min and max become single instructions and
+ *	the comparisons are combined with & instead of &&, so they cost the same on every input and inline into tight loops.
+ *	BatchIntersection.h runs the culling and ray tests over arrays of primitives, 4 and 8 at a time.
+ */
+
+namespace novus
+{
+
+enum class PlaneSide : int
+{
+	Back = -1,
+	Intersecting = 0,
+	Front = 1
+};
+
+/**
+ *	The points p where Dot(Normal, p) + D == 0, Normal points to the front side.
+ *	The tests treat the normal as unit length, so distances are in world units.
+ */
+struct Plane
+{
+	Vector3 Normal;
+	float D;
+
+	Plane()
+		: Normal(0.0f, 1.0f, 0.0f), D(0.0f)
+	{}
+
+	Plane(const Vector3& normal, float d)
+		: Normal(normal), D(d)
+	{}
+
+	//normal does not need to be unit length
+	static Plane FromPointNormal(const Vector3& point, const Vector3& normal)
+	{
+		const Vector3 n = Normalize(normal);
+		return Plane(n, -Dot(n, point));
+	}
+
+	//The front side is the one a, b and c are clockwise from, like the front faces of D3D's default culling
+	static Plane FromPoints(const Vector3& a, const Vector3& b, const Vector3& c)
+	{
+		return FromPointNormal(a, Cross(b - a, c - a));
+	}
+
+	Plane Normalized() const
+	{
+		const float inverseLength = 1.0f / Length(Normal);
+		return Plane(Normal * inverseLength, D * inverseLength);
+	}
+
+	float SignedDistance(const Vector3& p) const
+	{
+		return Dot(Normal, p) + D;
+	}
+
+	Vector3 ClosestPoint(const Vector3& p) const
+	{
+		return p - Normal * SignedDistance(p);
+	}
+};
+
+/**
+ *	Front when distance > radius, Back when distance < -radius, otherwise Intersecting
+ */
+inline PlaneSide ClassifyDistance(float distance, float radius)
+{
+	return static_cast<PlaneSide>(static_cast<int>(distance > radius) - static_cast<int>(distance < -radius));
+}
+
+/**
+ *	The six planes of a view frustum with their normals pointing inside, left, right, bottom, top, near and far.
+ *	viewProj transforms row vectors to D3D clip space with z in [0, w]. The planes are in the space viewProj transforms from,
+ *	world space for a view projection matrix.
+ */
+inline void ExtractFrustumPlanes(const Matrix4& viewProj, Plane (&planes)[6])
+{
+	//Gribb and Hartmann, each plane is a sum or difference of columns of the matrix
+	for (int i = 0; i < 6; i++)
+	{
+		const int column = i < 4 ? i / 2 : 2;
+		const float sign = (i & 1) ? -1.0f : 1.0f;
+		const float w = i == 4 ? 0.0f : 1.0f;
+
+		Vector4 coefficients;
+
+		for (int row = 0; row < 4; row++)
+			coefficients[row] = viewProj[row][3] * w + viewProj[row][column] * sign;
+
+		planes[i] = Plane(Vector3(coefficients.x, coefficients.y, coefficients.z), coefficients.w).Normalized();
+	}
+}
+
+}
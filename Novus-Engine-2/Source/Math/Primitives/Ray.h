@@ -1 +1,111 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
 #pragma once
+
+#include "Plane.h"
+#include "Sphere.h"
+#include "Box.h"
+
+namespace novus
+{
+
+/**
+ *	Half line from Origin along Direction. Distances returned by the tests are in multiples of Direction,
+ *	world units when it is normalized.
+ */
+struct Ray
+{
+	Vector3 Origin;
+	Vector3 Direction;
+
+	Ray()
+		: Direction(0.0f, 0.0f, 1.0f)
+	{}
+
+	Ray(const Vector3& origin, const Vector3& direction)
+		: Origin(origin), Direction(direction)
+	{}
+
+	Vector3 GetPoint(float distance) const
+	{
+		return Origin + Direction * distance;
+	}
+};
+
+namespace detail
+{
+	/**
+	 *	Slab test of the line origin + t / inverseDirection against a box, clipped to [tMin, tMax].
+	 *	A zero direction component makes its reciprocal infinite so that axis never clips the line unless the origin is outside its slab.
+	 *	An origin exactly on one of that axis' faces gives 0 * infinity = NaN, which Math::Min and Math::Max resolve by operand order:
+	 *	on the Max face the NaN is dropped and the axis doesn't clip, on the Min face the entry becomes infinite and the line misses.
+	 *	So a line grazing the box along its Max face hits and one along its Min face misses, for either sign of zero.
+	 */
+	inline bool IntersectSlabs(const Vector3& origin, const Vector3& inverseDirection, const AABB& box, float tMin, float tMax, float& tNear)
+	{
+		const Vector3 t1 = (box.Min - origin) * inverseDirection;
+		const Vector3 t2 = (box.Max - origin) * inverseDirection;
+
+		const Vector3 entry = Min3(t1, t2);
+		const Vector3 exit = Max3(t1, t2);
+
+		tNear = Math::Max(Math::Max(entry.x, entry.y), Math::Max(entry.z, tMin));
+		const float tFar = Math::Min(Math::Min(exit.x, exit.y), Math::Min(exit.z, tMax));
+
+		return tNear <= tFar;
+	}
+
+	inline Vector3 Reciprocal(const Vector3& v)
+	{
+		return Vector3(1.0f / v.x, 1.0f / v.y, 1.0f / v.z);
+	}
+}
+
+/**
+ *	True if the ray hits the box, distance is where it enters, 0 when the origin is inside.
+ *	A ray running along a face of the box hits on the Max face and misses on the Min face, see detail::IntersectSlabs.
+ */
+inline bool Intersects(const Ray& ray, const AABB& box, float& distance)
+{
+	return detail::IntersectSlabs(ray.Origin, detail::Reciprocal(ray.Direction), box, 0.0f, Math::Infinity, distance);
+}
+
+inline bool Intersects(const Ray& ray, const OBB& box, float& distance)
+{
+	//Slab test in the box's frame, the rotation keeps distances the same
+	const Ray local(box.ToLocal(ray.Origin), box.Orientation * ray.Direction);
+	return Intersects(local, AABB(-box.Extents, box.Extents), distance);
+}
+
+inline bool Intersects(const Ray& ray, const Sphere& sphere, float& distance)
+{
+	//Roots of |origin + t * direction - center|^2 = radius^2, the nearer one clamped to 0 when the origin is inside
+	const Vector3 offset = ray.Origin - sphere.Center;
+	const float a = LengthSq(ray.Direction);
+	const float b = Dot(offset, ray.Direction);
+	const float c = LengthSq(offset) - sphere.Radius * sphere.Radius;
+	const float discriminant = b * b - a * c;
+
+	const float root = std::sqrt(Math::Max(discriminant, 0.0f));
+	distance = Math::Max((-b - root) / a, 0.0f);
+
+	return ((discriminant >= 0.0f) & (-b + root >= 0.0f)) != 0;
+}
+
+/**
+ *	True if the ray crosses the plane from either side, a ray lying in the plane does not
+ */
+inline bool Intersects(const Ray& ray, const Plane& plane, float& distance)
+{
+	const float approach = Dot(plane.Normal, ray.Direction);
+	distance = -plane.SignedDistance(ray.Origin) / approach;
+
+	return ((approach != 0.0f) & (distance >= 0.0f)) != 0;
+}
+
+}
@@ -1 +1,84 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
 #pragma once
+
+#include "Math/Math.h"
+#include "Math/Vector2.h"
+
+namespace novus
+{
+
+/**
+ *	Axis aligned rectangle between Min and Max, for screen space bounds, viewports and UI.
+ *	Named Rect since windows.h declares a Rectangle function.
+ */
+struct Rect
+{
+	Vector2 Min;
+	Vector2 Max;
+
+	//Empty, merging anything into it gives that thing's bounds
+	Rect()
+		: Min(Math::Infinity), Max(-Math::Infinity)
+	{}
+
+	Rect(const Vector2& min, const Vector2& max)
+		: Min(min), Max(max)
+	{}
+
+	Rect(float left, float top, float width, float height)
+		: Min(left, top), Max(left + width, top + height)
+	{}
+
+	float GetWidth() const { return Max.x - Min.x; }
+	float GetHeight() const { return Max.y - Min.y; }
+	Vector2 GetSize() const { return Max - Min; }
+	Vector2 GetCenter() const { return (Min + Max) * 0.5f; }
+
+	bool IsEmpty() const
+	{
+		return ((Min.x > Max.x) | (Min.y > Max.y)) != 0;
+	}
+
+	bool Contains(const Vector2& p) const
+	{
+		return ((p.x >= Min.x) & (p.x <= Max.x) & (p.y >= Min.y) & (p.y <= Max.y)) != 0;
+	}
+
+	bool Contains(const Rect& r) const
+	{
+		return ((r.Min.x >= Min.x) & (r.Max.x <= Max.x) & (r.Min.y >= Min.y) & (r.Max.y <= Max.y)) != 0;
+	}
+
+	bool Intersects(const Rect& r) const
+	{
+		return ((r.Min.x <= Max.x) & (r.Max.x >= Min.x) & (r.Min.y <= Max.y) & (r.Max.y >= Min.y)) != 0;
+	}
+
+	void Merge(const Vector2& p)
+	{
+		Min = Vector2(Math::Min(Min.x, p.x), Math::Min(Min.y, p.y));
+		Max = Vector2(Math::Max(Max.x, p.x), Math::Max(Max.y, p.y));
+	}
+
+	void Merge(const Rect& r)
+	{
+		Min = Vector2(Math::Min(Min.x, r.Min.x), Math::Min(Min.y, r.Min.y));
+		Max = Vector2(Math::Max(Max.x, r.Max.x), Math::Max(Max.y, r.Max.y));
+	}
+
+	//Overlap of two rectangles, empty if they don't intersect
+	static Rect Intersection(const Rect& a, const Rect& b)
+	{
+		return Rect(
+			Vector2(Math::Max(a.Min.x, b.Min.x), Math::Max(a.Min.y, b.Min.y)),
+			Vector2(Math::Min(a.Max.x, b.Max.x), Math::Min(a.Max.y, b.Max.y)));
+	}
+};
+
+}
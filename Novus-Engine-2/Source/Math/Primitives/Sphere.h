@@ -1 +1,69 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
 #pragma once
+
+#include "Plane.h"
+
+namespace novus
+{
+
+struct Sphere
+{
+	Vector3 Center;
+	float Radius;
+
+	Sphere()
+		: Radius(0.0f)
+	{}
+
+	Sphere(const Vector3& center, float radius)
+		: Center(center), Radius(radius)
+	{}
+
+	bool Contains(const Vector3& p) const
+	{
+		return LengthSq(p - Center) <= Radius * Radius;
+	}
+
+	bool Contains(const Sphere& s) const
+	{
+		const float radiusDifference = Radius - s.Radius;
+		return ((radiusDifference >= 0.0f) & (LengthSq(s.Center - Center) <= radiusDifference * radiusDifference)) != 0;
+	}
+
+	bool Intersects(const Sphere& s) const
+	{
+		const float radiusSum = Radius + s.Radius;
+		return LengthSq(s.Center - Center) <= radiusSum * radiusSum;
+	}
+
+	//Smallest sphere containing both
+	static Sphere Merge(const Sphere& a, const Sphere& b);
+};
+
+inline PlaneSide Classify(const Plane& plane, const Sphere& sphere)
+{
+	return ClassifyDistance(plane.SignedDistance(sphere.Center), sphere.Radius);
+}
+
+inline Sphere Sphere::Merge(const Sphere& a, const Sphere& b)
+{
+	const Vector3 offset = b.Center - a.Center;
+	const float distance = Length(offset);
+
+	if (distance + b.Radius <= a.Radius)
+		return a;
+
+	if (distance + a.Radius <= b.Radius)
+		return b;
+
+	const float radius = (distance + a.Radius + b.Radius) * 0.5f;
+	return Sphere(a.Center + offset * ((radius - a.Radius) / distance), radius);
+}
+
+}
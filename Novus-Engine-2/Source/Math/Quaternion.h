@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cmath>
+
 namespace novus
 {
 	template <typename T> struct Vector2_t;
@@ -26,17 +28,17 @@ namespace novus
 	{
 		T x, y, z, w;
 
-		Quaternion_t();
+		constexpr Quaternion_t();
 
-		Quaternion_t(const T& a, const T& b, const T& c, const T& d);
+		constexpr Quaternion_t(const T& a, const T& b, const T& c, const T& d);
 
 		//Quaternion_t(const Matrix3x3_t<T>& rotationMat);
 
 		template <typename B>
-		Quaternion_t(const Quaternion_t<B>& q);
+		constexpr Quaternion_t(const Quaternion_t<B>& q);
 
 		template <typename B>
-		Quaternion_t(const Vector4_t<B>& v);
+		constexpr Quaternion_t(const Vector4_t<B>& v);
 
 		Quaternion_t<T>& operator= (const Quaternion_t<T>& q);
 
@@ -48,60 +50,63 @@ namespace novus
 		static T Magnitude(const Quaternion_t<T>& q);
 		static Quaternion_t<T> Normalize(const Quaternion_t<T>& q);
 
-		static T Dot(const Quaternion_t<T>& q1, const Quaternion_t<T>& q2);
+		static constexpr T Dot(const Quaternion_t<T>& q1, const Quaternion_t<T>& q2);
 
 		static Quaternion_t<T> AxisAngle(const Vector3_t<T>& axis, const T& radians);
-		static Matrix4x4_t<T> ToMatrix(const Quaternion_t<T>& q);
+		static constexpr Matrix4x4_t<T> ToMatrix(const Quaternion_t<T>& q);
 		static Quaternion_t<T> FromMatrix(const Matrix3x3_t<T>& mat);
 		static Quaternion_t<T> FromMatrix(const Matrix4x4_t<T>& mat);
 
 		static Quaternion_t<T> Slerp(const Quaternion_t<T>& q1, const Quaternion_t<T>& q2, const T& t);
+
+		//Normalized linear interpolation along the shortest path, cheaper than Slerp but the angular speed is not constant
+		static Quaternion_t<T> Nlerp(const Quaternion_t<T>& q1, const Quaternion_t<T>& q2, const T& t);
 	};
 
 	template <typename T>
-	Quaternion_t<T> operator- (const Quaternion_t<T>& q);
+	constexpr Quaternion_t<T> operator- (const Quaternion_t<T>& q);
 
 	template <typename T>
-	Quaternion_t<T> operator* (const Quaternion_t<T>& q1, const Quaternion_t<T>& q2);
+	constexpr Quaternion_t<T> operator* (const Quaternion_t<T>& q1, const Quaternion_t<T>& q2);
 
 	template <typename T>
-	Quaternion_t<T> operator* (const Quaternion_t<T>& q, const T& s);
+	constexpr Quaternion_t<T> operator* (const Quaternion_t<T>& q, const T& s);
 
 	template <typename T>
-	Quaternion_t<T> operator* (const T& s, const Quaternion_t<T>& q);
+	constexpr Quaternion_t<T> operator* (const T& s, const Quaternion_t<T>& q);
 
 	template <typename T>
-	Quaternion_t<T> operator/ (const Quaternion_t<T>& q, const T& s);
+	constexpr Quaternion_t<T> operator/ (const Quaternion_t<T>& q, const T& s);
 
 	template <typename T>
-	bool operator== (const Quaternion_t<T>& q1, const Quaternion_t<T>& q2);
+	constexpr bool operator== (const Quaternion_t<T>& q1, const Quaternion_t<T>& q2);
 
 	template <typename T>
-	bool operator!= (const Quaternion_t<T>& q1, const Quaternion_t<T>& q2);
+	constexpr bool operator!= (const Quaternion_t<T>& q1, const Quaternion_t<T>& q2);
 
 }
 
 namespace novus
 {
 	template <typename T>
-	Quaternion_t<T>::Quaternion_t()
+	constexpr Quaternion_t<T>::Quaternion_t()
 		: x(0), y(0), z(0), w(1)
 	{}
 
 	template <typename T>
-	Quaternion_t<T>::Quaternion_t(const T& a, const T& b, const T& c, const T& d)
+	constexpr Quaternion_t<T>::Quaternion_t(const T& a, const T& b, const T& c, const T& d)
 		: x(a), y(b), z(c), w(d)
 	{}
 
 	template <typename T>
 	template <typename B>
-	Quaternion_t<T>::Quaternion_t(const Quaternion_t<B>& q)
+	constexpr Quaternion_t<T>::Quaternion_t(const Quaternion_t<B>& q)
 		: x(static_cast<T>(q.x)), y(static_cast<T>(q.y)), z(static_cast<T>(q.z)), w(static_cast<T>(q.w))
 	{}
 
 	template <typename T>
 	template <typename B>
-	Quaternion_t<T>::Quaternion_t(const Vector4_t<B>& v)
+	constexpr Quaternion_t<T>::Quaternion_t(const Vector4_t<B>& v)
 		: x(static_cast<T>(v.x)), y(static_cast<T>(v.y)), z(static_cast<T>(v.z)), w(static_cast<T>(v.w))
 	{}
 
@@ -148,15 +153,13 @@ namespace novus
 	}
 
 	template <typename T>
-	Quaternion_t<T> operator- (const Quaternion_t<T>& q)
+	constexpr Quaternion_t<T> operator- (const Quaternion_t<T>& q)
 	{
-		const T q2 = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
-
-		return Quaternion_t<T>(-q.x / q2, -q.y / q2, -q.z / q2, q.w / q2);
+		return Quaternion_t<T>(-q.x, -q.y, -q.z, q.w) / Quaternion_t<T>::Dot(q, q);
 	}
 
 	template <typename T>
-	Quaternion_t<T> operator* (const Quaternion_t<T>& q1, const Quaternion_t<T>& q2)
+	constexpr Quaternion_t<T> operator* (const Quaternion_t<T>& q1, const Quaternion_t<T>& q2)
 	{
 		return Quaternion_t<T>(
 			q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y,
@@ -166,19 +169,19 @@ namespace novus
 	}
 
 	template <typename T>
-	Quaternion_t<T> operator* (const Quaternion_t<T>& q, const T& s)
+	constexpr Quaternion_t<T> operator* (const Quaternion_t<T>& q, const T& s)
 	{
 		return Quaternion_t<T>(q.x * s, q.y * s, q.z * s, q.w * s);
 	}
 
 	template <typename T>
-	Quaternion_t<T> operator* (const T& s, const Quaternion_t<T>& q)
+	constexpr Quaternion_t<T> operator* (const T& s, const Quaternion_t<T>& q)
 	{
 		return Quaternion_t<T>(q.x * s, q.y * s, q.z * s, q.w * s);
 	}
 
 	template <typename T>
-	Quaternion_t<T> operator/ (const Quaternion_t<T>& q, const T& s)
+	constexpr Quaternion_t<T> operator/ (const Quaternion_t<T>& q, const T& s)
 	{
 		return Quaternion_t<T>(q.x / s, q.y / s, q.z / s, q.w / s);
 	}
@@ -192,11 +195,11 @@ namespace novus
 	template <typename T>
 	Quaternion_t<T> Quaternion_t<T>::Normalize(const Quaternion_t<T>& q)
 	{
-		return q / sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+		return q / static_cast<T>(sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w));
 	}
 
 	template <typename T>
-	T Quaternion_t<T>::Dot(const Quaternion_t<T>& q1, const Quaternion_t<T>& q2)
+	constexpr T Quaternion_t<T>::Dot(const Quaternion_t<T>& q1, const Quaternion_t<T>& q2)
 	{
 		return q1.x * q2.x + q1.y *q2.y + q1.z * q2.z + q1.w * q2.w;
 	}
@@ -215,7 +218,7 @@ namespace novus
 	}
 
 	template <typename T>
-	Matrix4x4_t<T> Quaternion_t<T>::ToMatrix(const Quaternion_t<T>& q)
+	constexpr Matrix4x4_t<T> Quaternion_t<T>::ToMatrix(const Quaternion_t<T>& q)
 	{
 		return Matrix4x4_t<T>(
 			1 - 2 * q.y*q.y - 2 * q.z*q.z, 2 * q.x*q.y - 2 * q.w*q.z, 2 * q.x*q.z + 2 * q.w*q.y, 0,
@@ -309,19 +312,63 @@ namespace novus
 	Quaternion_t<T> Quaternion_t<T>::Slerp(const Quaternion_t<T>& q1, const Quaternion_t<T>& q2, const T& t)
 	{
 		T cosAngle = Dot(q1, q2);
-		T sinAngle = sqrt(1 - cosAngle * cosAngle);
+		T sign = static_cast<T>(1);
+
+		//Interpolate along the shortest path
+		if (cosAngle < static_cast<T>(0))
+		{
+			cosAngle = -cosAngle;
+			sign = static_cast<T>(-1);
+		}
+
+		T scale1 = static_cast<T>(1) - t;
+		T scale2 = t;
+
+		//Fall back to a normalized lerp when the rotations are close enough that the sine of the angle is unstable
+		if (cosAngle < static_cast<T>(0.9995))
+		{
+			const T angle = acos(cosAngle);
+			const T invSinAngle = static_cast<T>(1) / sin(angle);
+
+			scale1 = sin((static_cast<T>(1) - t) * angle) * invSinAngle;
+			scale2 = sin(t * angle) * invSinAngle;
+		}
 
-		return (sinAngle * (1 - t) / sinAngle) * q1 + (sinAngle * t / sinAngle) * q2;
+		scale2 *= sign;
+
+		Quaternion_t<T> result(
+			scale1 * q1.x + scale2 * q2.x,
+			scale1 * q1.y + scale2 * q2.y,
+			scale1 * q1.z + scale2 * q2.z,
+			scale1 * q1.w + scale2 * q2.w);
+
+		if (cosAngle >= static_cast<T>(0.9995))
+			result = Normalize(result);
+
+		return result;
+	}
+
+	template <typename T>
+	Quaternion_t<T> Quaternion_t<T>::Nlerp(const Quaternion_t<T>& q1, const Quaternion_t<T>& q2, const T& t)
+	{
+		const T scale1 = static_cast<T>(1) - t;
+		const T scale2 = Dot(q1, q2) < static_cast<T>(0) ? -t : t;
+
+		return Normalize(Quaternion_t<T>(
+			scale1 * q1.x + scale2 * q2.x,
+			scale1 * q1.y + scale2 * q2.y,
+			scale1 * q1.z + scale2 * q2.z,
+			scale1 * q1.w + scale2 * q2.w));
 	}
 
 	template <typename T>
-	bool operator== (const Quaternion_t<T>& q1, const Quaternion_t<T>& q2)
+	constexpr bool operator== (const Quaternion_t<T>& q1, const Quaternion_t<T>& q2)
 	{
 		return !(q1.x != q2.x || q1.y != q2.y || q1.z != q2.z || q1.w != q2.w);
 	}
 
 	template <typename T>
-	bool operator!= (const Quaternion_t<T>& q1, const Quaternion_t<T>& q2)
+	constexpr bool operator!= (const Quaternion_t<T>& q1, const Quaternion_t<T>& q2)
 	{
 		return q1.x != q2.x || q1.y != q2.y || q1.z != q2.z || q1.w != q2.w;
 	}
@@ -0,0 +1,357 @@
+#include "QuaternionBatch.h"
+#include "MathSIMD.h"
+#include <cmath>
+#include <cstring>
+
+namespace novus
+{
+
+static_assert(sizeof(Matrix3x4) == 12 * sizeof(float), "Matrices are written as 12 packed floats");
+
+namespace
+{
+	/**
+	 *	The kernels are written once against these wrappers and process LaneCount quaternions per step,
+	 *	four in the SIMD builds and one in NE_MATH_NO_SIMD builds, so both give the same results.
+	 */
+#if NE_MATH_SSE || NE_MATH_NEON
+	typedef simd::Float4 Lanes;
+	const size_t LaneCount = 4;
+
+	inline Lanes LoadLanes(const float* p) { return simd::Load4(p); }
+	inline void StoreLanes(float* p, Lanes v) { simd::Store4(p, v); }
+	inline Lanes SetLanes(float s) { return simd::Set1(s); }
+
+	using simd::Add;
+	using simd::Sub;
+	using simd::Mul;
+	using simd::MulAdd;
+	using simd::Div;
+	using simd::Sqrt;
+	using simd::Min;
+	using simd::Less;
+	using simd::Select;
+#else
+	typedef float Lanes;
+	const size_t LaneCount = 1;
+
+	inline Lanes LoadLanes(const float* p) { return *p; }
+	inline void StoreLanes(float* p, Lanes v) { *p = v; }
+	inline Lanes SetLanes(float s) { return s; }
+
+	inline float Add(float a, float b) { return a + b; }
+	inline float Sub(float a, float b) { return a - b; }
+	inline float Mul(float a, float b) { return a * b; }
+	inline float MulAdd(float a, float b, float c) { return a * b + c; }
+	inline float Div(float a, float b) { return a / b; }
+	inline float Sqrt(float v) { return std::sqrt(v); }
+	inline float Min(float a, float b) { return a < b ? a : b; }
+
+	//Masks are plain bools with one lane
+	inline bool Less(float a, float b) { return a < b; }
+	inline float Select(bool mask, float a, float b) { return mask ? a : b; }
+#endif
+
+	struct QuaternionLanes
+	{
+		Lanes X, Y, Z, W;
+	};
+
+	inline QuaternionLanes Load(const ConstQuaternionArrays& q, size_t i)
+	{
+		QuaternionLanes result;
+		result.X = LoadLanes(q.X + i);
+		result.Y = LoadLanes(q.Y + i);
+		result.Z = LoadLanes(q.Z + i);
+		result.W = LoadLanes(q.W + i);
+		return result;
+	}
+
+	inline void Store(const QuaternionArrays& q, size_t i, const QuaternionLanes& v)
+	{
+		StoreLanes(q.X + i, v.X);
+		StoreLanes(q.Y + i, v.Y);
+		StoreLanes(q.Z + i, v.Z);
+		StoreLanes(q.W + i, v.W);
+	}
+
+	/**
+	 *	Copies the last count % LaneCount elements into full width arrays so the tail goes through the same kernel.
+	 *	Unused lanes hold identity quaternions so nothing in them divides by zero.
+	 */
+	struct TailQuaternions
+	{
+		float X[LaneCount];
+		float Y[LaneCount];
+		float Z[LaneCount];
+		float W[LaneCount];
+
+		TailQuaternions()
+		{
+			for (size_t lane = 0; lane < LaneCount; lane++)
+			{
+				X[lane] = 0.0f;
+				Y[lane] = 0.0f;
+				Z[lane] = 0.0f;
+				W[lane] = 1.0f;
+			}
+		}
+
+		TailQuaternions(const ConstQuaternionArrays& q, size_t i, size_t count)
+			: TailQuaternions()
+		{
+			memcpy(X, q.X + i, count * sizeof(float));
+			memcpy(Y, q.Y + i, count * sizeof(float));
+			memcpy(Z, q.Z + i, count * sizeof(float));
+			memcpy(W, q.W + i, count * sizeof(float));
+		}
+
+		ConstQuaternionArrays GetConst() const { return ConstQuaternionArrays(X, Y, Z, W); }
+		QuaternionArrays Get() { QuaternionArrays q = { X, Y, Z, W }; return q; }
+
+		void CopyTo(const QuaternionArrays& q, size_t i, size_t count) const
+		{
+			memcpy(q.X + i, X, count * sizeof(float));
+			memcpy(q.Y + i, Y, count * sizeof(float));
+			memcpy(q.Z + i, Z, count * sizeof(float));
+			memcpy(q.W + i, W, count * sizeof(float));
+		}
+	};
+
+	/**
+	 *	Stores kernel(q1, q2, t) for every full group of lanes, then once more for the remaining elements through padded copies.
+	 *	A null t is the uniform value tValue.
+	 */
+	template <typename TKernel>
+	void ForEachLaneGroup(const ConstQuaternionArrays& q1, const ConstQuaternionArrays& q2, const float* t, float tValue,
+		const QuaternionArrays& out, size_t count, TKernel kernel)
+	{
+		const Lanes uniformT = SetLanes(tValue);
+
+		size_t i = 0;
+		for (; i + LaneCount <= count; i += LaneCount)
+			Store(out, i, kernel(Load(q1, i), Load(q2, i), t ? LoadLanes(t + i) : uniformT));
+
+		const size_t remaining = count - i;
+		if (remaining > 0)
+		{
+			const TailQuaternions tail1(q1, i, remaining);
+			const TailQuaternions tail2(q2, i, remaining);
+
+			float tailT[LaneCount];
+			for (size_t lane = 0; lane < LaneCount; lane++)
+				tailT[lane] = (t && lane < remaining) ? t[i + lane] : tValue;
+
+			TailQuaternions tailOut;
+			Store(tailOut.Get(), 0, kernel(Load(tail1.GetConst(), 0), Load(tail2.GetConst(), 0), LoadLanes(tailT)));
+			tailOut.CopyTo(out, i, remaining);
+		}
+	}
+
+	inline Lanes Dot(const QuaternionLanes& q1, const QuaternionLanes& q2)
+	{
+		return MulAdd(q1.X, q2.X, MulAdd(q1.Y, q2.Y, MulAdd(q1.Z, q2.Z, Mul(q1.W, q2.W))));
+	}
+
+	inline QuaternionLanes Normalize(const QuaternionLanes& q)
+	{
+		const Lanes invLength = Div(SetLanes(1.0f), Sqrt(Dot(q, q)));
+
+		QuaternionLanes result;
+		result.X = Mul(q.X, invLength);
+		result.Y = Mul(q.Y, invLength);
+		result.Z = Mul(q.Z, invLength);
+		result.W = Mul(q.W, invLength);
+		return result;
+	}
+
+	//scale1 * q1 + scale2 * q2
+	inline QuaternionLanes Combine(const QuaternionLanes& q1, Lanes scale1, const QuaternionLanes& q2, Lanes scale2)
+	{
+		QuaternionLanes result;
+		result.X = MulAdd(scale1, q1.X, Mul(scale2, q2.X));
+		result.Y = MulAdd(scale1, q1.Y, Mul(scale2, q2.Y));
+		result.Z = MulAdd(scale1, q1.Z, Mul(scale2, q2.Z));
+		result.W = MulAdd(scale1, q1.W, Mul(scale2, q2.W));
+		return result;
+	}
+
+	/**
+	 *	acos(x) for x in [0, 1], Abramowitz and Stegun 4.4.46. The absolute error of the polynomial is below 2e-8.
+	 */
+	inline Lanes AcosPositive(Lanes x)
+	{
+		Lanes p = SetLanes(-0.0012624911f);
+		p = MulAdd(p, x, SetLanes(0.0066700901f));
+		p = MulAdd(p, x, SetLanes(-0.0170881256f));
+		p = MulAdd(p, x, SetLanes(0.0308918810f));
+		p = MulAdd(p, x, SetLanes(-0.0501743046f));
+		p = MulAdd(p, x, SetLanes(0.0889789874f));
+		p = MulAdd(p, x, SetLanes(-0.2145988016f));
+		p = MulAdd(p, x, SetLanes(1.5707963050f));
+
+		return Mul(Sqrt(Sub(SetLanes(1.0f), x)), p);
+	}
+
+	/**
+	 *	sin(x) for x in [0, pi/2] from its Taylor series up to x^11, the truncation error is below 6e-8
+	 */
+	inline Lanes SinHalfPi(Lanes x)
+	{
+		const Lanes x2 = Mul(x, x);
+
+		Lanes p = SetLanes(-1.0f / 39916800.0f);
+		p = MulAdd(p, x2, SetLanes(1.0f / 362880.0f));
+		p = MulAdd(p, x2, SetLanes(-1.0f / 5040.0f));
+		p = MulAdd(p, x2, SetLanes(1.0f / 120.0f));
+		p = MulAdd(p, x2, SetLanes(-1.0f / 6.0f));
+		p = MulAdd(p, x2, SetLanes(1.0f));
+
+		return Mul(x, p);
+	}
+
+	struct NlerpKernel
+	{
+		QuaternionLanes operator() (const QuaternionLanes& q1, const QuaternionLanes& q2, Lanes t) const
+		{
+			const Lanes scale2 = Select(Less(Dot(q1, q2), SetLanes(0.0f)), Sub(SetLanes(0.0f), t), t);
+
+			return Normalize(Combine(q1, Sub(SetLanes(1.0f), t), q2, scale2));
+		}
+	};
+
+	struct SlerpKernel
+	{
+		QuaternionLanes operator() (const QuaternionLanes& q1, const QuaternionLanes& q2, Lanes t) const
+		{
+			const Lanes zero = SetLanes(0.0f);
+			const Lanes one = SetLanes(1.0f);
+
+			//Interpolate along the shortest path
+			const Lanes dot = Dot(q1, q2);
+			const auto bFlip = Less(dot, zero);
+			const Lanes cosAngle = Min(Select(bFlip, Sub(zero, dot), dot), one);
+
+			const Lanes angle = AcosPositive(cosAngle);
+			const Lanes invSinAngle = Div(one, SinHalfPi(angle));
+			const Lanes oneMinusT = Sub(one, t);
+
+			//Same threshold as Quaternion::Slerp, the sine of the angle is unstable below it. The other lanes divide by zero but aren't selected
+			const auto bLerp = Less(SetLanes(0.9995f), cosAngle);
+			const Lanes scale1 = Select(bLerp, oneMinusT, Mul(SinHalfPi(Mul(oneMinusT, angle)), invSinAngle));
+			Lanes scale2 = Select(bLerp, t, Mul(SinHalfPi(Mul(t, angle)), invSinAngle));
+			scale2 = Select(bFlip, Sub(zero, scale2), scale2);
+
+			//Normalizing every lane also removes the error of the approximations from the length
+			return Normalize(Combine(q1, scale1, q2, scale2));
+		}
+	};
+
+	struct MultiplyKernel
+	{
+		QuaternionLanes operator() (const QuaternionLanes& q1, const QuaternionLanes& q2, Lanes) const
+		{
+			QuaternionLanes result;
+			result.X = Sub(MulAdd(q1.W, q2.X, MulAdd(q1.X, q2.W, Mul(q1.Y, q2.Z))), Mul(q1.Z, q2.Y));
+			result.Y = Add(MulAdd(q1.W, q2.Y, Sub(Mul(q1.Y, q2.W), Mul(q1.X, q2.Z))), Mul(q1.Z, q2.X));
+			result.Z = MulAdd(q1.W, q2.Z, MulAdd(q1.X, q2.Y, Sub(Mul(q1.Z, q2.W), Mul(q1.Y, q2.X))));
+			result.W = Sub(Sub(Sub(Mul(q1.W, q2.W), Mul(q1.X, q2.X)), Mul(q1.Y, q2.Y)), Mul(q1.Z, q2.Z));
+			return result;
+		}
+	};
+
+	//Row of LaneCount consecutive matrices, given as the lanes of each of its components
+	inline void StoreRow(Matrix3x4* out, int row, Lanes x, Lanes y, Lanes z, Lanes w)
+	{
+		float* result = &out[0][row].x;
+
+#if NE_MATH_SSE || NE_MATH_NEON
+		simd::Transpose4(x, y, z, w);
+
+		StoreLanes(result, x);
+		StoreLanes(result + 12, y);
+		StoreLanes(result + 24, z);
+		StoreLanes(result + 36, w);
+#else
+		result[0] = x;
+		result[1] = y;
+		result[2] = z;
+		result[3] = w;
+#endif
+	}
+
+	/**
+	 *	Writes the matrices of LaneCount quaternions. Each Matrix3x4 row is a column of Quaternion::ToMatrix.
+	 */
+	inline void StoreMatrices(Matrix3x4* out, const QuaternionLanes& q)
+	{
+		const Lanes one = SetLanes(1.0f);
+		const Lanes two = SetLanes(2.0f);
+
+		const Lanes x2 = Mul(q.X, two);
+		const Lanes y2 = Mul(q.Y, two);
+		const Lanes z2 = Mul(q.Z, two);
+
+		const Lanes xx = Mul(q.X, x2);
+		const Lanes yy = Mul(q.Y, y2);
+		const Lanes zz = Mul(q.Z, z2);
+		const Lanes xy = Mul(q.X, y2);
+		const Lanes xz = Mul(q.X, z2);
+		const Lanes yz = Mul(q.Y, z2);
+		const Lanes wx = Mul(q.W, x2);
+		const Lanes wy = Mul(q.W, y2);
+		const Lanes wz = Mul(q.W, z2);
+
+		const Lanes zero = SetLanes(0.0f);
+
+		StoreRow(out, 0, Sub(one, Add(yy, zz)), Add(xy, wz), Sub(xz, wy), zero);
+		StoreRow(out, 1, Sub(xy, wz), Sub(one, Add(xx, zz)), Add(yz, wx), zero);
+		StoreRow(out, 2, Add(xz, wy), Sub(yz, wx), Sub(one, Add(xx, yy)), zero);
+	}
+}
+
+void MultiplyQuaternions(const ConstQuaternionArrays& q1, const ConstQuaternionArrays& q2, const QuaternionArrays& out, size_t count)
+{
+	ForEachLaneGroup(q1, q2, nullptr, 0.0f, out, count, MultiplyKernel());
+}
+
+void NlerpQuaternions(const ConstQuaternionArrays& q1, const ConstQuaternionArrays& q2, const float* t, const QuaternionArrays& out, size_t count)
+{
+	ForEachLaneGroup(q1, q2, t, 0.0f, out, count, NlerpKernel());
+}
+
+void NlerpQuaternions(const ConstQuaternionArrays& q1, const ConstQuaternionArrays& q2, float t, const QuaternionArrays& out, size_t count)
+{
+	ForEachLaneGroup(q1, q2, nullptr, t, out, count, NlerpKernel());
+}
+
+void SlerpQuaternions(const ConstQuaternionArrays& q1, const ConstQuaternionArrays& q2, const float* t, const QuaternionArrays& out, size_t count)
+{
+	ForEachLaneGroup(q1, q2, t, 0.0f, out, count, SlerpKernel());
+}
+
+void SlerpQuaternions(const ConstQuaternionArrays& q1, const ConstQuaternionArrays& q2, float t, const QuaternionArrays& out, size_t count)
+{
+	ForEachLaneGroup(q1, q2, nullptr, t, out, count, SlerpKernel());
+}
+
+void QuaternionsToMatrices(const ConstQuaternionArrays& q, Matrix3x4* out, size_t count)
+{
+	size_t i = 0;
+	for (; i + LaneCount <= count; i += LaneCount)
+		StoreMatrices(out + i, Load(q, i));
+
+	const size_t remaining = count - i;
+	if (remaining > 0)
+	{
+		const TailQuaternions tail(q, i, remaining);
+
+		Matrix3x4 tailOut[LaneCount];
+		StoreMatrices(tailOut, Load(tail.GetConst(), 0));
+
+		for (size_t lane = 0; lane < remaining; lane++)
+			out[i + lane] = tailOut[lane];
+	}
+}
+
+}
@@ -0,0 +1,87 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include "Quaternion.h"
+#include "Matrix3x4.h"
+
+/**
+ *	Quaternion operations over whole arrays, for animating many joints at once.
+ *
+ *	Quaternions are stored as separate arrays per component so four of them fill a SIMD register with no shuffling.
+ *	Element i of the output only depends on element i of the inputs, so an output may be the same arrays as an input.
+ *	The results match the per call Quaternion_t functions, within the bounds given for each function.
+ *	The bounds are measured and checked by the Novus-Benchmark --verify checks.
+ */
+
+namespace novus
+{
+
+struct QuaternionArrays
+{
+	float* X;
+	float* Y;
+	float* Z;
+	float* W;
+};
+
+struct ConstQuaternionArrays
+{
+	const float* X;
+	const float* Y;
+	const float* Z;
+	const float* W;
+
+	ConstQuaternionArrays()
+		: X(nullptr), Y(nullptr), Z(nullptr), W(nullptr)
+	{}
+
+	ConstQuaternionArrays(const float* x, const float* y, const float* z, const float* w)
+		: X(x), Y(y), Z(z), W(w)
+	{}
+
+	ConstQuaternionArrays(const QuaternionArrays& q)
+		: X(q.X), Y(q.Y), Z(q.Z), W(q.W)
+	{}
+};
+
+/**
+ *	out[i] = q1[i] * q2[i], the same product as operator*.
+ *	Only the order of the additions differs from the scalar operator, for unit inputs the components are within 2e-7 of the exact product.
+ */
+void MultiplyQuaternions(const ConstQuaternionArrays& q1, const ConstQuaternionArrays& q2, const QuaternionArrays& out, size_t count);
+
+/**
+ *	Normalized linear interpolation along the shortest path like Quaternion::Nlerp, with one t per element.
+ *	For unit inputs the components are within 2e-7 of Quaternion::Nlerp evaluated in double precision.
+ */
+void NlerpQuaternions(const ConstQuaternionArrays& q1, const ConstQuaternionArrays& q2, const float* t, const QuaternionArrays& out, size_t count);
+
+//The same t for every element, e.g. blending two poses
+void NlerpQuaternions(const ConstQuaternionArrays& q1, const ConstQuaternionArrays& q2, float t, const QuaternionArrays& out, size_t count);
+
+/**
+ *	Spherical interpolation along the shortest path like Quaternion::Slerp, with one t per element.
+ *	The angle comes from a polynomial approximation of acos with an error below 2e-8 radians, and the sines from a polynomial accurate to 6e-8 on [0, pi/2].
+ *	Like Slerp, rotations closer than acos(0.9995) fall back to a normalized lerp, and the results are normalized.
+ *	For unit inputs and t in [0, 1] the components are within 3e-7 of Quaternion::Slerp evaluated in double precision.
+ *	Pairs whose dot product rounds across the 0.9995 threshold can take the other branch than the double evaluation,
+ *	which raises the bound to 6e-7. The float Quaternion::Slerp has about the same error.
+ */
+void SlerpQuaternions(const ConstQuaternionArrays& q1, const ConstQuaternionArrays& q2, const float* t, const QuaternionArrays& out, size_t count);
+
+void SlerpQuaternions(const ConstQuaternionArrays& q1, const ConstQuaternionArrays& q2, float t, const QuaternionArrays& out, size_t count);
+
+/**
+ *	Rotation matrices of unit quaternions, Matrix3x4(Quaternion::ToMatrix(q[i])) with a zero translation.
+ *	The elements are within 2e-7 of the exact matrix.
+ */
+void QuaternionsToMatrices(const ConstQuaternionArrays& q, Matrix3x4* out, size_t count);
+
+}
@@ -0,0 +1,363 @@
+#include "Random.h"
+#include "MathSIMD.h"
+#include "Utility/Platform/CpuFeatures.h"
+#include <atomic>
+
+#if NE_PLATFORM_X86
+#include <immintrin.h>
+#endif
+
+namespace novus
+{
+
+namespace
+{
+	const uint64_t JumpPolynomial[4] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+	const uint64_t LongJumpPolynomial[4] = { 0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull };
+
+	typedef uint64_t StreamState[4][4];
+
+	//Output of one step of each stream, as in Xoshiro256::NextUInt
+	inline void NextScalar4(StreamState& s, uint32_t (&out)[4])
+	{
+		for (int lane = 0; lane < 4; lane++)
+		{
+			const uint64_t result = detail::RotateLeft(s[1][lane] * 5, 7) * 9;
+			const uint64_t t = s[1][lane] << 17;
+
+			s[2][lane] ^= s[0][lane];
+			s[3][lane] ^= s[1][lane];
+			s[1][lane] ^= s[2][lane];
+			s[0][lane] ^= s[3][lane];
+
+			s[2][lane] ^= t;
+			s[3][lane] = detail::RotateLeft(s[3][lane], 45);
+
+			out[lane] = static_cast<uint32_t>(result >> 32);
+		}
+	}
+
+	/**
+	 *	Calls write(i, values) with the next output of the four streams for every group of four elements, the last group may be partial.
+	 *	The SIMD versions write whole groups themselves and leave the tail to this one.
+	 */
+	template <typename TWrite>
+	void FillScalar(StreamState& s, size_t begin, size_t count, TWrite write)
+	{
+		for (size_t i = begin; i < count; i += 4)
+		{
+			uint32_t values[4];
+			NextScalar4(s, values);
+
+			for (size_t lane = 0; lane < 4 && i + lane < count; lane++)
+				write(i + lane, values[lane]);
+		}
+	}
+
+#if NE_MATH_SSE
+	//64 bit lanes have no multiply in SSE2, the constant multiplies of the output function are shifts and adds
+	template <int K>
+	inline __m128i RotateLeft2(__m128i x)
+	{
+		return _mm_or_si128(_mm_slli_epi64(x, K), _mm_srli_epi64(x, 64 - K));
+	}
+
+	struct StreamsSSE2
+	{
+		//Streams 0 and 1 in a, 2 and 3 in b
+		__m128i a[4];
+		__m128i b[4];
+
+		explicit StreamsSSE2(const StreamState& s)
+		{
+			for (int word = 0; word < 4; word++)
+			{
+				a[word] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&s[word][0]));
+				b[word] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&s[word][2]));
+			}
+		}
+
+		void Store(StreamState& s) const
+		{
+			for (int word = 0; word < 4; word++)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&s[word][0]), a[word]);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&s[word][2]), b[word]);
+			}
+		}
+
+		static __m128i Step(__m128i (&s)[4])
+		{
+			const __m128i times5 = _mm_add_epi64(_mm_slli_epi64(s[1], 2), s[1]);
+			const __m128i rotated = RotateLeft2<7>(times5);
+			const __m128i result = _mm_add_epi64(_mm_slli_epi64(rotated, 3), rotated);
+			const __m128i t = _mm_slli_epi64(s[1], 17);
+
+			s[2] = _mm_xor_si128(s[2], s[0]);
+			s[3] = _mm_xor_si128(s[3], s[1]);
+			s[1] = _mm_xor_si128(s[1], s[2]);
+			s[0] = _mm_xor_si128(s[0], s[3]);
+
+			s[2] = _mm_xor_si128(s[2], t);
+			s[3] = RotateLeft2<45>(s[3]);
+
+			return result;
+		}
+
+		//Upper halves of the four 64 bit outputs, in stream order
+		__m128i Next()
+		{
+			const __m128 ra = _mm_castsi128_ps(Step(a));
+			const __m128 rb = _mm_castsi128_ps(Step(b));
+			return _mm_castps_si128(_mm_shuffle_ps(ra, rb, _MM_SHUFFLE(3, 1, 3, 1)));
+		}
+	};
+
+	inline __m128 UIntToUnitFloat4(__m128i x)
+	{
+		return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(x, 8)), _mm_set1_ps(1.0f / 16777216.0f));
+	}
+#endif
+
+#if NE_PLATFORM_X86
+	template <int K>
+	NE_TARGET("avx2") inline __m256i RotateLeft4(__m256i x)
+	{
+		return _mm256_or_si256(_mm256_slli_epi64(x, K), _mm256_srli_epi64(x, 64 - K));
+	}
+
+	//Two steps of the four streams, in stream order
+	NE_TARGET("avx2") inline __m256i Next8AVX2(__m256i (&s)[4])
+	{
+		__m256i results[2];
+
+		for (int step = 0; step < 2; step++)
+		{
+			const __m256i times5 = _mm256_add_epi64(_mm256_slli_epi64(s[1], 2), s[1]);
+			const __m256i rotated = RotateLeft4<7>(times5);
+			results[step] = _mm256_add_epi64(_mm256_slli_epi64(rotated, 3), rotated);
+			const __m256i t = _mm256_slli_epi64(s[1], 17);
+
+			s[2] = _mm256_xor_si256(s[2], s[0]);
+			s[3] = _mm256_xor_si256(s[3], s[1]);
+			s[1] = _mm256_xor_si256(s[1], s[2]);
+			s[0] = _mm256_xor_si256(s[0], s[3]);
+
+			s[2] = _mm256_xor_si256(s[2], t);
+			s[3] = RotateLeft4<45>(s[3]);
+		}
+
+		//Upper halves of each 64 bit lane, the in-lane shuffle leaves them in 128 bit lane order which the permute undoes
+		const __m256 upper = _mm256_shuffle_ps(_mm256_castsi256_ps(results[0]), _mm256_castsi256_ps(results[1]), _MM_SHUFFLE(3, 1, 3, 1));
+		return _mm256_permute4x64_epi64(_mm256_castps_si256(upper), _MM_SHUFFLE(3, 1, 2, 0));
+	}
+
+	NE_TARGET("avx2") inline void LoadStreams(const StreamState& state, __m256i (&s)[4])
+	{
+		for (int word = 0; word < 4; word++)
+			s[word] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[word]));
+	}
+
+	NE_TARGET("avx2") inline void StoreStreams(StreamState& state, const __m256i (&s)[4])
+	{
+		for (int word = 0; word < 4; word++)
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(state[word]), s[word]);
+	}
+
+	//Fill whole groups of eight and return how many elements were written
+	NE_TARGET("avx2") size_t FillUIntsAVX2(StreamState& state, uint32_t* out, size_t count)
+	{
+		__m256i s[4];
+		LoadStreams(state, s);
+
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), Next8AVX2(s));
+
+		StoreStreams(state, s);
+
+		return i;
+	}
+
+	NE_TARGET("avx2") size_t FillFloatsAVX2(StreamState& state, float* out, size_t count, float low, float range)
+	{
+		__m256i s[4];
+		LoadStreams(state, s);
+
+		const __m256 scale = _mm256_set1_ps(1.0f / 16777216.0f);
+		const __m256 lowValue = _mm256_set1_ps(low);
+		const __m256 rangeValue = _mm256_set1_ps(range);
+
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 unit = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(Next8AVX2(s), 8)), scale);
+			_mm256_storeu_ps(out + i, _mm256_add_ps(lowValue, _mm256_mul_ps(unit, rangeValue)));
+		}
+
+		StoreStreams(state, s);
+
+		return i;
+	}
+#endif
+
+	std::atomic<uint32_t> ThreadStreamCount(0);
+
+	Xoshiro256 CreateThreadGenerator()
+	{
+		Xoshiro256 generator;
+
+		for (uint32_t i = ThreadStreamCount++; i > 0; i--)
+			generator.Jump();
+
+		return generator;
+	}
+}
+
+void Xoshiro256::Jump()
+{
+	JumpWith(JumpPolynomial);
+}
+
+void Xoshiro256::LongJump()
+{
+	JumpWith(LongJumpPolynomial);
+}
+
+void Xoshiro256::JumpWith(const uint64_t (&polynomial)[4])
+{
+	//Sums the states at the set bits of the jump polynomial, which equals the state that many steps ahead
+	uint64_t jumped[4] = { 0, 0, 0, 0 };
+
+	for (int word = 0; word < 4; word++)
+	{
+		for (int bit = 0; bit < 64; bit++)
+		{
+			if (polynomial[word] & (1ull << bit))
+			{
+				for (int i = 0; i < 4; i++)
+					jumped[i] ^= State[i];
+			}
+
+			Next();
+		}
+	}
+
+	for (int i = 0; i < 4; i++)
+		State[i] = jumped[i];
+}
+
+void Pcg32::Advance(uint64_t delta)
+{
+	//Brown's algorithm, the LCG applied delta times is another LCG whose constants are built by repeated squaring
+	uint64_t multiplier = 6364136223846793005ull;
+	uint64_t increment = Increment;
+	uint64_t accumulatedMultiplier = 1;
+	uint64_t accumulatedIncrement = 0;
+
+	while (delta > 0)
+	{
+		if (delta & 1)
+		{
+			accumulatedMultiplier *= multiplier;
+			accumulatedIncrement = accumulatedIncrement * multiplier + increment;
+		}
+
+		increment = (multiplier + 1) * increment;
+		multiplier *= multiplier;
+		delta >>= 1;
+	}
+
+	State = accumulatedMultiplier * State + accumulatedIncrement;
+}
+
+Xoshiro256x4::Xoshiro256x4(const Xoshiro256& generator)
+{
+	Xoshiro256 stream = generator;
+
+	for (int lane = 0; lane < 4; lane++)
+	{
+		for (int word = 0; word < 4; word++)
+			State[word][lane] = stream.State[word];
+
+		stream.Jump();
+	}
+}
+
+Xoshiro256x4::Xoshiro256x4(uint64_t seed)
+	: Xoshiro256x4(Xoshiro256(seed))
+{}
+
+void Xoshiro256x4::FillUInts(uint32_t* out, size_t count)
+{
+	size_t i = 0;
+
+#if NE_PLATFORM_X86
+	if (GetCpuFeatures().bAVX2)
+	{
+		i = FillUIntsAVX2(State, out, count);
+	}
+#endif
+
+#if NE_MATH_SSE
+	StreamsSSE2 streams(State);
+
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), streams.Next());
+
+	streams.Store(State);
+#endif
+
+	FillScalar(State, i, count, [out](size_t index, uint32_t value)
+	{
+		out[index] = value;
+	});
+}
+
+void Xoshiro256x4::FillFloats(float* out, size_t count)
+{
+	FillFloats(out, count, 0.0f, 1.0f);
+}
+
+void Xoshiro256x4::FillFloats(float* out, size_t count, float low, float high)
+{
+	const float range = high - low;
+	size_t i = 0;
+
+#if NE_PLATFORM_X86
+	if (GetCpuFeatures().bAVX2)
+	{
+		i = FillFloatsAVX2(State, out, count, low, range);
+	}
+#endif
+
+#if NE_MATH_SSE
+	StreamsSSE2 streams(State);
+
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_set1_ps(low), _mm_mul_ps(UIntToUnitFloat4(streams.Next()), _mm_set1_ps(range))));
+
+	streams.Store(State);
+#endif
+
+	FillScalar(State, i, count, [out, low, range](size_t index, uint32_t value)
+	{
+		out[index] = low + detail::UIntToUnitFloat(value) * range;
+	});
+}
+
+Xoshiro256& GetThreadRandom()
+{
+	static thread_local Xoshiro256 generator = CreateThreadGenerator();
+
+	return generator;
+}
+
+void SeedThreadRandom(uint64_t seed)
+{
+	GetThreadRandom() = Xoshiro256(seed);
+}
+
+}
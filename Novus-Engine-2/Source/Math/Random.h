@@ -0,0 +1,280 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ *	Pseudo random number generators for simulation and content, not for anything security related.
+ *
+ *	The generators are small value types without locks, each thread or job uses its own.
+ *	Xoshiro256 is the general purpose generator, Jump splits it into non-overlapping streams for parallel work.
+ *	Pcg32 can jump ahead by any number of steps, so elements of a parallel loop can draw the same values however the loop is split.
+ *	Xoshiro256x4 fills large arrays with SIMD.
+ *
+ *	The same seed gives the same sequence on every platform and build.
+ */
+
+namespace novus
+{
+
+/**
+ *	SplitMix64 step, expands a 64 bit seed into the larger states of the other generators
+ */
+inline uint64_t SplitMix64(uint64_t& state)
+{
+	uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+/**
+ *	xoshiro256** by Blackman and Vigna, 256 bits of state with a period of 2^256 - 1.
+ */
+class Xoshiro256
+{
+public:
+	static const uint64_t DefaultSeed = 0x853C49E6748FEA9Bull;
+
+	explicit Xoshiro256(uint64_t seed = DefaultSeed);
+
+	uint64_t Next();
+
+	//Upper 32 bits of Next, the lowest bits of xoshiro outputs are the weakest
+	uint32_t NextUInt();
+
+	/**
+	 *	Uniform in [0, bound) without modulo bias, bound must not be zero
+	 */
+	uint32_t NextUInt(uint32_t bound);
+
+	//Uniform in [0, 1) with 24 random bits
+	float NextFloat();
+
+	//low..high
+	float NextFloat(float low, float high);
+
+	/**
+	 *	Advances the generator by 2^128 steps.
+	 *	Copies of one generator jumped 0, 1, 2... times are 2^128 long streams that never overlap, one per thread or job.
+	 */
+	void Jump();
+
+	/**
+	 *	Advances the generator by 2^192 steps, for splitting streams that are split again with Jump
+	 */
+	void LongJump();
+
+private:
+	friend class Xoshiro256x4;
+
+	void JumpWith(const uint64_t (&polynomial)[4]);
+
+	uint64_t State[4];
+};
+
+/**
+ *	PCG32 (XSH RR) by O'Neill, 64 bits of state and 2^63 selectable streams.
+ */
+class Pcg32
+{
+public:
+	static const uint64_t DefaultSeed = 0x853C49E6748FEA9Bull;
+
+	/**
+	 *	Generators with the same seed and different streams give independent sequences
+	 */
+	explicit Pcg32(uint64_t seed = DefaultSeed, uint64_t stream = 0);
+
+	uint32_t NextUInt();
+
+	/**
+	 *	Uniform in [0, bound) without modulo bias, bound must not be zero
+	 */
+	uint32_t NextUInt(uint32_t bound);
+
+	//Uniform in [0, 1) with 24 random bits
+	float NextFloat();
+
+	//low..high
+	float NextFloat(float low, float high);
+
+	/**
+	 *	Advances the generator by delta steps in O(log delta) time, as if NextUInt was called delta times.
+	 *	Delta wraps, Advance(-n) goes back n steps.
+	 */
+	void Advance(uint64_t delta);
+
+private:
+	uint64_t State;
+	uint64_t Increment;
+};
+
+/**
+ *	Four xoshiro256** streams advanced together so arrays are filled with SIMD, with SSE2 and with AVX2 where the CPU has it.
+ *	Element i of a fill is the next output of stream i % 4, so the values do not depend on the instruction set.
+ *	When a fill's count is not a multiple of 4 the unused outputs of its last step are discarded.
+ */
+class Xoshiro256x4
+{
+public:
+	/**
+	 *	The streams are copies of the generator jumped 0, 1, 2 and 3 times.
+	 *	Jump the generator 4 times before making another Xoshiro256x4 from it that has to be independent of this one.
+	 */
+	explicit Xoshiro256x4(const Xoshiro256& generator);
+
+	explicit Xoshiro256x4(uint64_t seed = Xoshiro256::DefaultSeed);
+
+	//The same values as Xoshiro256::NextUInt of each stream
+	void FillUInts(uint32_t* out, size_t count);
+
+	//Uniform in [0, 1) with 24 random bits
+	void FillFloats(float* out, size_t count);
+
+	void FillFloats(float* out, size_t count, float low, float high);
+
+private:
+	//State word first so each word of the four streams is one 256 bit load
+	alignas(32) uint64_t State[4][4];
+};
+
+/**
+ *	Generator of the calling thread, created the first time the thread uses it.
+ *	Threads get consecutive Jump streams of the default seed in the order they first call this,
+ *	so results only repeat between runs if that order does. Use SeedThreadRandom or an explicit generator when they have to.
+ */
+Xoshiro256& GetThreadRandom();
+
+void SeedThreadRandom(uint64_t seed);
+
+}
+
+/**
+ *	Generator definitions
+ */
+
+namespace novus
+{
+
+namespace detail
+{
+	inline uint64_t RotateLeft(uint64_t x, int k)
+	{
+		return (x << k) | (x >> (64 - k));
+	}
+
+	//Top 24 bits as a float in [0, 1)
+	inline float UIntToUnitFloat(uint32_t x)
+	{
+		return static_cast<float>(x >> 8) * (1.0f / 16777216.0f);
+	}
+
+	/**
+	 *	Lemire's multiply and shift range reduction, retries on the few values that would make some results more likely
+	 */
+	template <typename TGenerator>
+	inline uint32_t NextBoundedUInt(TGenerator& generator, uint32_t bound)
+	{
+		uint64_t m = static_cast<uint64_t>(generator.NextUInt()) * bound;
+		uint32_t low = static_cast<uint32_t>(m);
+
+		if (low < bound)
+		{
+			const uint32_t threshold = (0u - bound) % bound;
+
+			while (low < threshold)
+			{
+				m = static_cast<uint64_t>(generator.NextUInt()) * bound;
+				low = static_cast<uint32_t>(m);
+			}
+		}
+
+		return static_cast<uint32_t>(m >> 32);
+	}
+}
+
+inline Xoshiro256::Xoshiro256(uint64_t seed)
+{
+	for (int i = 0; i < 4; i++)
+		State[i] = SplitMix64(seed);
+}
+
+inline uint64_t Xoshiro256::Next()
+{
+	const uint64_t result = detail::RotateLeft(State[1] * 5, 7) * 9;
+	const uint64_t t = State[1] << 17;
+
+	State[2] ^= State[0];
+	State[3] ^= State[1];
+	State[1] ^= State[2];
+	State[0] ^= State[3];
+
+	State[2] ^= t;
+	State[3] = detail::RotateLeft(State[3], 45);
+
+	return result;
+}
+
+inline uint32_t Xoshiro256::NextUInt()
+{
+	return static_cast<uint32_t>(Next() >> 32);
+}
+
+inline uint32_t Xoshiro256::NextUInt(uint32_t bound)
+{
+	return detail::NextBoundedUInt(*this, bound);
+}
+
+inline float Xoshiro256::NextFloat()
+{
+	return detail::UIntToUnitFloat(NextUInt());
+}
+
+inline float Xoshiro256::NextFloat(float low, float high)
+{
+	return low + NextFloat() * (high - low);
+}
+
+inline Pcg32::Pcg32(uint64_t seed, uint64_t stream)
+	: State(0), Increment((stream << 1) | 1)
+{
+	NextUInt();
+	State += seed;
+	NextUInt();
+}
+
+inline uint32_t Pcg32::NextUInt()
+{
+	const uint64_t previous = State;
+	State = previous * 6364136223846793005ull + Increment;
+
+	const uint32_t xorShifted = static_cast<uint32_t>(((previous >> 18) ^ previous) >> 27);
+	const uint32_t rotation = static_cast<uint32_t>(previous >> 59);
+
+	return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31));
+}
+
+inline uint32_t Pcg32::NextUInt(uint32_t bound)
+{
+	return detail::NextBoundedUInt(*this, bound);
+}
+
+inline float Pcg32::NextFloat()
+{
+	return detail::UIntToUnitFloat(NextUInt());
+}
+
+inline float Pcg32::NextFloat(float low, float high)
+{
+	return low + NextFloat() * (high - low);
+}
+
+}
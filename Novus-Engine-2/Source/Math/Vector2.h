@@ -10,6 +10,8 @@
 //Based off GLM's architecture
 
 #include <cassert>
+#include <cstddef>
+#include <cmath>
 
 namespace novus
 {
@@ -40,29 +42,29 @@ namespace novus
 
 		//T x, y;
 
-		Vector2_t();
+		constexpr Vector2_t();
 
 
-		Vector2_t(const Vector2_t<T>& v);
+		constexpr Vector2_t(const Vector2_t<T>& v);
 
-		explicit Vector2_t(const T& s);
+		constexpr explicit Vector2_t(const T& s);
 
-		Vector2_t(const T& a, const T& b);
+		constexpr Vector2_t(const T& a, const T& b);
 
 		//Conversion constructors
 		template <typename B>
-		explicit Vector2_t(const Vector2_t<B>& v);
+		constexpr explicit Vector2_t(const Vector2_t<B>& v);
 
 		template <typename B>
-		explicit Vector2_t(const Vector3_t<B>& v);
+		constexpr explicit Vector2_t(const Vector3_t<B>& v);
 
 		template <typename B>
-		explicit Vector2_t(const Vector4_t<B>& v);
+		constexpr explicit Vector2_t(const Vector4_t<B>& v);
 
 		template <typename A, typename B>
-		Vector2_t(const A& a, const B& b);
+		constexpr Vector2_t(const A& a, const B& b);
 
-		size_t size() const;
+		constexpr size_t size() const;
 
 		T& operator[] (size_t i);
 		const T& operator[] (size_t i) const;
@@ -98,57 +100,57 @@ namespace novus
 	};
 
 	template <typename T>
-	Vector2_t<T> operator+ (const Vector2_t<T>& a, const Vector2_t<T>& b);
+	constexpr Vector2_t<T> operator+ (const Vector2_t<T>& a, const Vector2_t<T>& b);
 	template <typename T>
-	Vector2_t<T> operator- (const Vector2_t<T>& a, const Vector2_t<T>& b);
+	constexpr Vector2_t<T> operator- (const Vector2_t<T>& a, const Vector2_t<T>& b);
 	template <typename T>
-	Vector2_t<T> operator* (const Vector2_t<T>& a, const Vector2_t<T>& b);
+	constexpr Vector2_t<T> operator* (const Vector2_t<T>& a, const Vector2_t<T>& b);
 	template <typename T>
-	Vector2_t<T> operator/ (const Vector2_t<T>& a, const Vector2_t<T>& b);
+	constexpr Vector2_t<T> operator/ (const Vector2_t<T>& a, const Vector2_t<T>& b);
 
 	template <typename T>
-	Vector2_t<T> operator+ (const Vector2_t<T>& v, const T& s);
+	constexpr Vector2_t<T> operator+ (const Vector2_t<T>& v, const T& s);
 	template <typename T>
-	Vector2_t<T> operator- (const Vector2_t<T>& v, const T& s);
+	constexpr Vector2_t<T> operator- (const Vector2_t<T>& v, const T& s);
 	template <typename T>
-	Vector2_t<T> operator* (const Vector2_t<T>& v, const T& s);
+	constexpr Vector2_t<T> operator* (const Vector2_t<T>& v, const T& s);
 	template <typename T>
-	Vector2_t<T> operator/ (const Vector2_t<T>& v, const T& s);
+	constexpr Vector2_t<T> operator/ (const Vector2_t<T>& v, const T& s);
 
 	template <typename T>
-	Vector2_t<T> operator+ (const T& s, const Vector2_t<T>& v);
+	constexpr Vector2_t<T> operator+ (const T& s, const Vector2_t<T>& v);
 	template <typename T>
-	Vector2_t<T> operator- (const T& s, const Vector2_t<T>& v);
+	constexpr Vector2_t<T> operator- (const T& s, const Vector2_t<T>& v);
 	template <typename T>
-	Vector2_t<T> operator* (const T& s, const Vector2_t<T>& v);
+	constexpr Vector2_t<T> operator* (const T& s, const Vector2_t<T>& v);
 	template <typename T>
-	Vector2_t<T> operator/ (const T& s, const Vector2_t<T>& v);
+	constexpr Vector2_t<T> operator/ (const T& s, const Vector2_t<T>& v);
 
 	template <typename T>
-	Vector2_t<T> operator- (const Vector2_t<T>& v);
+	constexpr Vector2_t<T> operator- (const Vector2_t<T>& v);
 
 	template <typename T>
-	bool operator== (const Vector2_t<T>& v1, const Vector2_t<T>& v2);
+	constexpr bool operator== (const Vector2_t<T>& v1, const Vector2_t<T>& v2);
 	template <typename T>
-	bool operator!= (const Vector2_t<T>& v1, const Vector2_t<T>& v2);
+	constexpr bool operator!= (const Vector2_t<T>& v1, const Vector2_t<T>& v2);
 
 	template <typename T>
 	T Length(const Vector2_t<T>& v);
 
 	template <typename T>
-	T LengthSq(const Vector2_t<T>& v);
+	constexpr T LengthSq(const Vector2_t<T>& v);
 
 	template <typename T>
 	Vector2_t<T> Normalize(const Vector2_t<T>& v);
 
 	template <typename T>
-	T Dot(const Vector2_t<T>& v1, const Vector2_t<T>& v2);
+	constexpr T Dot(const Vector2_t<T>& v1, const Vector2_t<T>& v2);
 
 	template <typename T>
-	Vector2_t<T> Project(const Vector2_t<T>& v, const Vector2_t<T>& n);
+	constexpr Vector2_t<T> Project(const Vector2_t<T>& v, const Vector2_t<T>& n);
 
 	template <typename T>
-	Vector2_t<T> Reflect(const Vector2_t<T>& v, const Vector2_t<T>& n);
+	constexpr Vector2_t<T> Reflect(const Vector2_t<T>& v, const Vector2_t<T>& n);
 }
 
 
@@ -157,46 +159,46 @@ namespace novus
 	/** Vector2 class definition */
 
 	template <typename T>
-	Vector2_t<T>::Vector2_t()
+	constexpr Vector2_t<T>::Vector2_t()
 		: x(0), y(0)
 	{}
 
 	template <typename T>
-	Vector2_t<T>::Vector2_t(const Vector2_t<T>& v)
+	constexpr Vector2_t<T>::Vector2_t(const Vector2_t<T>& v)
 		: x(v.x), y(v.y)
 	{}
 
 	template <typename T>
-	Vector2_t<T>::Vector2_t(const T& s)
+	constexpr Vector2_t<T>::Vector2_t(const T& s)
 		: x(s), y(s)
 	{}
 
 	template <typename T>
-	Vector2_t<T>::Vector2_t(const T& a, const T& b)
+	constexpr Vector2_t<T>::Vector2_t(const T& a, const T& b)
 		: x(a), y(b)
 	{}
 
 	template <typename T>
 	template <typename B>
-	Vector2_t<T>::Vector2_t(const Vector2_t<B>& v)
+	constexpr Vector2_t<T>::Vector2_t(const Vector2_t<B>& v)
 		: x(static_cast<T>(v.x)), y(static_cast<T>(v.y))
 	{}
 
 	template <typename T>
 	template <typename B>
-	Vector2_t<T>::Vector2_t(const Vector3_t<B>& v)
+	constexpr Vector2_t<T>::Vector2_t(const Vector3_t<B>& v)
 		: x(static_cast<T>(v.x)), y(static_cast<T>(v.y))
 	{}
 
 	template <typename T>
 	template <typename B>
-	Vector2_t<T>::Vector2_t(const Vector4_t<B>& v)
+	constexpr Vector2_t<T>::Vector2_t(const Vector4_t<B>& v)
 		: x(static_cast<T>(v.x)), y(static_cast<T>(v.y))
 	{}
 
 	template <typename T>
 	template <typename A, typename B>
-	Vector2_t<T>::Vector2_t(const A& a, const B& b)
+	constexpr Vector2_t<T>::Vector2_t(const A& a, const B& b)
 		: x(static_cast<T>(a)), y(static_cast<T>(b))
 	{}
 
@@ -283,7 +285,7 @@ namespace novus
 	}
 
 	template <typename T>
-	size_t Vector2_t<T>::size() const
+	constexpr size_t Vector2_t<T>::size() const
 	{
 		return 2;
 	}
@@ -305,92 +307,92 @@ namespace novus
 	}
 
 	template <typename T>
-	Vector2_t<T> operator+ (const Vector2_t<T>& a, const Vector2_t<T>& b)
+	constexpr Vector2_t<T> operator+ (const Vector2_t<T>& a, const Vector2_t<T>& b)
 	{
 		return Vector2_t<T>(a.x + b.x, a.y + b.y);
 	}
 
 	template <typename T>
-	Vector2_t<T> operator- (const Vector2_t<T>& a, const Vector2_t<T>& b)
+	constexpr Vector2_t<T> operator- (const Vector2_t<T>& a, const Vector2_t<T>& b)
 	{
 		return Vector2_t<T>(a.x - b.x, a.y - b.y);
 	}
 
 	template <typename T>
-	Vector2_t<T> operator* (const Vector2_t<T>& a, const Vector2_t<T>& b)
+	constexpr Vector2_t<T> operator* (const Vector2_t<T>& a, const Vector2_t<T>& b)
 	{
 		return Vector2_t<T>(a.x * b.x, a.y * b.y);
 	}
 
 	template <typename T>
-	Vector2_t<T> operator/ (const Vector2_t<T>& a, const Vector2_t<T>& b)
+	constexpr Vector2_t<T> operator/ (const Vector2_t<T>& a, const Vector2_t<T>& b)
 	{
 		return Vector2_t<T>(a.x / b.x, a.y / b.y);
 	}
 
 	template <typename T>
-	Vector2_t<T> operator+ (const Vector2_t<T>& v, const T& s)
+	constexpr Vector2_t<T> operator+ (const Vector2_t<T>& v, const T& s)
 	{
 		return Vector2_t<T>(v.x + s, v.y + s);
 	}
 
 	template <typename T>
-	Vector2_t<T> operator- (const Vector2_t<T>& v, const T& s)
+	constexpr Vector2_t<T> operator- (const Vector2_t<T>& v, const T& s)
 	{
 		return Vector2_t<T>(v.x - s, v.y - s);
 	}
 
 	template <typename T>
-	Vector2_t<T> operator* (const Vector2_t<T>& v, const T& s)
+	constexpr Vector2_t<T> operator* (const Vector2_t<T>& v, const T& s)
 	{
 		return Vector2_t<T>(v.x * s, v.y * s);
 	}
 
 	template <typename T>
-	Vector2_t<T> operator/ (const Vector2_t<T>& v, const T& s)
+	constexpr Vector2_t<T> operator/ (const Vector2_t<T>& v, const T& s)
 	{
 		return Vector2_t<T>(v.x / s, v.y / s);
 	}
 
 
 	template <typename T>
-	Vector2_t<T> operator+ (const T& s, const Vector2_t<T>& v)
+	constexpr Vector2_t<T> operator+ (const T& s, const Vector2_t<T>& v)
 	{
 		return Vector2_t<T>(s + v.x, s + v.y);
 	}
 
 	template <typename T>
-	Vector2_t<T> operator- (const T& s, const Vector2_t<T>& v)
+	constexpr Vector2_t<T> operator- (const T& s, const Vector2_t<T>& v)
 	{
 		return Vector2_t<T>(s - v.x, s - v.y);
 	}
 
 	template <typename T>
-	Vector2_t<T> operator* (const T& s, const Vector2_t<T>& v)
+	constexpr Vector2_t<T> operator* (const T& s, const Vector2_t<T>& v)
 	{
 		return Vector2_t<T>(s * v.x, s * v.y);
 	}
 
 	template <typename T>
-	Vector2_t<T> operator/ (const T& s, const Vector2_t<T>& v)
+	constexpr Vector2_t<T> operator/ (const T& s, const Vector2_t<T>& v)
 	{
 		return Vector2_t<T>(s / v.x, s / v.y);
 	}
 
 	template <typename T>
-	Vector2_t<T> operator- (const Vector2_t<T>& v)
+	constexpr Vector2_t<T> operator- (const Vector2_t<T>& v)
 	{
 		return Vector2_t<T>(-v.x, -v.y);
 	}
 
 	template <typename T>
-	bool operator== (const Vector2_t<T>& v1, const Vector2_t<T>& v2)
+	constexpr bool operator== (const Vector2_t<T>& v1, const Vector2_t<T>& v2)
 	{
 		return (v1.x == v2.x && v1.y == v2.y);
 	}
 
 	template <typename T>
-	bool operator!= (const Vector2_t<T>& v1, const Vector2_t<T>& v2)
+	constexpr bool operator!= (const Vector2_t<T>& v1, const Vector2_t<T>& v2)
 	{
 		return (v1.x != v2.x || v1.y != v2.y);
 	}
@@ -402,7 +404,7 @@ namespace novus
 	}
 
 	template <typename T>
-	T LengthSq(const Vector2_t<T>& v)
+	constexpr T LengthSq(const Vector2_t<T>& v)
 	{
 		return v.x * v.x + v.y * v.y;
 	}
@@ -416,19 +418,19 @@ namespace novus
 	}
 
 	template <typename T>
-	T Dot(const Vector2_t<T>& v1, const Vector2_t<T>& v2)
+	constexpr T Dot(const Vector2_t<T>& v1, const Vector2_t<T>& v2)
 	{
-		return Vector2_t<T>(v1.x * v2.x + v1.y * v2.y);
+		return v1.x * v2.x + v1.y * v2.y;
 	}
 
 	template <typename T>
-	Vector2_t<T> Project(const Vector2_t<T>& v, const Vector2_t<T>& n)
+	constexpr Vector2_t<T> Project(const Vector2_t<T>& v, const Vector2_t<T>& n)
 	{
 		return Dot(v, n) * n;
 	}
 
 	template <typename T>
-	Vector2_t<T> Reflect(const Vector2_t<T>& v, const Vector2_t<T>& n)
+	constexpr Vector2_t<T> Reflect(const Vector2_t<T>& v, const Vector2_t<T>& n)
 	{
 		return v - 2.0f * Dot(v, n) * n;
 	}
@@ -10,6 +10,8 @@
 //Based off GLM's architecture
 
 #include <cassert>
+#include <cstddef>
+#include <cmath>
 
 namespace novus
 {
@@ -43,49 +45,49 @@ namespace novus
 			struct { T r, g, b, a; };
 		};
 
-		Vector4_t();
+		constexpr Vector4_t();
 
 
-		Vector4_t(const Vector4_t<T>& v);
+		constexpr Vector4_t(const Vector4_t<T>& v);
 
-		explicit Vector4_t(const T& s);
+		constexpr explicit Vector4_t(const T& s);
 
-		Vector4_t(const T& a, const T& b, const T& c, const T& d);
+		constexpr Vector4_t(const T& a, const T& b, const T& c, const T& d);
 
 		//Conversion constructors
 		template <typename B>
-		explicit Vector4_t(const Vector2_t<B>& v);
+		constexpr explicit Vector4_t(const Vector2_t<B>& v);
 
 		template <typename B>
-		explicit Vector4_t(const Vector3_t<B>& v);
+		constexpr explicit Vector4_t(const Vector3_t<B>& v);
 
 		template <typename B>
-		explicit Vector4_t(const Vector4_t<B>& v);
+		constexpr explicit Vector4_t(const Vector4_t<B>& v);
 
 
 
 		template <typename A, typename B, typename C, typename D>
-		Vector4_t(const A& a, const B& b, const C& c, const D& d);
+		constexpr Vector4_t(const A& a, const B& b, const C& c, const D& d);
 
 		template <typename A, typename B, typename C>
-		Vector4_t(const Vector2_t<A>& a, const B& b, const C& c);
+		constexpr Vector4_t(const Vector2_t<A>& a, const B& b, const C& c);
 
 		template <typename A, typename B, typename C>
-		Vector4_t(const A& a, const B& b, const Vector2_t<C>& c);
+		constexpr Vector4_t(const A& a, const B& b, const Vector2_t<C>& c);
 
 		template <typename A, typename B, typename C>
-		Vector4_t(const A& a, const Vector2_t<B>& b, const C& c);
+		constexpr Vector4_t(const A& a, const Vector2_t<B>& b, const C& c);
 
 		template <typename A, typename B>
-		Vector4_t(const Vector2_t<A>& a, const Vector2_t<B>& b);
+		constexpr Vector4_t(const Vector2_t<A>& a, const Vector2_t<B>& b);
 
 		template <typename A, typename B>
-		Vector4_t(const Vector3_t<A>& a, const B& b);
+		constexpr Vector4_t(const Vector3_t<A>& a, const B& b);
 
 		template <typename A, typename B>
-		Vector4_t(const A& a, const Vector3_t<B>& b);
+		constexpr Vector4_t(const A& a, const Vector3_t<B>& b);
 
-		size_t size() const;
+		constexpr size_t size() const;
 
 		T& operator[] (size_t i);
 		const T& operator[] (size_t i) const;
@@ -121,51 +123,51 @@ namespace novus
 	};
 
 	template <typename T>
-	Vector4_t<T> operator+ (const Vector4_t<T>& a, const Vector4_t<T>& b);
+	constexpr Vector4_t<T> operator+ (const Vector4_t<T>& a, const Vector4_t<T>& b);
 	template <typename T>
-	Vector4_t<T> operator- (const Vector4_t<T>& a, const Vector4_t<T>& b);
+	constexpr Vector4_t<T> operator- (const Vector4_t<T>& a, const Vector4_t<T>& b);
 	template <typename T>
-	Vector4_t<T> operator* (const Vector4_t<T>& a, const Vector4_t<T>& b);
+	constexpr Vector4_t<T> operator* (const Vector4_t<T>& a, const Vector4_t<T>& b);
 	template <typename T>
-	Vector4_t<T> operator/ (const Vector4_t<T>& a, const Vector4_t<T>& b);
+	constexpr Vector4_t<T> operator/ (const Vector4_t<T>& a, const Vector4_t<T>& b);
 
 	template <typename T>
-	Vector4_t<T> operator+ (const Vector4_t<T>& v, const T& s);
+	constexpr Vector4_t<T> operator+ (const Vector4_t<T>& v, const T& s);
 	template <typename T>
-	Vector4_t<T> operator- (const Vector4_t<T>& v, const T& s);
+	constexpr Vector4_t<T> operator- (const Vector4_t<T>& v, const T& s);
 	template <typename T>
-	Vector4_t<T> operator* (const Vector4_t<T>& v, const T& s);
+	constexpr Vector4_t<T> operator* (const Vector4_t<T>& v, const T& s);
 	template <typename T>
-	Vector4_t<T> operator/ (const Vector4_t<T>& v, const T& s);
+	constexpr Vector4_t<T> operator/ (const Vector4_t<T>& v, const T& s);
 
 	template <typename T>
-	Vector4_t<T> operator+ (const T& s, const Vector4_t<T>& v);
+	constexpr Vector4_t<T> operator+ (const T& s, const Vector4_t<T>& v);
 	template <typename T>
-	Vector4_t<T> operator- (const T& s, const Vector4_t<T>& v);
+	constexpr Vector4_t<T> operator- (const T& s, const Vector4_t<T>& v);
 	template <typename T>
-	Vector4_t<T> operator* (const T& s, const Vector4_t<T>& v);
+	constexpr Vector4_t<T> operator* (const T& s, const Vector4_t<T>& v);
 	template <typename T>
-	Vector4_t<T> operator/ (const T& s, const Vector4_t<T>& v);
+	constexpr Vector4_t<T> operator/ (const T& s, const Vector4_t<T>& v);
 
 	template <typename T>
-	Vector4_t<T> operator- (const Vector4_t<T>& v);
+	constexpr Vector4_t<T> operator- (const Vector4_t<T>& v);
 
 	template <typename T>
-	bool operator== (const Vector4_t<T>& v1, const Vector4_t<T>& v2);
+	constexpr bool operator== (const Vector4_t<T>& v1, const Vector4_t<T>& v2);
 	template <typename T>
-	bool operator!= (const Vector4_t<T>& v1, const Vector4_t<T>& v2);
+	constexpr bool operator!= (const Vector4_t<T>& v1, const Vector4_t<T>& v2);
 
 	template <typename T>
 	T Length(const Vector4_t<T>& v);
 
 	template <typename T>
-	T LengthSq(const Vector4_t<T>& v);
+	constexpr T LengthSq(const Vector4_t<T>& v);
 
 	template <typename T>
 	Vector4_t<T> Normalize(const Vector4_t<T>& v);
 
 	template <typename T>
-	T Dot(const Vector4_t<T>& v1, const Vector4_t<T>& v2);
+	constexpr T Dot(const Vector4_t<T>& v1, const Vector4_t<T>& v2);
 }
 
 namespace novus
@@ -175,89 +177,89 @@ namespace novus
 	*/
 
 	template <typename T>
-	Vector4_t<T>::Vector4_t()
+	constexpr Vector4_t<T>::Vector4_t()
 		: x(0), y(0), z(0), w(0)
 	{}
 
 
 	template <typename T>
-	Vector4_t<T>::Vector4_t(const Vector4_t<T>& v)
+	constexpr Vector4_t<T>::Vector4_t(const Vector4_t<T>& v)
 		: x(v.x), y(v.y), z(v.z), w(v.w)
 	{}
 
 	template <typename T>
-	Vector4_t<T>::Vector4_t(const T& s)
-		: x(s), y(s), z(s), w(w)
+	constexpr Vector4_t<T>::Vector4_t(const T& s)
+		: x(s), y(s), z(s), w(s)
 	{}
 
 	template <typename T>
-	Vector4_t<T>::Vector4_t(const T& a, const T& b, const T& c, const T& d)
+	constexpr Vector4_t<T>::Vector4_t(const T& a, const T& b, const T& c, const T& d)
 		: x(a), y(b), z(c), w(d)
 	{}
 
 	//Conversion constructors
 	template <typename T>
 	template <typename B>
-	Vector4_t<T>::Vector4_t(const Vector2_t<B>& v)
+	constexpr Vector4_t<T>::Vector4_t(const Vector2_t<B>& v)
 		: x(static_cast<T>(v.x)), y(static_cast<T>(v.y)), z(0), w(0)
 	{}
 
 	template <typename T>
 	template <typename B>
-	Vector4_t<T>::Vector4_t(const Vector3_t<B>& v)
+	constexpr Vector4_t<T>::Vector4_t(const Vector3_t<B>& v)
 		: x(static_cast<T>(v.x)), y(static_cast<T>(v.y)), z(static_cast<T>(v.z)), w(0)
 	{}
 
 	template <typename T>
 	template <typename B>
-	Vector4_t<T>::Vector4_t(const Vector4_t<B>& v)
+	constexpr Vector4_t<T>::Vector4_t(const Vector4_t<B>& v)
 		: x(static_cast<T>(v.x)), y(static_cast<T>(v.y)), z(static_cast<T>(v.z)), w(static_cast<T>(v.w))
 	{}
 
 	template <typename T>
 	template <typename A, typename B, typename C, typename D>
-	Vector4_t<T>::Vector4_t(const A& a, const B& b, const C& c, const D& d)
+	constexpr Vector4_t<T>::Vector4_t(const A& a, const B& b, const C& c, const D& d)
 		: x(static_cast<T>(a)), y(static_cast<T>(b)), z(static_cast<T>(c)), w(static_cast<T>(d))
 	{}
 
 	template <typename T>
 	template <typename A, typename B, typename C>
-	Vector4_t<T>::Vector4_t(const Vector2_t<A>& a, const B& b, const C& c)
+	constexpr Vector4_t<T>::Vector4_t(const Vector2_t<A>& a, const B& b, const C& c)
 		: x(static_cast<T>(a.x)), y(static_cast<T>(a.y)), z(static_cast<T>(b)), w(static_cast<T>(c))
 	{}
 
 	template <typename T>
 	template <typename A, typename B, typename C>
-	Vector4_t<T>::Vector4_t(const A& a, const B& b, const Vector2_t<C>& c)
+	constexpr Vector4_t<T>::Vector4_t(const A& a, const B& b, const Vector2_t<C>& c)
 		: x(static_cast<T>(a)), y(static_cast<T>(b)), z(static_cast<T>(c.x)), w(static_cast<T>(c.y))
 	{}
 
 	template <typename T>
 	template <typename A, typename B, typename C>
-	Vector4_t<T>::Vector4_t(const A& a, const Vector2_t<B>& b, const C& c)
+	constexpr Vector4_t<T>::Vector4_t(const A& a, const Vector2_t<B>& b, const C& c)
 		: x(static_cast<T>(a)), y(static_cast<T>(b.x)), z(static_cast<T>(b.y)), w(static_cast<T>(c))
 	{}
 
 	template <typename T>
 	template <typename A, typename B>
-	Vector4_t<T>::Vector4_t(const Vector2_t<A>& a, const Vector2_t<B>& b)
+	constexpr Vector4_t<T>::Vector4_t(const Vector2_t<A>& a, const Vector2_t<B>& b)
 		: x(static_cast<T>(a.x)), y(static_cast<T>(a.y)), z(static_cast<T>(b.x)), w(static_cast<T>(b.y))
 	{}
 
 	template <typename T>
 	template <typename A, typename B>
-	Vector4_t<T>::Vector4_t(const Vector3_t<A>& a, const B& b)
+	constexpr Vector4_t<T>::Vector4_t(const Vector3_t<A>& a, const B& b)
 		: x(static_cast<T>(a.x)), y(static_cast<T>(a.y)), z(static_cast<T>(a.z)), w(static_cast<T>(b))
 	{}
 
 	template <typename T>
 	template <typename A, typename B>
-	Vector4_t<T>::Vector4_t(const A& a, const Vector3_t<B>& b)
+	constexpr Vector4_t<T>::Vector4_t(const A& a, const Vector3_t<B>& b)
 		: x(static_cast<T>(a)), y(static_cast<T>(b.x)), z(static_cast<T>(b.y)), w(static_cast<T>(b.z))
 	{}
 
 	template <typename T>
-	size_t Vector4_t<T>::size() const
+	constexpr size_t Vector4_t<T>::size() const
 	{
 		return 4;
 	}
@@ -380,91 +382,91 @@ namespace novus
 	}
 
 	template <typename T>
-	Vector4_t<T> operator+ (const Vector4_t<T>& a, const Vector4_t<T>& b)
+	constexpr Vector4_t<T> operator+ (const Vector4_t<T>& a, const Vector4_t<T>& b)
 	{
 		return Vector4_t<T>(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
 	}
 
 	template <typename T>
-	Vector4_t<T> operator- (const Vector4_t<T>& a, const Vector4_t<T>& b)
+	constexpr Vector4_t<T> operator- (const Vector4_t<T>& a, const Vector4_t<T>& b)
 	{
 		return Vector4_t<T>(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
 	}
 
 	template <typename T>
-	Vector4_t<T> operator* (const Vector4_t<T>& a, const Vector4_t<T>& b)
+	constexpr Vector4_t<T> operator* (const Vector4_t<T>& a, const Vector4_t<T>& b)
 	{
 		return Vector4_t<T>(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
 	}
 
 	template <typename T>
-	Vector4_t<T> operator/ (const Vector4_t<T>& a, const Vector4_t<T>& b)
+	constexpr Vector4_t<T> operator/ (const Vector4_t<T>& a, const Vector4_t<T>& b)
 	{
 		return Vector4_t<T>(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
 	}
 
 	template <typename T>
-	Vector4_t<T> operator+ (const Vector4_t<T>& v, const T& s)
+	constexpr Vector4_t<T> operator+ (const Vector4_t<T>& v, const T& s)
 	{
 		return Vector4_t<T>(v.x + s, v.y + s, v.z + s, v.w + s);
 	}
 
 	template <typename T>
-	Vector4_t<T> operator- (const Vector4_t<T>& v, const T& s)
+	constexpr Vector4_t<T> operator- (const Vector4_t<T>& v, const T& s)
 	{
 		return Vector4_t<T>(v.x - s, v.y - s, v.z - s, v.w - s);
 	}
 
 	template <typename T>
-	Vector4_t<T> operator* (const Vector4_t<T>& v, const T& s)
+	constexpr Vector4_t<T> operator* (const Vector4_t<T>& v, const T& s)
 	{
 		return Vector4_t<T>(v.x * s, v.y * s, v.z * s, v.w * s);
 	}
 
 	template <typename T>
-	Vector4_t<T> operator/ (const Vector4_t<T>& v, const T& s)
+	constexpr Vector4_t<T> operator/ (const Vector4_t<T>& v, const T& s)
 	{
 		return Vector4_t<T>(v.x / s, v.y / s, v.z / s, v.w / s);
 	}
 
 	template <typename T>
-	Vector4_t<T> operator+ (const T& s, const Vector4_t<T>& v)
+	constexpr Vector4_t<T> operator+ (const T& s, const Vector4_t<T>& v)
 	{
 		return Vector4_t<T>(s + v.x, s + v.y, s + v.z, s + v.w);
 	}
 
 	template <typename T>
-	Vector4_t<T> operator- (const T& s, const Vector4_t<T>& v)
+	constexpr Vector4_t<T> operator- (const T& s, const Vector4_t<T>& v)
 	{
 		return Vector4_t<T>(s - v.x, s - v.y, s - v.z, s - v.w);
 	}
 
 	template <typename T>
-	Vector4_t<T> operator* (const T& s, const Vector4_t<T>& v)
+	constexpr Vector4_t<T> operator* (const T& s, const Vector4_t<T>& v)
 	{
 		return Vector4_t<T>(s * v.x, s * v.y, s * v.z, s * v.w);
 	}
 
 	template <typename T>
-	Vector4_t<T> operator/ (const T& s, const Vector4_t<T>& v)
+	constexpr Vector4_t<T> operator/ (const T& s, const Vector4_t<T>& v)
 	{
 		return Vector4_t<T>(s / v.x, s / v.y, s / v.z, s / v.w);
 	}
 
 	template <typename T>
-	Vector4_t<T> operator- (const Vector4_t<T>& v)
+	constexpr Vector4_t<T> operator- (const Vector4_t<T>& v)
 	{
 		return Vector4_t<T>(-v.x, -v.y, -v.z, -v.w);
 	}
 
 	template <typename T>
-	bool operator== (const Vector4_t<T>& v1, const Vector4_t<T>& v2)
+	constexpr bool operator== (const Vector4_t<T>& v1, const Vector4_t<T>& v2)
 	{
 		return (v1.x == v2.x && v1.y == v2.y && v1.z == v2.z && v1.w == v2.w);
 	}
 
 	template <typename T>
-	bool operator!= (const Vector4_t<T>& v1, const Vector4_t<T>& v2)
+	constexpr bool operator!= (const Vector4_t<T>& v1, const Vector4_t<T>& v2)
 	{
 		return (v1.x != v2.x || v1.y != v2.y || v1.z != v2.z || v1.w != v2.w);
 	}
@@ -476,7 +478,7 @@ namespace novus
 	}
 
 	template <typename T>
-	T LengthSq(const Vector4_t<T>& v)
+	constexpr T LengthSq(const Vector4_t<T>& v)
 	{
 		return v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w;
 	}
@@ -490,7 +492,7 @@ namespace novus
 	}
 
 	template <typename T>
-	T Dot(const Vector4_t<T>& v1, const Vector4_t<T>& v2)
+	constexpr T Dot(const Vector4_t<T>& v1, const Vector4_t<T>& v2)
 	{
 		return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z + v1.w * v2.w;
 	}
@@ -0,0 +1,339 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include "MathSIMD.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+/**
+ *	16 byte aligned float vectors for arrays that are worked on with SIMD, e.g. positions, normals and bounds.
+ *
+ *	Each vector fills exactly one SIMD register, so it is read and written with one aligned load or store
+ *	instead of the partial loads and shuffles a packed 12 byte Vector3 needs.
+ *	They are storage types with the common vector operations, convert to Vector3 and Vector4 for everything else.
+ *
+ *	Arrays of them must be allocated with at least 16 byte alignment, which new and malloc give on 64 bit platforms.
+ */
+
+namespace novus
+{
+	/**
+	 *	Vector3 padded to 16 bytes.
+	 *	The last float is padding. Constructors set it to zero, the operations never read it into x, y or z but may leave any value in it.
+	 */
+	struct alignas(16) Vector3A
+	{
+		union
+		{
+			struct { float x, y, z, padding; };
+#if NE_MATH_SSE || NE_MATH_NEON
+			simd::Float4 v;
+#endif
+		};
+
+		constexpr Vector3A();
+
+		constexpr explicit Vector3A(float s);
+
+		constexpr Vector3A(float a, float b, float c);
+
+		constexpr Vector3A(const Vector3_t<float>& v);
+
+#if NE_MATH_SSE || NE_MATH_NEON
+		explicit Vector3A(simd::Float4 value);
+#endif
+
+		operator Vector3_t<float>() const;
+	};
+
+	/**
+	 *	Vector4 with the alignment of a SIMD register
+	 */
+	struct alignas(16) Vector4A
+	{
+		union
+		{
+			struct { float x, y, z, w; };
+#if NE_MATH_SSE || NE_MATH_NEON
+			simd::Float4 v;
+#endif
+		};
+
+		constexpr Vector4A();
+
+		constexpr explicit Vector4A(float s);
+
+		constexpr Vector4A(float a, float b, float c, float d);
+
+		constexpr Vector4A(const Vector3A& v, float d);
+
+		constexpr Vector4A(const Vector4_t<float>& v);
+
+#if NE_MATH_SSE || NE_MATH_NEON
+		explicit Vector4A(simd::Float4 value);
+#endif
+
+		operator Vector4_t<float>() const;
+	};
+
+	static_assert(sizeof(Vector3A) == 16 && sizeof(Vector4A) == 16, "Aligned vectors are one SIMD register");
+
+	Vector3A operator+ (const Vector3A& a, const Vector3A& b);
+	Vector3A operator- (const Vector3A& a, const Vector3A& b);
+	Vector3A operator* (const Vector3A& a, const Vector3A& b);
+	Vector3A operator/ (const Vector3A& a, const Vector3A& b);
+	Vector3A operator* (const Vector3A& v, float s);
+	Vector3A operator* (float s, const Vector3A& v);
+	Vector3A operator/ (const Vector3A& v, float s);
+	Vector3A operator- (const Vector3A& v);
+
+	constexpr bool operator== (const Vector3A& v1, const Vector3A& v2);
+	constexpr bool operator!= (const Vector3A& v1, const Vector3A& v2);
+
+	float Dot(const Vector3A& v1, const Vector3A& v2);
+	Vector3A Cross(const Vector3A& v1, const Vector3A& v2);
+	float LengthSq(const Vector3A& v);
+	float Length(const Vector3A& v);
+	Vector3A Normalize(const Vector3A& v);
+	Vector3A Min(const Vector3A& v1, const Vector3A& v2);
+	Vector3A Max(const Vector3A& v1, const Vector3A& v2);
+
+	Vector4A operator+ (const Vector4A& a, const Vector4A& b);
+	Vector4A operator- (const Vector4A& a, const Vector4A& b);
+	Vector4A operator* (const Vector4A& a, const Vector4A& b);
+	Vector4A operator/ (const Vector4A& a, const Vector4A& b);
+	Vector4A operator* (const Vector4A& v, float s);
+	Vector4A operator* (float s, const Vector4A& v);
+	Vector4A operator/ (const Vector4A& v, float s);
+	Vector4A operator- (const Vector4A& v);
+
+	constexpr bool operator== (const Vector4A& v1, const Vector4A& v2);
+	constexpr bool operator!= (const Vector4A& v1, const Vector4A& v2);
+
+	float Dot(const Vector4A& v1, const Vector4A& v2);
+	float LengthSq(const Vector4A& v);
+	float Length(const Vector4A& v);
+	Vector4A Normalize(const Vector4A& v);
+	Vector4A Min(const Vector4A& v1, const Vector4A& v2);
+	Vector4A Max(const Vector4A& v1, const Vector4A& v2);
+}
+
+/**
+ *	Vector3A and Vector4A definitions
+ */
+
+namespace novus
+{
+	constexpr Vector3A::Vector3A()
+		: x(0), y(0), z(0), padding(0)
+	{}
+
+	constexpr Vector3A::Vector3A(float s)
+		: x(s), y(s), z(s), padding(0)
+	{}
+
+	constexpr Vector3A::Vector3A(float a, float b, float c)
+		: x(a), y(b), z(c), padding(0)
+	{}
+
+	constexpr Vector3A::Vector3A(const Vector3_t<float>& v)
+		: x(v.x), y(v.y), z(v.z), padding(0)
+	{}
+
+	inline Vector3A::operator Vector3_t<float>() const
+	{
+		return Vector3_t<float>(x, y, z);
+	}
+
+	constexpr Vector4A::Vector4A()
+		: x(0), y(0), z(0), w(0)
+	{}
+
+	constexpr Vector4A::Vector4A(float s)
+		: x(s), y(s), z(s), w(s)
+	{}
+
+	constexpr Vector4A::Vector4A(float a, float b, float c, float d)
+		: x(a), y(b), z(c), w(d)
+	{}
+
+	constexpr Vector4A::Vector4A(const Vector3A& v, float d)
+		: x(v.x), y(v.y), z(v.z), w(d)
+	{}
+
+	constexpr Vector4A::Vector4A(const Vector4_t<float>& v)
+		: x(v.x), y(v.y), z(v.z), w(v.w)
+	{}
+
+	inline Vector4A::operator Vector4_t<float>() const
+	{
+		return Vector4_t<float>(x, y, z, w);
+	}
+
+	constexpr bool operator== (const Vector3A& v1, const Vector3A& v2)
+	{
+		return (v1.x == v2.x && v1.y == v2.y && v1.z == v2.z);
+	}
+
+	constexpr bool operator!= (const Vector3A& v1, const Vector3A& v2)
+	{
+		return (v1.x != v2.x || v1.y != v2.y || v1.z != v2.z);
+	}
+
+	constexpr bool operator== (const Vector4A& v1, const Vector4A& v2)
+	{
+		return (v1.x == v2.x && v1.y == v2.y && v1.z == v2.z && v1.w == v2.w);
+	}
+
+	constexpr bool operator!= (const Vector4A& v1, const Vector4A& v2)
+	{
+		return (v1.x != v2.x || v1.y != v2.y || v1.z != v2.z || v1.w != v2.w);
+	}
+
+	inline float Length(const Vector3A& v)
+	{
+		return std::sqrt(LengthSq(v));
+	}
+
+	inline float Length(const Vector4A& v)
+	{
+		return std::sqrt(LengthSq(v));
+	}
+
+	inline float LengthSq(const Vector3A& v)
+	{
+		return Dot(v, v);
+	}
+
+	inline float LengthSq(const Vector4A& v)
+	{
+		return Dot(v, v);
+	}
+
+	inline Vector3A Normalize(const Vector3A& v)
+	{
+		return v / Length(v);
+	}
+
+	inline Vector4A Normalize(const Vector4A& v)
+	{
+		return v / Length(v);
+	}
+
+	inline Vector3A operator* (float s, const Vector3A& v)
+	{
+		return v * s;
+	}
+
+	inline Vector4A operator* (float s, const Vector4A& v)
+	{
+		return v * s;
+	}
+}
+
+#if NE_MATH_SSE || NE_MATH_NEON
+
+namespace novus
+{
+	inline Vector3A::Vector3A(simd::Float4 value)
+		: v(value)
+	{}
+
+	inline Vector4A::Vector4A(simd::Float4 value)
+		: v(value)
+	{}
+
+	inline Vector3A operator+ (const Vector3A& a, const Vector3A& b) { return Vector3A(simd::Add(a.v, b.v)); }
+	inline Vector3A operator- (const Vector3A& a, const Vector3A& b) { return Vector3A(simd::Sub(a.v, b.v)); }
+	inline Vector3A operator* (const Vector3A& a, const Vector3A& b) { return Vector3A(simd::Mul(a.v, b.v)); }
+	inline Vector3A operator/ (const Vector3A& a, const Vector3A& b) { return Vector3A(simd::Div(a.v, b.v)); }
+	inline Vector3A operator* (const Vector3A& v, float s) { return Vector3A(simd::Mul(v.v, simd::Set1(s))); }
+	inline Vector3A operator/ (const Vector3A& v, float s) { return Vector3A(simd::Div(v.v, simd::Set1(s))); }
+	inline Vector3A operator- (const Vector3A& v) { return Vector3A(simd::Sub(simd::Set1(0.0f), v.v)); }
+	inline Vector3A Min(const Vector3A& v1, const Vector3A& v2) { return Vector3A(simd::Min(v1.v, v2.v)); }
+	inline Vector3A Max(const Vector3A& v1, const Vector3A& v2) { return Vector3A(simd::Max(v1.v, v2.v)); }
+
+	inline Vector4A operator+ (const Vector4A& a, const Vector4A& b) { return Vector4A(simd::Add(a.v, b.v)); }
+	inline Vector4A operator- (const Vector4A& a, const Vector4A& b) { return Vector4A(simd::Sub(a.v, b.v)); }
+	inline Vector4A operator* (const Vector4A& a, const Vector4A& b) { return Vector4A(simd::Mul(a.v, b.v)); }
+	inline Vector4A operator/ (const Vector4A& a, const Vector4A& b) { return Vector4A(simd::Div(a.v, b.v)); }
+	inline Vector4A operator* (const Vector4A& v, float s) { return Vector4A(simd::Mul(v.v, simd::Set1(s))); }
+	inline Vector4A operator/ (const Vector4A& v, float s) { return Vector4A(simd::Div(v.v, simd::Set1(s))); }
+	inline Vector4A operator- (const Vector4A& v) { return Vector4A(simd::Sub(simd::Set1(0.0f), v.v)); }
+	inline Vector4A Min(const Vector4A& v1, const Vector4A& v2) { return Vector4A(simd::Min(v1.v, v2.v)); }
+	inline Vector4A Max(const Vector4A& v1, const Vector4A& v2) { return Vector4A(simd::Max(v1.v, v2.v)); }
+
+	inline float Dot(const Vector3A& v1, const Vector3A& v2)
+	{
+		//Only the first three products are summed, the padding lane is ignored
+		const simd::Float4 p = simd::Mul(v1.v, v2.v);
+		return simd::GetX(simd::Add(simd::Add(p, simd::Splat<1>(p)), simd::Splat<2>(p)));
+	}
+
+	inline float Dot(const Vector4A& v1, const Vector4A& v2)
+	{
+		const simd::Float4 p = simd::Mul(v1.v, v2.v);
+		return simd::GetX(simd::Add(simd::Add(p, simd::Splat<1>(p)), simd::Add(simd::Splat<2>(p), simd::Splat<3>(p))));
+	}
+
+	inline Vector3A Cross(const Vector3A& v1, const Vector3A& v2)
+	{
+#if NE_MATH_SSE
+		//v1.yzx * v2.zxy - v1.zxy * v2.yzx, computed as (v1 * v2.yzx - v1.yzx * v2).yzx to save two shuffles
+		const simd::Float4 a = NE_SIMD_SWIZZLE(v1.v, 1, 2, 0, 3);
+		const simd::Float4 b = NE_SIMD_SWIZZLE(v2.v, 1, 2, 0, 3);
+		const simd::Float4 c = simd::Sub(simd::Mul(v1.v, b), simd::Mul(a, v2.v));
+		return Vector3A(NE_SIMD_SWIZZLE(c, 1, 2, 0, 3));
+#else
+		return Vector3A(v1.y * v2.z - v2.y * v1.z, v1.z * v2.x - v2.z * v1.x, v1.x * v2.y - v2.x * v1.y);
+#endif
+	}
+}
+
+#else
+
+namespace novus
+{
+	inline Vector3A operator+ (const Vector3A& a, const Vector3A& b) { return Vector3A(a.x + b.x, a.y + b.y, a.z + b.z); }
+	inline Vector3A operator- (const Vector3A& a, const Vector3A& b) { return Vector3A(a.x - b.x, a.y - b.y, a.z - b.z); }
+	inline Vector3A operator* (const Vector3A& a, const Vector3A& b) { return Vector3A(a.x * b.x, a.y * b.y, a.z * b.z); }
+	inline Vector3A operator/ (const Vector3A& a, const Vector3A& b) { return Vector3A(a.x / b.x, a.y / b.y, a.z / b.z); }
+	inline Vector3A operator* (const Vector3A& v, float s) { return Vector3A(v.x * s, v.y * s, v.z * s); }
+	inline Vector3A operator/ (const Vector3A& v, float s) { return Vector3A(v.x / s, v.y / s, v.z / s); }
+	inline Vector3A operator- (const Vector3A& v) { return Vector3A(-v.x, -v.y, -v.z); }
+	inline Vector3A Min(const Vector3A& v1, const Vector3A& v2) { return Vector3A(std::fmin(v1.x, v2.x), std::fmin(v1.y, v2.y), std::fmin(v1.z, v2.z)); }
+	inline Vector3A Max(const Vector3A& v1, const Vector3A& v2) { return Vector3A(std::fmax(v1.x, v2.x), std::fmax(v1.y, v2.y), std::fmax(v1.z, v2.z)); }
+
+	inline Vector4A operator+ (const Vector4A& a, const Vector4A& b) { return Vector4A(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w); }
+	inline Vector4A operator- (const Vector4A& a, const Vector4A& b) { return Vector4A(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w); }
+	inline Vector4A operator* (const Vector4A& a, const Vector4A& b) { return Vector4A(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w); }
+	inline Vector4A operator/ (const Vector4A& a, const Vector4A& b) { return Vector4A(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w); }
+	inline Vector4A operator* (const Vector4A& v, float s) { return Vector4A(v.x * s, v.y * s, v.z * s, v.w * s); }
+	inline Vector4A operator/ (const Vector4A& v, float s) { return Vector4A(v.x / s, v.y / s, v.z / s, v.w / s); }
+	inline Vector4A operator- (const Vector4A& v) { return Vector4A(-v.x, -v.y, -v.z, -v.w); }
+	inline Vector4A Min(const Vector4A& v1, const Vector4A& v2) { return Vector4A(std::fmin(v1.x, v2.x), std::fmin(v1.y, v2.y), std::fmin(v1.z, v2.z), std::fmin(v1.w, v2.w)); }
+	inline Vector4A Max(const Vector4A& v1, const Vector4A& v2) { return Vector4A(std::fmax(v1.x, v2.x), std::fmax(v1.y, v2.y), std::fmax(v1.z, v2.z), std::fmax(v1.w, v2.w)); }
+
+	inline float Dot(const Vector3A& v1, const Vector3A& v2)
+	{
+		return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+	}
+
+	inline float Dot(const Vector4A& v1, const Vector4A& v2)
+	{
+		return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z + v1.w * v2.w;
+	}
+
+	inline Vector3A Cross(const Vector3A& v1, const Vector3A& v2)
+	{
+		return Vector3A(v1.y * v2.z - v2.y * v1.z, v1.z * v2.x - v2.z * v1.x, v1.x * v2.y - v2.x * v1.y);
+	}
+}
+
+#endif
@@ -0,0 +1,107 @@
+#include "WorldTransform.h"
+#include "MathSIMD.h"
+#include "Utility/Platform/CpuFeatures.h"
+
+#if NE_PLATFORM_X86
+#include <immintrin.h>
+#endif
+
+namespace novus
+{
+
+namespace
+{
+	inline void RebaseScalar(const WorldPositionArrays& positions, const Vector3d& origin, const RelativePositionArrays& out, size_t begin, size_t count)
+	{
+		for (size_t i = begin; i < count; i++)
+		{
+			out.X[i] = static_cast<float>(positions.X[i] - origin.x);
+			out.Y[i] = static_cast<float>(positions.Y[i] - origin.y);
+			out.Z[i] = static_cast<float>(positions.Z[i] - origin.z);
+		}
+	}
+
+#if NE_MATH_SSE
+	//Four relative floats from four doubles, the conversion rounds to nearest like static_cast<float>
+	inline __m128 Rebase4SSE2(const double* in, __m128d origin)
+	{
+		const __m128 low = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(in), origin));
+		const __m128 high = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(in + 2), origin));
+		return _mm_movelh_ps(low, high);
+	}
+#endif
+
+#if NE_PLATFORM_X86
+	//Whole groups of eight, returns how many positions were rebased
+	NE_TARGET("avx") size_t RebaseAVX(const WorldPositionArrays& positions, const Vector3d& origin, const RelativePositionArrays& out, size_t count)
+	{
+		const double* in[3] = { positions.X, positions.Y, positions.Z };
+		float* result[3] = { out.X, out.Y, out.Z };
+		const __m256d originValues[3] = { _mm256_set1_pd(origin.x), _mm256_set1_pd(origin.y), _mm256_set1_pd(origin.z) };
+
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			for (int axis = 0; axis < 3; axis++)
+			{
+				const __m128 low = _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(in[axis] + i), originValues[axis]));
+				const __m128 high = _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(in[axis] + i + 4), originValues[axis]));
+				_mm256_storeu_ps(result[axis] + i, _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1));
+			}
+		}
+
+		return i;
+	}
+#endif
+}
+
+Matrix4d WorldTransform::ToMatrix4d() const
+{
+	return Matrix4d::AffineTransform(Position, Quaterniond(Rotation), Vector3d(Scale));
+}
+
+Matrix3x4 WorldTransform::GetRelativeMatrix(const Vector3d& origin) const
+{
+	return Matrix3x4(Matrix4::AffineTransform(Vector3(Position - origin), Rotation, Scale));
+}
+
+void RebasePositions(const WorldPositionArrays& positions, const Vector3d& origin, const RelativePositionArrays& out, size_t count)
+{
+	size_t i = 0;
+
+#if NE_PLATFORM_X86
+	if (GetCpuFeatures().bAVX)
+	{
+		i = RebaseAVX(positions, origin, out, count);
+	}
+#endif
+
+#if NE_MATH_SSE
+	const __m128d originX = _mm_set1_pd(origin.x);
+	const __m128d originY = _mm_set1_pd(origin.y);
+	const __m128d originZ = _mm_set1_pd(origin.z);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		_mm_storeu_ps(out.X + i, Rebase4SSE2(positions.X + i, originX));
+		_mm_storeu_ps(out.Y + i, Rebase4SSE2(positions.Y + i, originY));
+		_mm_storeu_ps(out.Z + i, Rebase4SSE2(positions.Z + i, originZ));
+	}
+#endif
+
+	RebaseScalar(positions, origin, out, i, count);
+}
+
+void ComputeRelativeMatrices(const WorldTransform* transforms, const Vector3d& origin, Matrix3x4* out, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+		out[i] = transforms[i].GetRelativeMatrix(origin);
+}
+
+Matrix4 GetRelativeView(const Matrix4d& view, const Vector3d& origin)
+{
+	return Matrix4(Matrix4d::Translate(origin) * view);
+}
+
+}
@@ -0,0 +1,90 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include "Vector3.h"
+#include "Quaternion.h"
+#include "Matrix4.h"
+#include "Matrix3x4.h"
+
+/**
+ *	Object placement in worlds too large for float positions.
+ *
+ *	A float has 24 bits of mantissa, so 100 km from the origin positions are rounded to about 8 mm and moving objects visibly jitter.
+ *	World positions are kept in doubles and everything that is rendered is made relative to a view origin, normally the camera position,
+ *	before it is rounded to float. The rebase is one subtraction per object done over whole arrays; the per object constants,
+ *	batch transforms and culling after it stay in float, and the view matrix from GetRelativeView has no large translation left in it.
+ */
+
+namespace novus
+{
+
+/**
+ *	Scale, then rotation, then translation to a double precision position, the order of Matrix4::AffineTransform.
+ *	Only the position needs the extra precision, rotation and scale are the same at any distance from the origin.
+ */
+struct WorldTransform
+{
+	Vector3d Position;
+	Quaternion Rotation;
+	Vector3 Scale;
+
+	WorldTransform()
+		: Scale(1.0f)
+	{}
+
+	WorldTransform(const Vector3d& position, const Quaternion& rotation, const Vector3& scale)
+		: Position(position), Rotation(rotation), Scale(scale)
+	{}
+
+	//The whole transform in double precision, for tools and physics rather than rendering
+	Matrix4d ToMatrix4d() const;
+
+	/**
+	 *	The transform with origin moved to the coordinate origin, in float.
+	 *	The translation is subtracted in double and rounded once, so its error grows with the distance from origin instead of from the world origin.
+	 */
+	Matrix3x4 GetRelativeMatrix(const Vector3d& origin) const;
+};
+
+/**
+ *	World positions as separate arrays per component, like the position fields of ObjectTransformArrays
+ */
+struct WorldPositionArrays
+{
+	const double* X;
+	const double* Y;
+	const double* Z;
+};
+
+struct RelativePositionArrays
+{
+	float* X;
+	float* Y;
+	float* Z;
+};
+
+/**
+ *	out[i] = float(positions[i] - origin) for count positions, with SSE2 and with AVX where the CPU has it.
+ *	The outputs can be passed straight to ComputePerObjectConstants as its position arrays, together with a view from GetRelativeView.
+ */
+void RebasePositions(const WorldPositionArrays& positions, const Vector3d& origin, const RelativePositionArrays& out, size_t count);
+
+/**
+ *	GetRelativeMatrix of count transforms
+ */
+void ComputeRelativeMatrices(const WorldTransform* transforms, const Vector3d& origin, Matrix3x4* out, size_t count);
+
+/**
+ *	View matrix for rendering positions relative to origin, Matrix4d::Translate(origin) * view rounded to float.
+ *	When origin is the eye position the result is only the rotation of the view.
+ */
+Matrix4 GetRelativeView(const Matrix4d& view, const Vector3d& origin);
+
+}
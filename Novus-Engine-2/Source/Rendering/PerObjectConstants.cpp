@@ -0,0 +1,129 @@
+#include "PerObjectConstants.h"
+#include "Math/Vector3.h"
+#include "Math/MathSIMD.h"
+#include <stdint.h>
+#include <cassert>
+#include <cstring>
+
+namespace novus
+{
+
+static_assert(sizeof(PerObjectConstants) % 16 == 0, "PerObjectConstants is written in 16 byte blocks");
+
+namespace
+{
+#if NE_MATH_SSE || NE_MATH_NEON
+	/**
+	 *	Rows of a world transform that is a scale followed by a translation, multiplied by m.
+	 *	The first three rows of m are only scaled, the last row is the translation transformed by m.
+	 */
+	inline void ScaleTranslate(simd::Float4 (&result)[4], const simd::Float4 (&m)[4], simd::Float4 sx, simd::Float4 sy, simd::Float4 sz,
+		simd::Float4 px, simd::Float4 py, simd::Float4 pz)
+	{
+		result[0] = simd::Mul(sx, m[0]);
+		result[1] = simd::Mul(sy, m[1]);
+		result[2] = simd::Mul(sz, m[2]);
+		result[3] = simd::MulAdd(px, m[0], simd::MulAdd(py, m[1], simd::MulAdd(pz, m[2], m[3])));
+	}
+#endif
+}
+
+void ComputePerObjectConstants(const Matrix4& view, const Matrix4& viewProj, const ObjectTransformArrays& objects, size_t count,
+	void* destination, size_t destinationStride)
+{
+	assert(reinterpret_cast<uintptr_t>(destination) % 16 == 0);
+	assert(destinationStride % 16 == 0 && destinationStride >= sizeof(PerObjectConstants));
+
+	uint8_t* record = static_cast<uint8_t*>(destination);
+
+	//Partially written lines are flushed from the write-combining buffers in several small transactions,
+	//so the padding up to the end of the record's last cache line is cleared as well when the stride leaves room for it
+	const size_t paddingSize = destinationStride % 64 == 0 ? (64 - sizeof(PerObjectConstants) % 64) % 64 : 0;
+
+#if NE_MATH_SSE || NE_MATH_NEON
+	const simd::Float4 zero = simd::Set4(0.0f, 0.0f, 0.0f, 0.0f);
+
+	simd::Float4 viewRows[4];
+	simd::Float4 viewProjRows[4];
+
+	for (int row = 0; row < 4; row++)
+	{
+		viewRows[row] = simd::Load4(&view[row].x);
+		viewProjRows[row] = simd::Load4(&viewProj[row].x);
+	}
+
+	for (size_t i = 0; i < count; i++, record += destinationStride)
+	{
+		const float scaleX = objects.ScaleX[i];
+		const float scaleY = objects.ScaleY[i];
+		const float scaleZ = objects.ScaleZ[i];
+		const float positionX = objects.PositionX[i];
+		const float positionY = objects.PositionY[i];
+		const float positionZ = objects.PositionZ[i];
+
+		const simd::Float4 sx = simd::Set4(scaleX, scaleX, scaleX, scaleX);
+		const simd::Float4 sy = simd::Set4(scaleY, scaleY, scaleY, scaleY);
+		const simd::Float4 sz = simd::Set4(scaleZ, scaleZ, scaleZ, scaleZ);
+		const simd::Float4 px = simd::Set4(positionX, positionX, positionX, positionX);
+		const simd::Float4 py = simd::Set4(positionY, positionY, positionY, positionY);
+		const simd::Float4 pz = simd::Set4(positionZ, positionZ, positionZ, positionZ);
+
+		//Every block of the record is written exactly once, in address order, so the write-combining buffers are filled completely
+		float* out = reinterpret_cast<float*>(record);
+
+		//Matrix3x4 rows are the columns of the Matrix4
+		simd::Stream4(out, simd::Set4(scaleX, 0.0f, 0.0f, positionX));
+		simd::Stream4(out + 4, simd::Set4(0.0f, scaleY, 0.0f, positionY));
+		simd::Stream4(out + 8, simd::Set4(0.0f, 0.0f, scaleZ, positionZ));
+
+		simd::Float4 worldView[4];
+		ScaleTranslate(worldView, viewRows, sx, sy, sz, px, py, pz);
+		simd::Transpose4(worldView[0], worldView[1], worldView[2], worldView[3]);
+
+		simd::Stream4(out + 12, worldView[0]);
+		simd::Stream4(out + 16, worldView[1]);
+		simd::Stream4(out + 20, worldView[2]);
+
+		simd::Float4 worldViewProj[4];
+		ScaleTranslate(worldViewProj, viewProjRows, sx, sy, sz, px, py, pz);
+
+		simd::Stream4(out + 24, worldViewProj[0]);
+		simd::Stream4(out + 28, worldViewProj[1]);
+		simd::Stream4(out + 32, worldViewProj[2]);
+		simd::Stream4(out + 36, worldViewProj[3]);
+
+		//The inverse transpose of a scale is the reciprocal scale
+		simd::Stream4(out + 40, simd::Set4(1.0f / scaleX, 0.0f, 0.0f, 0.0f));
+		simd::Stream4(out + 44, simd::Set4(0.0f, 1.0f / scaleY, 0.0f, 0.0f));
+		simd::Stream4(out + 48, simd::Set4(0.0f, 0.0f, 1.0f / scaleZ, 0.0f));
+
+		for (size_t padding = 0; padding < paddingSize; padding += 16)
+			simd::Stream4(reinterpret_cast<float*>(record + sizeof(PerObjectConstants) + padding), zero);
+	}
+
+	//Non-temporal stores are weakly ordered, make them visible before the GPU work that reads them is submitted
+	simd::StreamFence();
+#else
+	PerObjectConstants constants;
+
+	for (size_t i = 0; i < count; i++, record += destinationStride)
+	{
+		const Vector3 scale(objects.ScaleX[i], objects.ScaleY[i], objects.ScaleZ[i]);
+		const Vector3 position(objects.PositionX[i], objects.PositionY[i], objects.PositionZ[i]);
+
+		const Matrix4 world = Matrix4::Scale(scale) * Matrix4::Translate(position);
+
+		constants.World = Matrix3x4(world);
+		constants.WorldView = Matrix3x4(world * view);
+		constants.WorldViewProj = world * viewProj;
+		constants.WorldInvTranspose[0] = Vector4(1.0f / scale.x, 0.0f, 0.0f, 0.0f);
+		constants.WorldInvTranspose[1] = Vector4(0.0f, 1.0f / scale.y, 0.0f, 0.0f);
+		constants.WorldInvTranspose[2] = Vector4(0.0f, 0.0f, 1.0f / scale.z, 0.0f);
+
+		memcpy(record, &constants, sizeof(constants));
+		memset(record + sizeof(constants), 0, paddingSize);
+	}
+#endif
+}
+
+}
@@ -0,0 +1,76 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include "Math/Vector4.h"
+#include "Math/Matrix4.h"
+#include "Math/Matrix3x4.h"
+#include "Utility/Metadata/Metadata.h"
+
+/**
+ *	Batched computation of the per object constant buffer from object positions and scales.
+ *
+ *	The transforms of all objects are built in one pass and the finished records are written straight into mapped upload memory,
+ *	such as a D3D12BufferPool, with non-temporal stores. Upload heaps are write-combined, so this avoids building each record on the stack
+ *	and copying it, and never reads the destination back.
+ */
+
+namespace novus
+{
+
+/**
+ *	Matches the cbuffer layout used by the object shaders. Matrices are stored row by row like the rest of the math library.
+ *	The affine transforms drop their constant last column, they are row_major float3x4 in HLSL.
+ */
+struct PerObjectConstants
+{
+	Matrix3x4 World;
+	Matrix3x4 WorldView;
+	Matrix4 WorldViewProj;
+	//HLSL puts each row of a float3x3 in its own register, so it can't be a packed Matrix3
+	Vector4 WorldInvTranspose[3];
+};
+
+/**
+ *	Object transforms as separate arrays per component, like the fields of CBPerInstance split apart.
+ *	The world transform of object i is a scale by Scale[i] followed by a translation to Position[i].
+ *	In large worlds the positions are relative to a view origin, filled by RebasePositions, and the view comes from GetRelativeView.
+ */
+struct ObjectTransformArrays
+{
+	const float* PositionX;
+	const float* PositionY;
+	const float* PositionZ;
+
+	//Must be non-zero so the inverse transpose exists
+	const float* ScaleX;
+	const float* ScaleY;
+	const float* ScaleZ;
+};
+
+/**
+ *	Computes World, WorldView, WorldViewProj and WorldInvTranspose for count objects.
+ *	@param view Must be affine, such as a look at matrix, since WorldView is stored without its last column
+ *	@param destination First record, must be 16 byte aligned. Constant buffer slots are 256 byte aligned so a mapped D3D12BufferPool slot always is.
+ *	@param destinationStride Distance between records in bytes, a multiple of 16 and at least sizeof(PerObjectConstants),
+ *		e.g. D3D12BufferPool::GetAlignedStride. If the stride is a multiple of 64 the padding after each record, up to the end of its last cache line, is zeroed.
+ */
+void ComputePerObjectConstants(const Matrix4& view, const Matrix4& viewProj, const ObjectTransformArrays& objects, size_t count,
+	void* destination, size_t destinationStride);
+
+}
+
+NE_REFLECT_BEGIN(novus::PerObjectConstants)
+	NE_REFLECT_FIELD(World)
+	NE_REFLECT_FIELD(WorldView)
+	NE_REFLECT_FIELD(WorldViewProj)
+	NE_REFLECT_FIELD(WorldInvTranspose)
+NE_REFLECT_END(novus::PerObjectConstants)
+
+static_assert(novus::IsConstantBufferLayoutValid<novus::PerObjectConstants>(), "PerObjectConstants doesn't match the HLSL constant buffer packing");
@@ -0,0 +1,104 @@
+#include "D3D12RHICommandContext.h"
+
+namespace novus
+{
+
+namespace
+{
+	D3D_PRIMITIVE_TOPOLOGY GetD3D12Topology(RHIPrimitiveTopology topology)
+	{
+		switch (topology)
+		{
+		case RHIPrimitiveTopology::PointList: return D3D_PRIMITIVE_TOPOLOGY_POINTLIST;
+		case RHIPrimitiveTopology::LineList: return D3D_PRIMITIVE_TOPOLOGY_LINELIST;
+		case RHIPrimitiveTopology::LineStrip: return D3D_PRIMITIVE_TOPOLOGY_LINESTRIP;
+		case RHIPrimitiveTopology::TriangleList: return D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+		case RHIPrimitiveTopology::TriangleStrip: return D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP;
+		default: return D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+		}
+	}
+}
+
+void D3D12RHICommandContext::RHISetViewport(const RHIViewport& viewport)
+{
+	D3D12_VIEWPORT d3dViewport;
+	d3dViewport.TopLeftX = viewport.TopLeftX;
+	d3dViewport.TopLeftY = viewport.TopLeftY;
+	d3dViewport.Width = viewport.Width;
+	d3dViewport.Height = viewport.Height;
+	d3dViewport.MinDepth = viewport.MinDepth;
+	d3dViewport.MaxDepth = viewport.MaxDepth;
+
+	CommandList->RSSetViewports(1, &d3dViewport);
+}
+
+void D3D12RHICommandContext::RHISetScissorRect(const RHIRect& rect)
+{
+	D3D12_RECT d3dRect;
+	d3dRect.left = rect.Left;
+	d3dRect.top = rect.Top;
+	d3dRect.right = rect.Right;
+	d3dRect.bottom = rect.Bottom;
+
+	CommandList->RSSetScissorRects(1, &d3dRect);
+}
+
+void D3D12RHICommandContext::RHISetPrimitiveTopology(RHIPrimitiveTopology topology)
+{
+	CommandList->IASetPrimitiveTopology(GetD3D12Topology(topology));
+}
+
+void D3D12RHICommandContext::RHISetVertexBuffer(uint32_t slot, uint64_t bufferLocation, uint32_t size, uint32_t stride)
+{
+	D3D12_VERTEX_BUFFER_VIEW view;
+	view.BufferLocation = bufferLocation;
+	view.SizeInBytes = size;
+	view.StrideInBytes = stride;
+
+	CommandList->IASetVertexBuffers(slot, 1, &view);
+}
+
+void D3D12RHICommandContext::RHISetIndexBuffer(uint64_t bufferLocation, uint32_t size, RHIIndexFormat format)
+{
+	D3D12_INDEX_BUFFER_VIEW view;
+	view.BufferLocation = bufferLocation;
+	view.SizeInBytes = size;
+	view.Format = format == RHIIndexFormat::UInt16 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+
+	CommandList->IASetIndexBuffer(&view);
+}
+
+void D3D12RHICommandContext::RHISetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t bufferLocation)
+{
+	CommandList->SetGraphicsRootConstantBufferView(rootParameterIndex, bufferLocation);
+}
+
+void D3D12RHICommandContext::RHISetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t baseDescriptor)
+{
+	D3D12_GPU_DESCRIPTOR_HANDLE handle;
+	handle.ptr = baseDescriptor;
+
+	CommandList->SetGraphicsRootDescriptorTable(rootParameterIndex, handle);
+}
+
+void D3D12RHICommandContext::RHIClearRenderTarget(uint64_t renderTargetDescriptor, const Vector4& clearColor)
+{
+	D3D12_CPU_DESCRIPTOR_HANDLE handle;
+	handle.ptr = static_cast<SIZE_T>(renderTargetDescriptor);
+
+	const float color[4] = { clearColor.x, clearColor.y, clearColor.z, clearColor.w };
+
+	CommandList->ClearRenderTargetView(handle, color, 0, nullptr);
+}
+
+void D3D12RHICommandContext::RHIDrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation)
+{
+	CommandList->DrawInstanced(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
+}
+
+void D3D12RHICommandContext::RHIDrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation)
+{
+	CommandList->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+}
+
+}
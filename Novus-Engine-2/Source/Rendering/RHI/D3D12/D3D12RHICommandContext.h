@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Rendering/RHI/IRHICommandContext.h"
+#include <d3d12.h>
+
+namespace novus
+{
+
+/**
+ *	Translates RHI commands to a D3D12 graphics command list.
+ *	GPU addresses are D3D12_GPU_VIRTUAL_ADDRESS values and descriptors are D3D12 descriptor handle pointers.
+ */
+class D3D12RHICommandContext : public IRHICommandContext
+{
+public:
+	explicit D3D12RHICommandContext(ID3D12GraphicsCommandList* commandList)
+		:CommandList(commandList)
+	{}
+
+	void SetCommandList(ID3D12GraphicsCommandList* commandList) { CommandList = commandList; }
+	ID3D12GraphicsCommandList* GetCommandList() const { return CommandList; }
+
+	void RHISetViewport(const RHIViewport& viewport) override;
+	void RHISetScissorRect(const RHIRect& rect) override;
+	void RHISetPrimitiveTopology(RHIPrimitiveTopology topology) override;
+
+	void RHISetVertexBuffer(uint32_t slot, uint64_t bufferLocation, uint32_t size, uint32_t stride) override;
+	void RHISetIndexBuffer(uint64_t bufferLocation, uint32_t size, RHIIndexFormat format) override;
+
+	void RHISetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t bufferLocation) override;
+	void RHISetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t baseDescriptor) override;
+
+	void RHIClearRenderTarget(uint64_t renderTargetDescriptor, const Vector4& clearColor) override;
+
+	void RHIDrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation) override;
+	void RHIDrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation) override;
+
+private:
+	ID3D12GraphicsCommandList* CommandList;
+};
+
+}
@@ -1,9 +1,12 @@
 #include "D3D12RHIResources.h"
 #include <cassert>
+#include "Utility/Profiling/Counters.h"
 
 namespace novus
 {
 
+NE_DEFINE_COUNTER(DescriptorsCopiedCounter, "RHI/DescriptorsCopied");
+
 HRESULT D3D12RHIDescriptorHeap::Init(ID3D12Device* device)
 {
 	if (ShaderVisible)
@@ -87,6 +90,7 @@ RHIDescriptorHeap& D3D12RHIDescriptorHeap::operator= (const RHIDescriptorHeap& o
 	otherHandle.ptr = reinterpret_cast<size_t>(o.GetDescriptorCPUPtr(0));
 
 	device->CopyDescriptorsSimple(DescriptorCount, CPUHandle, otherHandle, DescriptorHeapType);
+	NE_COUNTER_ADD(DescriptorsCopiedCounter, DescriptorCount);
 
 	return *this;
 }
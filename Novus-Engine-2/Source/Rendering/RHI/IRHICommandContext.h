@@ -0,0 +1,79 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include "Math/Vector4.h"
+
+namespace novus
+{
+
+struct RHIViewport
+{
+	float TopLeftX;
+	float TopLeftY;
+	float Width;
+	float Height;
+	float MinDepth;
+	float MaxDepth;
+};
+
+struct RHIRect
+{
+	int32_t Left;
+	int32_t Top;
+	int32_t Right;
+	int32_t Bottom;
+};
+
+enum class RHIPrimitiveTopology : uint32_t
+{
+	PointList,
+	LineList,
+	LineStrip,
+	TriangleList,
+	TriangleStrip
+};
+
+enum class RHIIndexFormat : uint32_t
+{
+	UInt16,
+	UInt32
+};
+
+/**
+ *	Backend that recorded RHI commands are translated to when a command list is executed.
+ *	GPU addresses and descriptor handles are passed through as opaque 64 bit values so commands stay independent of the backend.
+ */
+class IRHICommandContext
+{
+public:
+	//Limits every backend supports, commands outside them are rejected by captures and counted as invalid by the null backend
+	static const uint32_t MaxVertexBufferSlots = 16;
+	static const uint32_t MaxRootParameters = 16;
+
+public:
+	virtual ~IRHICommandContext() {}
+
+	virtual void RHISetViewport(const RHIViewport& viewport) = 0;
+	virtual void RHISetScissorRect(const RHIRect& rect) = 0;
+	virtual void RHISetPrimitiveTopology(RHIPrimitiveTopology topology) = 0;
+
+	virtual void RHISetVertexBuffer(uint32_t slot, uint64_t bufferLocation, uint32_t size, uint32_t stride) = 0;
+	virtual void RHISetIndexBuffer(uint64_t bufferLocation, uint32_t size, RHIIndexFormat format) = 0;
+
+	virtual void RHISetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t bufferLocation) = 0;
+	virtual void RHISetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t baseDescriptor) = 0;
+
+	virtual void RHIClearRenderTarget(uint64_t renderTargetDescriptor, const Vector4& clearColor) = 0;
+
+	virtual void RHIDrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation) = 0;
+	virtual void RHIDrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation) = 0;
+};
+
+}
@@ -0,0 +1,155 @@
+#include "NullRHICommandContext.h"
+#include <cstring>
+
+namespace novus
+{
+
+NullRHICommandContext::NullRHICommandContext()
+{
+	Reset();
+}
+
+void NullRHICommandContext::Reset()
+{
+	memset(&Stats, 0, sizeof(Stats));
+	memset(&Viewport, 0, sizeof(Viewport));
+	memset(&ScissorRect, 0, sizeof(ScissorRect));
+	memset(VertexBufferLocations, 0, sizeof(VertexBufferLocations));
+	memset(VertexBufferSizes, 0, sizeof(VertexBufferSizes));
+	memset(VertexBufferStrides, 0, sizeof(VertexBufferStrides));
+	memset(RootParameters, 0, sizeof(RootParameters));
+
+	Topology = RHIPrimitiveTopology::TriangleList;
+	IndexBufferLocation = 0;
+	IndexBufferSize = 0;
+	IndexFormat = RHIIndexFormat::UInt32;
+	bViewportSet = false;
+	bInvalidBinding = false;
+}
+
+void NullRHICommandContext::RHISetViewport(const RHIViewport& viewport)
+{
+	Stats.CommandCount++;
+	Stats.StateChangeCount++;
+
+	Viewport = viewport;
+	bViewportSet = true;
+}
+
+void NullRHICommandContext::RHISetScissorRect(const RHIRect& rect)
+{
+	Stats.CommandCount++;
+	Stats.StateChangeCount++;
+
+	ScissorRect = rect;
+}
+
+void NullRHICommandContext::RHISetPrimitiveTopology(RHIPrimitiveTopology topology)
+{
+	Stats.CommandCount++;
+	Stats.StateChangeCount++;
+
+	Topology = topology;
+}
+
+void NullRHICommandContext::RHISetVertexBuffer(uint32_t slot, uint64_t bufferLocation, uint32_t size, uint32_t stride)
+{
+	Stats.CommandCount++;
+	Stats.StateChangeCount++;
+
+	if (slot >= MaxVertexBufferSlots)
+	{
+		bInvalidBinding = true;
+		return;
+	}
+
+	VertexBufferLocations[slot] = bufferLocation;
+	VertexBufferSizes[slot] = size;
+	VertexBufferStrides[slot] = stride;
+}
+
+void NullRHICommandContext::RHISetIndexBuffer(uint64_t bufferLocation, uint32_t size, RHIIndexFormat format)
+{
+	Stats.CommandCount++;
+	Stats.StateChangeCount++;
+
+	IndexBufferLocation = bufferLocation;
+	IndexBufferSize = size;
+	IndexFormat = format;
+}
+
+void NullRHICommandContext::RHISetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t bufferLocation)
+{
+	Stats.CommandCount++;
+	Stats.StateChangeCount++;
+
+	if (rootParameterIndex >= MaxRootParameters)
+	{
+		bInvalidBinding = true;
+		return;
+	}
+
+	RootParameters[rootParameterIndex] = bufferLocation;
+}
+
+void NullRHICommandContext::RHISetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t baseDescriptor)
+{
+	Stats.CommandCount++;
+	Stats.StateChangeCount++;
+
+	if (rootParameterIndex >= MaxRootParameters)
+	{
+		bInvalidBinding = true;
+		return;
+	}
+
+	RootParameters[rootParameterIndex] = baseDescriptor;
+}
+
+void NullRHICommandContext::RHIClearRenderTarget(uint64_t renderTargetDescriptor, const Vector4& clearColor)
+{
+	(void)renderTargetDescriptor;
+	(void)clearColor;
+
+	Stats.CommandCount++;
+}
+
+void NullRHICommandContext::RHIDrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation)
+{
+	(void)startInstanceLocation;
+
+	Stats.CommandCount++;
+	Stats.DrawCount++;
+	Stats.VertexCount += static_cast<uint64_t>(vertexCountPerInstance) * instanceCount;
+
+	if (!ValidateDraw(static_cast<uint64_t>(startVertexLocation) + vertexCountPerInstance))
+		Stats.InvalidDrawCount++;
+}
+
+void NullRHICommandContext::RHIDrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation)
+{
+	(void)baseVertexLocation;
+	(void)startInstanceLocation;
+
+	Stats.CommandCount++;
+	Stats.DrawCount++;
+	Stats.IndexCount += static_cast<uint64_t>(indexCountPerInstance) * instanceCount;
+
+	const uint64_t indexSize = IndexFormat == RHIIndexFormat::UInt16 ? 2 : 4;
+	const bool indicesInRange = IndexBufferLocation != 0 &&
+		(static_cast<uint64_t>(startIndexLocation) + indexCountPerInstance) * indexSize <= IndexBufferSize;
+
+	if (!indicesInRange || !ValidateDraw(0))
+		Stats.InvalidDrawCount++;
+}
+
+bool NullRHICommandContext::ValidateDraw(uint64_t vertexCount) const
+{
+	if (!bViewportSet || bInvalidBinding || VertexBufferLocations[0] == 0)
+		return false;
+
+	//Only the first slot is checked since per-instance streams can be smaller
+	return VertexBufferStrides[0] == 0 || vertexCount * VertexBufferStrides[0] <= VertexBufferSizes[0];
+}
+
+}
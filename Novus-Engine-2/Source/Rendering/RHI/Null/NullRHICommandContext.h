@@ -0,0 +1,83 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include "Rendering/RHI/IRHICommandContext.h"
+
+namespace novus
+{
+
+/**
+ *	CPU only command context that tracks bound state and validates draws without talking to a GPU.
+ *	Used to replay captured command lists on machines without D3D12 and to time the RHI layer on its own.
+ */
+class NullRHICommandContext : public IRHICommandContext
+{
+public:
+	struct Statistics
+	{
+		uint64_t CommandCount;
+		uint64_t StateChangeCount;
+		uint64_t DrawCount;
+		uint64_t IndexCount;
+		uint64_t VertexCount;
+		uint64_t InvalidDrawCount;
+	};
+
+public:
+	NullRHICommandContext();
+
+	void RHISetViewport(const RHIViewport& viewport) override;
+	void RHISetScissorRect(const RHIRect& rect) override;
+	void RHISetPrimitiveTopology(RHIPrimitiveTopology topology) override;
+
+	void RHISetVertexBuffer(uint32_t slot, uint64_t bufferLocation, uint32_t size, uint32_t stride) override;
+	void RHISetIndexBuffer(uint64_t bufferLocation, uint32_t size, RHIIndexFormat format) override;
+
+	void RHISetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t bufferLocation) override;
+	void RHISetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t baseDescriptor) override;
+
+	void RHIClearRenderTarget(uint64_t renderTargetDescriptor, const Vector4& clearColor) override;
+
+	void RHIDrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation) override;
+	void RHIDrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation) override;
+
+	const Statistics& GetStatistics() const { return Stats; }
+
+	/**
+	 *	Clears bound state and statistics.
+	 */
+	void Reset();
+
+private:
+	bool ValidateDraw(uint64_t vertexCount) const;
+
+private:
+	Statistics Stats;
+
+	RHIViewport Viewport;
+	RHIRect ScissorRect;
+	RHIPrimitiveTopology Topology;
+
+	uint64_t VertexBufferLocations[MaxVertexBufferSlots];
+	uint32_t VertexBufferSizes[MaxVertexBufferSlots];
+	uint32_t VertexBufferStrides[MaxVertexBufferSlots];
+
+	uint64_t IndexBufferLocation;
+	uint32_t IndexBufferSize;
+	RHIIndexFormat IndexFormat;
+
+	uint64_t RootParameters[MaxRootParameters];
+
+	bool bViewportSet;
+
+	//Set when a slot or root parameter outside the limits was bound, draws after it can't be validated
+	bool bInvalidBinding;
+};
+
+}
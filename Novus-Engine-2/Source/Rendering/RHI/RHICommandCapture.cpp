@@ -0,0 +1,241 @@
+#include "RHICommandCapture.h"
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+namespace novus
+{
+
+namespace
+{
+	struct RecordHeader
+	{
+		uint16_t Type;
+		uint16_t PayloadSize;
+	};
+
+	/**
+	 *	Calls visitor(static_cast<TCmd*>(nullptr)) with the command structure for the type.
+	 *	@returns False for unknown types
+	 */
+	template <typename TVisitor>
+	bool VisitCommandType(RHICommandType type, TVisitor&& visitor)
+	{
+		switch (type)
+		{
+		case RHICommandType::SetViewport: visitor(static_cast<RHICommandSetViewport*>(nullptr)); return true;
+		case RHICommandType::SetScissorRect: visitor(static_cast<RHICommandSetScissorRect*>(nullptr)); return true;
+		case RHICommandType::SetPrimitiveTopology: visitor(static_cast<RHICommandSetPrimitiveTopology*>(nullptr)); return true;
+		case RHICommandType::SetVertexBuffer: visitor(static_cast<RHICommandSetVertexBuffer*>(nullptr)); return true;
+		case RHICommandType::SetIndexBuffer: visitor(static_cast<RHICommandSetIndexBuffer*>(nullptr)); return true;
+		case RHICommandType::SetGraphicsRootConstantBufferView: visitor(static_cast<RHICommandSetGraphicsRootConstantBufferView*>(nullptr)); return true;
+		case RHICommandType::SetGraphicsRootDescriptorTable: visitor(static_cast<RHICommandSetGraphicsRootDescriptorTable*>(nullptr)); return true;
+		case RHICommandType::ClearRenderTarget: visitor(static_cast<RHICommandClearRenderTarget*>(nullptr)); return true;
+		case RHICommandType::DrawInstanced: visitor(static_cast<RHICommandDrawInstanced*>(nullptr)); return true;
+		case RHICommandType::DrawIndexedInstanced: visitor(static_cast<RHICommandDrawIndexedInstanced*>(nullptr)); return true;
+		default: return false;
+		}
+	}
+
+	template <typename TCmd>
+	using PayloadOf = typename TCmd::PayloadType;
+
+	//Payload values a backend would index arrays with or switch on, the rest are passed through as is
+	template <typename TPayload>
+	bool IsPayloadValid(const TPayload&)
+	{
+		return true;
+	}
+
+	bool IsPayloadValid(const RHISetPrimitiveTopologyPayload& payload)
+	{
+		return payload.Topology <= RHIPrimitiveTopology::TriangleStrip;
+	}
+
+	bool IsPayloadValid(const RHISetVertexBufferPayload& payload)
+	{
+		return payload.Slot < IRHICommandContext::MaxVertexBufferSlots;
+	}
+
+	bool IsPayloadValid(const RHISetIndexBufferPayload& payload)
+	{
+		return payload.Format <= RHIIndexFormat::UInt32;
+	}
+
+	bool IsPayloadValid(const RHISetRootParameterPayload& payload)
+	{
+		return payload.RootParameterIndex < IRHICommandContext::MaxRootParameters;
+	}
+
+	/**
+	 *	@returns False for unknown types and payloads with values outside the RHI limits, nothing is recorded then
+	 */
+	bool RecordCommand(RHICommandType type, const uint8_t* data, RHICommandListBase& commandList)
+	{
+		bool bValid = false;
+
+		const bool bKnown = VisitCommandType(type, [&](auto* tag)
+		{
+			typedef typename std::remove_pointer<decltype(tag)>::type CommandType;
+
+			PayloadOf<CommandType> payload;
+			memcpy(&payload, data, sizeof(payload));
+
+			bValid = IsPayloadValid(payload);
+
+			if (bValid)
+			{
+				CommandType* command = commandList.AllocCommand<CommandType>();
+				command->Payload = payload;
+			}
+		});
+
+		return bKnown && bValid;
+	}
+}
+
+size_t RHICommandCapture::GetPayloadSize(RHICommandType type)
+{
+	size_t size = 0;
+
+	VisitCommandType(type, [&](auto* tag)
+	{
+		size = sizeof(PayloadOf<typename std::remove_pointer<decltype(tag)>::type>);
+	});
+
+	return size;
+}
+
+const void* RHICommandCapture::GetPayload(const RHICommandBase* command)
+{
+	const void* payload = nullptr;
+
+	VisitCommandType(command->CommandType, [&](auto* tag)
+	{
+		typedef typename std::remove_pointer<decltype(tag)>::type CommandType;
+		payload = &static_cast<const CommandType*>(command)->Payload;
+	});
+
+	return payload;
+}
+
+bool RHICommandCapture::Equals(const RHICommandListBase& a, const RHICommandListBase& b)
+{
+	const RHICommandBase* commandA = a.GetHead();
+	const RHICommandBase* commandB = b.GetHead();
+
+	for (; commandA != nullptr && commandB != nullptr; commandA = commandA->Next, commandB = commandB->Next)
+	{
+		if (commandA->CommandType != commandB->CommandType)
+			return false;
+
+		if (memcmp(GetPayload(commandA), GetPayload(commandB), GetPayloadSize(commandA->CommandType)) != 0)
+			return false;
+	}
+
+	return commandA == nullptr && commandB == nullptr;
+}
+
+void RHICommandCapture::Serialize(const RHICommandListBase& commandList, std::vector<uint8_t>& data)
+{
+	const size_t headerOffset = data.size();
+	data.resize(headerOffset + sizeof(RHICaptureHeader));
+
+	uint32_t commandCount = 0;
+
+	for (const RHICommandBase* command = commandList.GetHead(); command != nullptr; command = command->Next)
+	{
+		RecordHeader record;
+		record.Type = static_cast<uint16_t>(command->CommandType);
+		record.PayloadSize = static_cast<uint16_t>(GetPayloadSize(command->CommandType));
+
+		const uint8_t* recordBytes = reinterpret_cast<const uint8_t*>(&record);
+		const uint8_t* payloadBytes = static_cast<const uint8_t*>(GetPayload(command));
+
+		data.insert(data.end(), recordBytes, recordBytes + sizeof(RecordHeader));
+		data.insert(data.end(), payloadBytes, payloadBytes + record.PayloadSize);
+
+		commandCount++;
+	}
+
+	RHICaptureHeader header;
+	header.Magic = Magic;
+	header.Version = Version;
+	header.CommandCount = commandCount;
+	header.Reserved = 0;
+	header.PayloadSize = data.size() - headerOffset - sizeof(RHICaptureHeader);
+
+	memcpy(&data[headerOffset], &header, sizeof(RHICaptureHeader));
+}
+
+bool RHICommandCapture::Deserialize(const uint8_t* data, size_t size, RHICommandListBase& commandList)
+{
+	if (size < sizeof(RHICaptureHeader))
+		return false;
+
+	RHICaptureHeader header;
+	memcpy(&header, data, sizeof(RHICaptureHeader));
+
+	if (header.Magic != Magic || header.Version != Version || header.PayloadSize > size - sizeof(RHICaptureHeader))
+		return false;
+
+	const uint8_t* current = data + sizeof(RHICaptureHeader);
+	const uint8_t* end = current + header.PayloadSize;
+
+	for (uint32_t i = 0; i < header.CommandCount; i++)
+	{
+		if (static_cast<size_t>(end - current) < sizeof(RecordHeader))
+			return false;
+
+		RecordHeader record;
+		memcpy(&record, current, sizeof(RecordHeader));
+		current += sizeof(RecordHeader);
+
+		const RHICommandType type = static_cast<RHICommandType>(record.Type);
+
+		//Reject commands whose layout changed since the capture was written
+		if (record.PayloadSize != GetPayloadSize(type) || static_cast<size_t>(end - current) < record.PayloadSize)
+			return false;
+
+		if (!RecordCommand(type, current, commandList))
+			return false;
+
+		current += record.PayloadSize;
+	}
+
+	return true;
+}
+
+bool RHICommandCapture::WriteToFile(const std::string& filePath, const RHICommandListBase& commandList)
+{
+	std::vector<uint8_t> data;
+	Serialize(commandList, data);
+
+	std::ofstream file(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+
+	if (!file.good())
+		return false;
+
+	file.write(reinterpret_cast<const char*>(data.data()), data.size());
+
+	return file.good();
+}
+
+bool RHICommandCapture::ReadFromFile(const std::string& filePath, std::vector<uint8_t>& data)
+{
+	std::ifstream file(filePath, std::ios::in | std::ios::binary | std::ios::ate);
+
+	if (!file.good())
+		return false;
+
+	const size_t fileSize = static_cast<size_t>(file.tellg());
+
+	data.resize(fileSize);
+
+	file.seekg(0, std::ios::beg);
+	file.read(reinterpret_cast<char*>(data.data()), fileSize);
+
+	return file.good();
+}
+
+}
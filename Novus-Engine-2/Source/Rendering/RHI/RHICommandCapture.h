@@ -0,0 +1,76 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "RHICommandList.h"
+
+/**
+ *	Serializes recorded command lists into a compact binary stream and rebuilds command lists from it.
+ *	A capture can be replayed against any IRHICommandContext, including NullRHICommandContext, which makes
+ *	it possible to time command translation without the original scene or a GPU.
+ *
+ *	Layout: RHICaptureHeader followed by CommandCount records of
+ *			[uint16_t command type][uint16_t payload size][payload]
+ *	where the payload is the command's Payload structure, see RHICommandList.h.
+ *	Values are written in the native byte order.
+ */
+
+namespace novus
+{
+
+struct RHICaptureHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	uint32_t CommandCount;
+	uint32_t Reserved;
+	uint64_t PayloadSize;
+};
+
+class RHICommandCapture
+{
+public:
+	static const uint32_t Magic = 0x4352454E; //"NERC"
+	static const uint32_t Version = 2;
+
+public:
+	/**
+	 *	Appends the serialized commands of the list to data. The list is not modified.
+	 */
+	static void Serialize(const RHICommandListBase& commandList, std::vector<uint8_t>& data);
+
+	/**
+	 *	Records the commands stored in data into the command list.
+	 *	Slots and root parameter indices outside the IRHICommandContext limits and unknown enum values make the capture invalid.
+	 *	@returns False if the data is not a valid capture, commands before the invalid one are still recorded
+	 */
+	static bool Deserialize(const uint8_t* data, size_t size, RHICommandListBase& commandList);
+
+	static bool WriteToFile(const std::string& filePath, const RHICommandListBase& commandList);
+	static bool ReadFromFile(const std::string& filePath, std::vector<uint8_t>& data);
+
+	/**
+	 *	@returns Size of the payload stored for the command type, 0 for unknown types
+	 */
+	static size_t GetPayloadSize(RHICommandType type);
+
+	/**
+	 *	@returns The command's payload, GetPayloadSize(command->CommandType) bytes long
+	 */
+	static const void* GetPayload(const RHICommandBase* command);
+
+	/**
+	 *	True if both lists hold the same commands in the same order with identical payloads.
+	 */
+	static bool Equals(const RHICommandListBase& a, const RHICommandListBase& b);
+};
+
+}
@@ -0,0 +1,80 @@
+#include "RHICommandList.h"
+
+namespace novus
+{
+
+RHICommandListBase::RHICommandListBase()
+	:Context(nullptr),
+	Root(nullptr),
+	Tail(&Root),
+	CommandCount(0),
+	CurrentBlock(0),
+	CurrentOffset(0)
+{
+}
+
+RHICommandListBase::~RHICommandListBase()
+{
+	Reset();
+
+	for (auto block : Blocks)
+	{
+		delete[] block;
+	}
+}
+
+void* RHICommandListBase::Alloc(size_t size, size_t alignment)
+{
+	assert(size <= BlockSize);
+	assert((alignment & (alignment - 1)) == 0);
+
+	for (;;)
+	{
+		if (CurrentBlock < Blocks.size())
+		{
+			const size_t alignedOffset = (CurrentOffset + (alignment - 1)) & ~(alignment - 1);
+
+			if (alignedOffset + size <= BlockSize)
+			{
+				CurrentOffset = alignedOffset + size;
+				return Blocks[CurrentBlock] + alignedOffset;
+			}
+
+			//Move on to the next block, blocks from previous frames are reused before allocating new ones
+			CurrentBlock++;
+			CurrentOffset = 0;
+		}
+		else
+		{
+			Blocks.push_back(new uint8_t[BlockSize]);
+		}
+	}
+}
+
+void RHICommandListBase::Execute()
+{
+	RHICommandBase* command = Root;
+
+	while (command != nullptr)
+	{
+		//The command is destructed by the call so grab the next one first
+		RHICommandBase* next = command->Next;
+		command->CallExecuteAndDestruct(*this);
+		command = next;
+	}
+
+	Reset();
+}
+
+void RHICommandListBase::Reset()
+{
+	//Commands only hold plain values so skipping their destructors is safe
+	Root = nullptr;
+	Tail = &Root;
+	CommandCount = 0;
+
+	CurrentBlock = 0;
+	CurrentOffset = 0;
+}
+
+}
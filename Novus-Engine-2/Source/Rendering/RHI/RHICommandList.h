@@ -16,7 +16,14 @@
 #pragma once
 
 #include <stdint.h>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cassert>
 #include "Math/Vector4.h"
+#include "IRHICommandContext.h"
 
 namespace novus
 {
@@ -35,38 +42,44 @@ enum class ClearFlags : uint8_t
 	Stencil = 1 << 1,
 };
 
-class RHICommandListBase
+/**
+ *	Identifies the command type so recorded command lists can be serialized and rebuilt, see RHICommandCapture.
+ *	Values are stored in capture files so new commands should only be added at the end.
+ */
+enum class RHICommandType : uint16_t
 {
-	
-public:
-	//virtual ~RHICommandList() {}
-
-
-	//virtual void ClearState(RHIPipelineState* state);
-
-	//virtual void Close();
-
-	//virtual void ClearDepthStencil(RHITexture2D* depthStencil, ClearFlags clearFlags, float clearDepth, uint8_t clearStencil) = 0;
-	//virtual void ClearRenderTarget(RHITexture* renderTarget, const Vector4& clearColor);
-
-	//virtual void ClearUnorderedAccessView(RHIResource* resource, const Vector4& value);
-	//virtual void ClearUnorderedAccessView(RHIResource* resource, const Vector4u& value);
-
-	//virtual void CopyBufferRegion(RHIResource* dstBuffer, uint64_t dstOffset, RHIResource* srcBuffer, uint64_t srcOffset, uint64_t byteCount);
-
-private:
+	SetViewport,
+	SetScissorRect,
+	SetPrimitiveTopology,
+	SetVertexBuffer,
+	SetIndexBuffer,
+	SetGraphicsRootConstantBufferView,
+	SetGraphicsRootDescriptorTable,
+	ClearRenderTarget,
+	DrawInstanced,
+	DrawIndexedInstanced,
 
+	Count
 };
 
+class RHICommandListBase;
+
 struct RHICommandBase
 {
 	RHICommandBase* Next;
 
 	void(*ExecuteAndDestructPtr)(RHICommandListBase& commandList, RHICommandBase* command);
 
-	inline RHICommandBase(void(*executeAndDestructPtr)(RHICommandListBase& commandList, RHICommandBase* command))
+	RHICommandType CommandType;
+
+	//Size of the full command structure in bytes
+	uint16_t CommandSize;
+
+	inline RHICommandBase(void(*executeAndDestructPtr)(RHICommandListBase& commandList, RHICommandBase* command), RHICommandType commandType, uint16_t commandSize)
 		:Next(nullptr),
-		ExecuteAndDestructPtr(executeAndDestructPtr)
+		ExecuteAndDestructPtr(executeAndDestructPtr),
+		CommandType(commandType),
+		CommandSize(commandSize)
 	{}
 
 	inline void CallExecuteAndDestruct(RHICommandListBase& commandList)
@@ -75,11 +88,92 @@ struct RHICommandBase
 	}
 };
 
-template <typename TCmd>
+/**
+ *	Records commands into a linear block allocator so recording never goes through the general heap after the first frame.
+ *	Commands are executed against an IRHICommandContext in the order they were recorded.
+ */
+class RHICommandListBase
+{
+public:
+	static const size_t BlockSize = 64 * 1024;
+
+public:
+	RHICommandListBase();
+	~RHICommandListBase();
+
+	void SetContext(IRHICommandContext* context) { Context = context; }
+
+	IRHICommandContext& GetContext() const
+	{
+		assert(Context != nullptr);
+		return *Context;
+	}
+
+	template <typename TCmd, typename ... Args>
+	inline TCmd* AllocCommand(Args&& ... args)
+	{
+		TCmd* command = new (Alloc(sizeof(TCmd), alignof(TCmd))) TCmd(std::forward<Args>(args)...);
+
+		*Tail = command;
+		Tail = &command->Next;
+		CommandCount++;
+
+		return command;
+	}
+
+	/**
+	 *	Allocates memory from the command list's blocks, the memory stays valid until the list is executed or reset.
+	 */
+	void* Alloc(size_t size, size_t alignment);
+
+	/**
+	 *	Executes every recorded command against the context in order and resets the list.
+	 */
+	void Execute();
+
+	/**
+	 *	Discards all recorded commands without executing them. Allocated blocks are kept for reuse.
+	 */
+	void Reset();
+
+	const RHICommandBase* GetHead() const { return Root; }
+	uint32_t GetCommandCount() const { return CommandCount; }
+
+private:
+	RHICommandListBase(const RHICommandListBase&) = delete;
+	RHICommandListBase& operator= (const RHICommandListBase&) = delete;
+
+private:
+	IRHICommandContext* Context;
+
+	RHICommandBase* Root;
+	RHICommandBase** Tail;
+	uint32_t CommandCount;
+
+	std::vector<uint8_t*> Blocks;
+	size_t CurrentBlock;
+	size_t CurrentOffset;
+};
+
+template <typename TCmd, RHICommandType TType, typename TPayload>
 struct RHICommand : public RHICommandBase
 {
+	static_assert(std::is_trivially_copyable<TPayload>::value, "Command payloads are copied byte for byte into captures");
+
+	typedef TPayload PayloadType;
+
+	static const RHICommandType Type = TType;
+
+	//Everything the command needs to execute, kept separate from RHICommandBase so captures don't depend on how the compiler lays out derived members
+	TPayload Payload;
+
 	inline RHICommand()
-		:RHICommandBase(&ExecuteAndDestruct)
+		:RHICommandBase(&ExecuteAndDestruct, TType, static_cast<uint16_t>(sizeof(TCmd)))
+	{}
+
+	inline RHICommand(const TPayload& payload)
+		:RHICommandBase(&ExecuteAndDestruct, TType, static_cast<uint16_t>(sizeof(TCmd))),
+		Payload(payload)
 	{}
 
 	static inline void ExecuteAndDestruct(RHICommandListBase& commandList, RHICommandBase* command)
@@ -90,6 +184,208 @@ struct RHICommand : public RHICommandBase
 	}
 };
 
+/**
+ *	Command payloads are plain values written to captures byte for byte, so their layout is part of the capture format.
+ *	Padding is explicit and zeroed so equal commands have equal bytes. Bump RHICommandCapture::Version when changing one.
+ */
 
+struct RHISetViewportPayload
+{
+	RHIViewport Viewport;
+};
 
-}
\ No newline at end of file
+struct RHISetScissorRectPayload
+{
+	RHIRect Rect;
+};
+
+struct RHISetPrimitiveTopologyPayload
+{
+	RHIPrimitiveTopology Topology;
+};
+
+struct RHISetVertexBufferPayload
+{
+	uint64_t BufferLocation;
+	uint32_t Slot;
+	uint32_t Size;
+	uint32_t Stride;
+	uint32_t Padding;
+};
+
+struct RHISetIndexBufferPayload
+{
+	uint64_t BufferLocation;
+	uint32_t Size;
+	RHIIndexFormat Format;
+};
+
+struct RHISetRootParameterPayload
+{
+	uint64_t Value;
+	uint32_t RootParameterIndex;
+	uint32_t Padding;
+};
+
+struct RHIClearRenderTargetPayload
+{
+	uint64_t RenderTargetDescriptor;
+	float ClearColor[4];
+};
+
+struct RHIDrawInstancedPayload
+{
+	uint32_t VertexCountPerInstance;
+	uint32_t InstanceCount;
+	uint32_t StartVertexLocation;
+	uint32_t StartInstanceLocation;
+};
+
+struct RHIDrawIndexedInstancedPayload
+{
+	uint32_t IndexCountPerInstance;
+	uint32_t InstanceCount;
+	uint32_t StartIndexLocation;
+	int32_t BaseVertexLocation;
+	uint32_t StartInstanceLocation;
+};
+
+static_assert(sizeof(RHISetViewportPayload) == 24, "Capture layout changed");
+static_assert(sizeof(RHISetScissorRectPayload) == 16, "Capture layout changed");
+static_assert(sizeof(RHISetPrimitiveTopologyPayload) == 4, "Capture layout changed");
+static_assert(sizeof(RHISetVertexBufferPayload) == 24 && offsetof(RHISetVertexBufferPayload, Slot) == 8 && offsetof(RHISetVertexBufferPayload, Stride) == 16, "Capture layout changed");
+static_assert(sizeof(RHISetIndexBufferPayload) == 16 && offsetof(RHISetIndexBufferPayload, Size) == 8 && offsetof(RHISetIndexBufferPayload, Format) == 12, "Capture layout changed");
+static_assert(sizeof(RHISetRootParameterPayload) == 16 && offsetof(RHISetRootParameterPayload, RootParameterIndex) == 8, "Capture layout changed");
+static_assert(sizeof(RHIClearRenderTargetPayload) == 24 && offsetof(RHIClearRenderTargetPayload, ClearColor) == 8, "Capture layout changed");
+static_assert(sizeof(RHIDrawInstancedPayload) == 16, "Capture layout changed");
+static_assert(sizeof(RHIDrawIndexedInstancedPayload) == 20 && offsetof(RHIDrawIndexedInstancedPayload, StartInstanceLocation) == 16, "Capture layout changed");
+
+struct RHICommandSetViewport : public RHICommand<RHICommandSetViewport, RHICommandType::SetViewport, RHISetViewportPayload>
+{
+	RHICommandSetViewport() {}
+	RHICommandSetViewport(const RHIViewport& viewport) :RHICommand({ viewport }) {}
+
+	void Execute(RHICommandListBase& commandList) { commandList.GetContext().RHISetViewport(Payload.Viewport); }
+};
+
+struct RHICommandSetScissorRect : public RHICommand<RHICommandSetScissorRect, RHICommandType::SetScissorRect, RHISetScissorRectPayload>
+{
+	RHICommandSetScissorRect() {}
+	RHICommandSetScissorRect(const RHIRect& rect) :RHICommand({ rect }) {}
+
+	void Execute(RHICommandListBase& commandList) { commandList.GetContext().RHISetScissorRect(Payload.Rect); }
+};
+
+struct RHICommandSetPrimitiveTopology : public RHICommand<RHICommandSetPrimitiveTopology, RHICommandType::SetPrimitiveTopology, RHISetPrimitiveTopologyPayload>
+{
+	RHICommandSetPrimitiveTopology() {}
+	RHICommandSetPrimitiveTopology(RHIPrimitiveTopology topology) :RHICommand({ topology }) {}
+
+	void Execute(RHICommandListBase& commandList) { commandList.GetContext().RHISetPrimitiveTopology(Payload.Topology); }
+};
+
+struct RHICommandSetVertexBuffer : public RHICommand<RHICommandSetVertexBuffer, RHICommandType::SetVertexBuffer, RHISetVertexBufferPayload>
+{
+	RHICommandSetVertexBuffer() {}
+	RHICommandSetVertexBuffer(uint32_t slot, uint64_t bufferLocation, uint32_t size, uint32_t stride)
+		:RHICommand({ bufferLocation, slot, size, stride, 0 }) {}
+
+	void Execute(RHICommandListBase& commandList) { commandList.GetContext().RHISetVertexBuffer(Payload.Slot, Payload.BufferLocation, Payload.Size, Payload.Stride); }
+};
+
+struct RHICommandSetIndexBuffer : public RHICommand<RHICommandSetIndexBuffer, RHICommandType::SetIndexBuffer, RHISetIndexBufferPayload>
+{
+	RHICommandSetIndexBuffer() {}
+	RHICommandSetIndexBuffer(uint64_t bufferLocation, uint32_t size, RHIIndexFormat format)
+		:RHICommand({ bufferLocation, size, format }) {}
+
+	void Execute(RHICommandListBase& commandList) { commandList.GetContext().RHISetIndexBuffer(Payload.BufferLocation, Payload.Size, Payload.Format); }
+};
+
+struct RHICommandSetGraphicsRootConstantBufferView : public RHICommand<RHICommandSetGraphicsRootConstantBufferView, RHICommandType::SetGraphicsRootConstantBufferView, RHISetRootParameterPayload>
+{
+	RHICommandSetGraphicsRootConstantBufferView() {}
+	RHICommandSetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t bufferLocation)
+		:RHICommand({ bufferLocation, rootParameterIndex, 0 }) {}
+
+	void Execute(RHICommandListBase& commandList) { commandList.GetContext().RHISetGraphicsRootConstantBufferView(Payload.RootParameterIndex, Payload.Value); }
+};
+
+struct RHICommandSetGraphicsRootDescriptorTable : public RHICommand<RHICommandSetGraphicsRootDescriptorTable, RHICommandType::SetGraphicsRootDescriptorTable, RHISetRootParameterPayload>
+{
+	RHICommandSetGraphicsRootDescriptorTable() {}
+	RHICommandSetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t baseDescriptor)
+		:RHICommand({ baseDescriptor, rootParameterIndex, 0 }) {}
+
+	void Execute(RHICommandListBase& commandList) { commandList.GetContext().RHISetGraphicsRootDescriptorTable(Payload.RootParameterIndex, Payload.Value); }
+};
+
+struct RHICommandClearRenderTarget : public RHICommand<RHICommandClearRenderTarget, RHICommandType::ClearRenderTarget, RHIClearRenderTargetPayload>
+{
+	RHICommandClearRenderTarget() {}
+	RHICommandClearRenderTarget(uint64_t renderTargetDescriptor, const Vector4& clearColor)
+		:RHICommand({ renderTargetDescriptor, { clearColor.x, clearColor.y, clearColor.z, clearColor.w } }) {}
+
+	void Execute(RHICommandListBase& commandList)
+	{
+		const float* color = Payload.ClearColor;
+		commandList.GetContext().RHIClearRenderTarget(Payload.RenderTargetDescriptor, Vector4(color[0], color[1], color[2], color[3]));
+	}
+};
+
+struct RHICommandDrawInstanced : public RHICommand<RHICommandDrawInstanced, RHICommandType::DrawInstanced, RHIDrawInstancedPayload>
+{
+	RHICommandDrawInstanced() {}
+	RHICommandDrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation)
+		:RHICommand({ vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation }) {}
+
+	void Execute(RHICommandListBase& commandList)
+	{
+		commandList.GetContext().RHIDrawInstanced(Payload.VertexCountPerInstance, Payload.InstanceCount, Payload.StartVertexLocation, Payload.StartInstanceLocation);
+	}
+};
+
+struct RHICommandDrawIndexedInstanced : public RHICommand<RHICommandDrawIndexedInstanced, RHICommandType::DrawIndexedInstanced, RHIDrawIndexedInstancedPayload>
+{
+	RHICommandDrawIndexedInstanced() {}
+	RHICommandDrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation)
+		:RHICommand({ indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation }) {}
+
+	void Execute(RHICommandListBase& commandList)
+	{
+		commandList.GetContext().RHIDrawIndexedInstanced(Payload.IndexCountPerInstance, Payload.InstanceCount, Payload.StartIndexLocation, Payload.BaseVertexLocation, Payload.StartInstanceLocation);
+	}
+};
+
+class RHICommandList : public RHICommandListBase
+{
+public:
+	void SetViewport(const RHIViewport& viewport) { AllocCommand<RHICommandSetViewport>(viewport); }
+	void SetScissorRect(const RHIRect& rect) { AllocCommand<RHICommandSetScissorRect>(rect); }
+	void SetPrimitiveTopology(RHIPrimitiveTopology topology) { AllocCommand<RHICommandSetPrimitiveTopology>(topology); }
+
+	void SetVertexBuffer(uint32_t slot, uint64_t bufferLocation, uint32_t size, uint32_t stride) { AllocCommand<RHICommandSetVertexBuffer>(slot, bufferLocation, size, stride); }
+	void SetIndexBuffer(uint64_t bufferLocation, uint32_t size, RHIIndexFormat format) { AllocCommand<RHICommandSetIndexBuffer>(bufferLocation, size, format); }
+
+	void SetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t bufferLocation) { AllocCommand<RHICommandSetGraphicsRootConstantBufferView>(rootParameterIndex, bufferLocation); }
+	void SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t baseDescriptor) { AllocCommand<RHICommandSetGraphicsRootDescriptorTable>(rootParameterIndex, baseDescriptor); }
+
+	void ClearRenderTarget(uint64_t renderTargetDescriptor, const Vector4& clearColor) { AllocCommand<RHICommandClearRenderTarget>(renderTargetDescriptor, clearColor); }
+
+	void DrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation)
+	{
+		AllocCommand<RHICommandDrawInstanced>(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
+	}
+
+	void DrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation)
+	{
+		AllocCommand<RHICommandDrawIndexedInstanced>(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+	}
+
+	//TODO: Remaining commands once resources are abstracted
+	//void ClearDepthStencil(RHITexture2D* depthStencil, ClearFlags clearFlags, float clearDepth, uint8_t clearStencil);
+	//void ClearUnorderedAccessView(RHIResource* resource, const Vector4& value);
+	//void CopyBufferRegion(RHIResource* dstBuffer, uint64_t dstOffset, RHIResource* srcBuffer, uint64_t srcOffset, uint64_t byteCount);
+};
+
+}
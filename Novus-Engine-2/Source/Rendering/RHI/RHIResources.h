@@ -10,6 +10,7 @@
 #include <stdint.h>
 #include <string>
 #include <d3d12.h>
+#include "Utility/Hashing/StringId.h"
 
 namespace novus
 {
@@ -30,13 +31,19 @@ public:
 
 	uint64_t GetResourceSize() const { return ResourceSize; }
 
-	virtual void SetName(const std::wstring& name) { Name = name; }
+	virtual void SetName(const std::wstring& name) { Name = name; NameId = StringId::FromString(name); }
 	std::wstring GetName() const { return Name; }
 
+	/**
+	 *	Hash of the name, compare and look up resources by this rather than the string
+	 */
+	StringId GetNameId() const { return NameId; }
+
 protected:
 	uint64_t ResourceSize;
 
 	std::wstring Name;
+	StringId NameId;
 };
 
 class RHIResourceHeap : public RHIResource
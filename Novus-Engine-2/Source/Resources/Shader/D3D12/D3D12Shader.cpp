@@ -6,12 +6,15 @@
 #include <cassert>
 #include "Utility/Memory/Memory.h"
 #include "D3D12LocalInclude.h"
+#include "Utility/Profiling/Counters.h"
 
 using namespace std::experimental::filesystem;
 
 namespace novus
 {
 
+NE_DEFINE_COUNTER(ShaderCompilesCounter, "Shader/Compiles");
+
 bool D3D12Shader::Compile(const ShaderMacro * macroArr, uint32_t macroCount)
 {
 	std::ifstream shaderFile;
@@ -82,6 +85,8 @@ bool D3D12Shader::Compile(const ShaderMacro * macroArr, uint32_t macroCount)
 	//Handles including files inside shaders
 	D3D12LocalInclude include;
 
+	NE_COUNTER_INCREMENT(ShaderCompilesCounter);
+
 	//Compile the shader
 	HRESULT hr = D3DCompile(
 		shaderSource, 
@@ -1,11 +1,18 @@
 #include "Shader.h"
 #include <fstream>
+#ifdef _MSC_VER
 #include <filesystem>
-#include <vector>
+#else
+#include <experimental/filesystem>
+#endif
 #include <cassert>
 #include "Utility/Memory/Memory.h"
 
+#ifdef _MSC_VER
 using namespace std::experimental::filesystem::v1;
+#else
+using namespace std::experimental::filesystem;
+#endif
 using std::chrono::system_clock;
 using std::chrono::steady_clock;
 
@@ -29,36 +36,29 @@ bool ShaderBase::IsOutdated() const
 	return lastCompileTime < modifyTime;
 }
 
-SHA1Hash ShaderBase::HashMacros(const ShaderMacro * macroArr, uint32_t macroCount)
+Hash128 ShaderBase::HashMacros(const ShaderMacro * macroArr, uint32_t macroCount)
 {
-	SHA1 hasher;
+	//Each macro is hashed on its own and the hashes are summed so the order doesn't matter, this avoids sorting the macros.
+	//A sum rather than xor so a macro defined twice doesn't cancel itself out.
+	Hash128 sum = { 0, 0 };
 
-	std::vector<const ShaderMacro*> macroPtrs;
-
-	macroPtrs.reserve(macroCount);
-
-	for (unsigned int i = 0; i < macroCount; i++)
+	for (uint32_t i = 0; i < macroCount; i++)
 	{
-		macroPtrs.push_back(&macroArr[i]);
-	}
+		const ShaderMacro& macro = macroArr[i];
 
-	//Sort the macros based on their name in alphebetical order, then definition if the names are the same
-	std::sort(macroPtrs.begin(), macroPtrs.end(), [](const ShaderMacro* a, const ShaderMacro* b) {
-		bool next = a->Name == b->Name;
+		//Seeding the definition with the name keeps "AB" "C" and "A" "BC" apart
+		const uint64_t nameHash = FastHash64(macro.Name.data(), macro.Name.size());
+		const Hash128 macroHash = FastHash128(macro.Definition.data(), macro.Definition.size(), nameHash);
 
-		return (next ? (a->Definition < b->Definition) : (a->Name < b->Name));
-	});
-
-	//Hash name and definitons in the macro list
-	for (auto & it : macroPtrs)
-	{
-		hasher.Update(reinterpret_cast<const unsigned char*>(it->Name.c_str()), static_cast<unsigned int>(it->Name.size()));
-		hasher.Update(reinterpret_cast<const unsigned char*>(it->Definition.c_str()), static_cast<unsigned int>(it->Definition.size()));
+		sum.Low += macroHash.Low;
+		sum.High += macroHash.High;
 	}
 
-	hasher.Finalize();
+	Hash128 hash;
+	hash.Low = FastHashCombine(sum.Low, macroCount);
+	hash.High = FastHashCombine(sum.High, ~static_cast<uint64_t>(macroCount));
 
-	return hasher.GetHash();
+	return hash;
 }
 
 }
\ No newline at end of file
@@ -9,7 +9,7 @@
 
 #include <string>
 #include <chrono>
-#include "Utility/Hashing/SHA1.h"
+#include "Utility/Hashing/FastHash.h"
 
 namespace novus
 {
@@ -54,7 +54,7 @@ public:
 	virtual ~ShaderBase() {}
 
 	ShaderType GetType() const { return Type; }
-	SHA1Hash GetHash() const { return InputMacroHash; }
+	Hash128 GetHash() const { return InputMacroHash; }
 	std::wstring GetPath() const { return ShaderPath; }
 	std::string GetEntryPoint() const { return EntryPoint; }
 	size_t GetSize() const { return CompiledSize; }
@@ -71,13 +71,16 @@ public:
 	 */
 	bool IsOutdated() const;
 
-	static SHA1Hash HashMacros(const ShaderMacro* macroArr, uint32_t macroCount);
+	/**
+	 *	Hashes a set of macros to identify a shader permutation, the order of the macros does not matter.
+	 */
+	static Hash128 HashMacros(const ShaderMacro* macroArr, uint32_t macroCount);
 
 private:
 	ShaderType Type;
 
 protected:
-	SHA1Hash InputMacroHash;
+	Hash128 InputMacroHash;
 	std::wstring ShaderPath;
 	std::string EntryPoint;
 
@@ -7,14 +7,20 @@
 
 #pragma once
 
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
 /**
  *	Variadic template based delegate system
  *	Based on method from http://blog.coldflake.com/posts/C++-delegates-on-steroids/ and 
  *		http://www.codeproject.com/Articles/136799/Lightweight-Generic-C-Callbacks-or-Yet-Another-Del
  *
- *	Probably going to avoid using this since std::function works with a lot of other STL stuff already that I don't have the need to remake at the moment.
- *	The main difference is that Delegate objects are comparible for equality unlike std::function since they don't allow as much flexibility and don't have to worry about non comparible functions
- *	This implementation does allow you to construct novus::Delegate objects from functions about 10x faster than std::function objects, but that probably won't matter in most situations
+ *	The main difference from std::function is that Delegate objects are comparible for equality and never allocate.
+ *	Bound objects and lambda captures are stored inline in a small fixed size buffer and calls go through a single function pointer.
+ *	This implementation allows you to construct novus::Delegate objects from functions about 10x faster than std::function objects.
  */
 
 /**
@@ -22,12 +28,8 @@
  *			- Supports functions with any number of arguments (though it's probably a good idea to keep that number under 10)
  *			- Supports returning one value of any type from the function call
  *			- Supports functions marked as const
- */
-
-/**
- *	TODO:
- *		 - Lambda functor support
- *		 - Static/global function support
+ *			- Supports lambdas and other functors, including capturing lambdas up to NE_DELEGATE_INLINE_SIZE bytes
+ *			- Supports static/global functions
  */
 
 /**
@@ -37,30 +39,106 @@
  *			 Foo foo();
  *			 auto d = NE_Delegate(&foo, &Foo::Bar);
  *			 d(); //Invoke the Bar function on foo
+ *
+ *	Lambdas and free functions convert directly
+ *	Example: Delegate<void, int> d = [&foo](int x) { foo.Bar(); };
+ *			 int Square(int x) { return x * x; }
+ *			 Delegate<int, int> square = &Square;
+ *	Overloaded functions such as std::abs need a cast to pick one: static_cast<int(*)(int)>(&std::abs)
+ *
+ *	Captures must be trivially copyable and fit in the inline buffer, anything larger fails to compile rather than allocating.
+ *	Capture a pointer to the state instead of copying it when that happens.
+ *
+ *	Delegates compare equal when they call the same function with the same bound object or the same captured values.
  */
 
+//Size in bytes of the inline storage for bound objects and lambda captures
+#ifndef NE_DELEGATE_INLINE_SIZE
+#define NE_DELEGATE_INLINE_SIZE (3 * sizeof(void*))
+#endif
+
 namespace novus
 {
 
+namespace detail
+{
+	template <typename T, typename return_type, typename... params>
+	struct DelegateFactory;
+
+	/**
+	 *	True when a TFunctor can be called with lvalues of params..., the way Delegate calls it, and the result converts to return_type.
+	 */
+	template <typename TFunctor, typename return_type, typename... params>
+	struct IsDelegateCallable
+	{
+	private:
+		template <typename T, typename TResult = decltype(std::declval<T&>()(std::declval<params&>()...))>
+		static std::is_convertible<TResult, return_type> Test(int);
+
+		template <typename T>
+		static std::false_type Test(...);
+
+	public:
+		static const bool value = decltype(Test<TFunctor>(0))::value;
+	};
+}
+
 template <typename return_type, typename ... params>
 class Delegate
 {
 	typedef return_type(*Type)(void* callee, params ...);
+	typedef return_type(*StubType)(void* storage, params ...);
+
 public:
+	static const size_t InlineSize = NE_DELEGATE_INLINE_SIZE;
+
 	Delegate()
-		:Callee(nullptr),
-		CallbackFunction(nullptr)
-	{}
+		:Stub(nullptr)
+	{
+		memset(&Storage, 0, sizeof(Storage));
+	}
 
 	Delegate(void* callee, Type function)
-		:Callee(callee),
-		CallbackFunction(function)
-	{}
+		:Stub(&BoundFunctionCaller)
+	{
+		memset(&Storage, 0, sizeof(Storage));
+
+		BoundFunction bound = { callee, function };
+		new (&Storage) BoundFunction(bound);
+	}
+
+	/**
+	 *	Constructs a delegate from a lambda, functor or free function pointer.
+	 *	The functor is copied into the inline storage.
+	 *	Only takes part in overload resolution when the functor can be called with params... and returns something convertible to return_type.
+	 */
+	template <typename TFunctor, typename = typename std::enable_if<!std::is_same<typename std::decay<TFunctor>::type, Delegate>::value &&
+		detail::IsDelegateCallable<TFunctor, return_type, params...>::value>::type>
+	Delegate(TFunctor functor)
+		:Stub(&FunctorCaller<TFunctor>)
+	{
+		static_assert(sizeof(TFunctor) <= InlineSize, "Functor is too large to store in a Delegate, capture a pointer to the state instead");
+		static_assert(std::alignment_of<TFunctor>::value <= std::alignment_of<StorageType>::value, "Functor alignment is too large to store in a Delegate");
+		static_assert(std::is_trivially_copyable<TFunctor>::value, "Delegate captures must be trivially copyable");
+
+		memset(&Storage, 0, sizeof(Storage));
+		new (&Storage) TFunctor(functor);
+	}
 
 	template <class T, return_type (T::*TFunction)(params...)>
 	static Delegate FromFunction(T* callee)
 	{
-		Delegate d(callee, &FunctionCaller<T, TFunction>);
+		return FromObject(callee, &MemberFunctionCaller<T, TFunction>);
+	}
+
+	/**
+	 *	Binds a free function at compile time so it can be called without going through a stored function pointer
+	 */
+	template <return_type (*TFunction)(params...)>
+	static Delegate FromFunction()
+	{
+		Delegate d;
+		d.Stub = &StaticFunctionCaller<TFunction>;
 		return d;
 	}
 
@@ -69,51 +147,91 @@ public:
 	 */
 	return_type operator()(params ... xs) const
 	{
-		return (*CallbackFunction)(Callee, xs...);
+		return (*Stub)(&Storage, xs...);
 	}
 
 	bool operator== (const Delegate<return_type, params...>& other) const
 	{
-		return this->Callee == other.Callee && this->CallbackFunction == other.CallbackFunction;
+		return this->Stub == other.Stub && memcmp(&this->Storage, &other.Storage, sizeof(Storage)) == 0;
 	}
 
 	bool operator!= (const Delegate<return_type, params...>& other) const
 	{
-		return this->Callee != other.Callee || this->CallbackFunction != other.CallbackFunction;
+		return !(*this == other);
 	}
 
 	/**
 	 *	Comparisons against invalid alternate types of delegates
 	 */
 	template <typename return_type2, typename ... params2>
-	bool operator==(const Delegate<return_type2, params2...>& other)
+	bool operator==(const Delegate<return_type2, params2...>&) const
 	{
 		return false;
 	}
 
 	template <typename return_type2, typename ... params2>
-	bool operator!=(const Delegate<return_type2, params2...>& other)
+	bool operator!=(const Delegate<return_type2, params2...>&) const
 	{
 		return true;
 	}
 
 	bool IsValid() const
 	{
-		return CallbackFunction != nullptr;
+		return Stub != nullptr;
 	}
 
 private:
-	void* Callee;
-	Type CallbackFunction;
+	struct BoundFunction
+	{
+		void* Callee;
+		Type Function;
+	};
+
+	typedef typename std::aligned_storage<InlineSize, std::alignment_of<void*>::value>::type StorageType;
+
+	//Storage is zeroed before anything is copied into it so padding bytes don't affect equality
+	mutable StorageType Storage;
+	StubType Stub;
+
+	static return_type BoundFunctionCaller(void* storage, params... xs)
+	{
+		BoundFunction* bound = static_cast<BoundFunction*>(storage);
+		return (*bound->Function)(bound->Callee, xs...);
+	}
+
+	template <typename TFunctor>
+	static return_type FunctorCaller(void* storage, params... xs)
+	{
+		return (*static_cast<TFunctor*>(storage))(xs...);
+	}
+
+	template <return_type(*TFunction)(params...)>
+	static return_type StaticFunctionCaller(void*, params... xs)
+	{
+		return (*TFunction)(xs...);
+	}
 
 	template <class T, return_type(T::*TFunction)(params...)>
-	static return_type FunctionCaller(void* callee, params... xs)
+	static return_type MemberFunctionCaller(void* storage, params... xs)
 	{
-		assert(callbackFunction != nullptr);
+		T* p = *static_cast<T**>(storage);
+		assert(p != nullptr);
 
-		T* p = static_cast<T*>(callee);
 		return (p->*TFunction)(xs...);
 	}
+
+	//Stores only the object pointer, the stub has the member function baked in so calls don't need a second indirection
+	template <class T>
+	static Delegate FromObject(T* callee, StubType stub)
+	{
+		Delegate d;
+		d.Stub = stub;
+		new (&d.Storage) T*(callee);
+		return d;
+	}
+
+	template <typename T, typename return_type2, typename... params2>
+	friend struct detail::DelegateFactory;
 };
 
 namespace detail
@@ -121,28 +239,22 @@ namespace detail
 	template <typename T, typename return_type, typename... params>
 	struct DelegateFactory
 	{
-		template <return_type(T::*Func)(params...)>
-		static return_type FunctionCaller(void* o, params... xs)
-		{
-			return (static_cast<T*>(o)->*Func)(xs...);
-		}
-
 		template <return_type(T::*Func)(params...) const>
-		static return_type FunctionCallerConst(void* o, params... xs)
+		static return_type FunctionCallerConst(void* storage, params... xs)
 		{
-			return (static_cast<T*>(o)->*Func)(xs...);
+			return ((*static_cast<T**>(storage))->*Func)(xs...);
 		}
 
 		template <return_type(T::*Func)(params...)>
 		static Delegate<return_type, params...> Bind(T* o)
 		{
-			return Delegate<return_type, params...>(o, &DelegateFactory::FunctionCaller<Func>);
+			return Delegate<return_type, params...>::template FromFunction<T, Func>(o);
 		}
 
 		template <return_type(T::*Func)(params...) const>
 		static Delegate<return_type, params...> Bind(T* o)
 		{
-			return Delegate<return_type, params...>(o, &DelegateFactory::FunctionCallerConst<Func>);
+			return Delegate<return_type, params...>::FromObject(o, &DelegateFactory::FunctionCallerConst<Func>);
 		}
 	};
 
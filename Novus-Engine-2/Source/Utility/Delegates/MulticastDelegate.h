@@ -8,41 +8,211 @@
 #pragma once
 
 #include "Delegate.h"
+#include "Utility/Threading/ThreadPool.h"
+#include <stdint.h>
 #include <vector>
+#include <tuple>
+#include <utility>
 #include <cassert>
-#include <algorithm>
-#include <list>
-#include <functional>
 
 namespace novus
 {
 
+/**
+ *	Identifies one subscription to a MulticastDelegate so it can be removed in constant time.
+ *	Handles become stale once the subscription is removed, removing with a stale handle does nothing.
+ */
+struct DelegateHandle
+{
+	DelegateHandle()
+		:Slot(InvalidSlot),
+		Generation(0)
+	{}
+
+	bool IsValid() const { return Slot != InvalidSlot; }
+
+	bool operator== (const DelegateHandle& other) const { return Slot == other.Slot && Generation == other.Generation; }
+	bool operator!= (const DelegateHandle& other) const { return !(*this == other); }
+
+	static const uint32_t InvalidSlot = 0xFFFFFFFF;
+
+	uint32_t Slot;
+	uint32_t Generation;
+};
+
+/**
+ *	List of delegates invoked together.
+ *	Targets are kept in a contiguous array and invoked in the order they were added.
+ *
+ *	Delegates may be added or removed from inside a callback. Targets added during a dispatch are first called on the next dispatch,
+ *	targets removed during a dispatch are not called again.
+ *
+ *	Targets added as thread safe can be spread across a ThreadPool with InvokeParallel.
+ *
+ *	A MulticastDelegate is not itself thread safe. Dispatches compact the target array, so invoking, adding and removing
+ *	must all happen on one thread at a time, the only concurrency is between the thread safe targets of one InvokeParallel.
+ */
 template <typename return_type, typename ... params>
 class MulticastDelegate
 {
+	typedef Delegate<return_type, params...> DelegateType;
+
 public:
-	void operator() (params... xs) const
+	MulticastDelegate()
+		:DispatchDepth(0),
+		RemovedCount(0),
+		ThreadSafeCount(0)
+	{}
+
+	void operator() (params... xs)
 	{
-		for (const auto& d : Delegates)
+		if (DispatchDepth == 0 && RemovedCount > 0)
+			Compact();
+
+		//Targets added by callbacks are appended past this point and wait for the next dispatch
+		const size_t count = Entries.size();
+
+		DispatchDepth++;
+
+		for (size_t i = 0; i < count; i++)
 		{
+			if (!Entries[i].bAlive)
+				continue;
+
+			//Callbacks can add targets and reallocate the array, so call through a copy
+			const DelegateType d = Entries[i].Target;
 			d(xs...);
 		}
+
+		DispatchDepth--;
 	}
 
-	MulticastDelegate& operator+= (const Delegate<return_type, params...>& d)
+	/**
+	 *	Invokes the thread safe targets across the pool's workers and the calling thread, then the remaining targets serially in order.
+	 *	Returns once every target has been called.
+	 *	Thread safe targets may run concurrently with each other and must not add or remove targets of this delegate,
+	 *	serial targets can as usual.
+	 *	@param grainSize Number of targets each worker invokes at a time, 0 picks one based on the number of targets and workers
+	 */
+	void InvokeParallel(ThreadPool& pool, size_t grainSize, params... xs)
 	{
-		Delegates.push_back(d);
+		if (DispatchDepth == 0 && RemovedCount > 0)
+			Compact();
 
-		return *this;
+		const size_t count = Entries.size();
+
+		DispatchDepth++;
+
+		if (ThreadSafeCount > 0)
+		{
+			if (grainSize == 0)
+				grainSize = count / ((pool.GetThreadCount() + 1) * 4) + 1;
+
+			//Arguments are passed to the workers by pointer so the range delegate fits its inline storage
+			std::tuple<params...> args(xs...);
+			const std::tuple<params...>* argsPtr = &args;
+
+			Delegate<void, size_t, size_t> invokeRange = [this, argsPtr](size_t begin, size_t end)
+			{
+				for (size_t i = begin; i < end; i++)
+				{
+					if (Entries[i].bAlive && Entries[i].bThreadSafe)
+						InvokeWithArgs(Entries[i].Target, *argsPtr, std::index_sequence_for<params...>());
+				}
+			};
+
+			pool.ParallelFor(count, grainSize, invokeRange);
+		}
+
+		for (size_t i = 0; i < count; i++)
+		{
+			if (!Entries[i].bAlive || Entries[i].bThreadSafe)
+				continue;
+
+			const DelegateType d = Entries[i].Target;
+			d(xs...);
+		}
+
+		DispatchDepth--;
+	}
+
+	void InvokeParallel(params... xs)
+	{
+		InvokeParallel(*ThreadPool::GetInstance(), 0, xs...);
+	}
+
+	/**
+	 *	Adds a target and returns a handle that removes it in constant time.
+	 *	@param bThreadSafe Allows InvokeParallel to call the target from worker threads concurrently with other thread safe targets
+	 */
+	DelegateHandle Add(const DelegateType& d, bool bThreadSafe = false)
+	{
+		//Keep removed targets from piling up when targets are churned without dispatching
+		if (DispatchDepth == 0 && RemovedCount > Entries.size() / 2)
+			Compact();
+
+		DelegateHandle handle;
+
+		if (FreeSlots.empty())
+		{
+			handle.Slot = static_cast<uint32_t>(Slots.size());
+			Slots.push_back(SlotEntry());
+		}
+		else
+		{
+			handle.Slot = FreeSlots.back();
+			FreeSlots.pop_back();
+		}
+
+		SlotEntry& slot = Slots[handle.Slot];
+		slot.EntryIndex = static_cast<uint32_t>(Entries.size());
+		handle.Generation = slot.Generation;
+
+		Entry entry;
+		entry.Target = d;
+		entry.Slot = handle.Slot;
+		entry.bAlive = true;
+		entry.bThreadSafe = bThreadSafe;
+		Entries.push_back(entry);
+
+		if (bThreadSafe)
+			ThreadSafeCount++;
+
+		return handle;
+	}
+
+	/**
+	 *	Removes the target added with the handle.
+	 *	@return false if the handle was already removed
+	 */
+	bool Remove(DelegateHandle handle)
+	{
+		if (handle.Slot >= Slots.size() || Slots[handle.Slot].Generation != handle.Generation)
+			return false;
+
+		RemoveEntry(Slots[handle.Slot].EntryIndex);
+
+		return true;
 	}
 
-	MulticastDelegate& operator-= (const Delegate<return_type, params...>& d)
+	MulticastDelegate& operator+= (const DelegateType& d)
 	{
-		auto endIt = std::remove_if(Delegates.begin(), Delegates.end(),
-			[&](const Delegate<return_type, params...>& other)
-		{ return d == other; });
+		Add(d);
 
-		Delegates.erase(endIt, Delegates.end());
+		return *this;
+	}
+
+	/**
+	 *	Removes every target equal to the delegate.
+	 *	Prefer keeping the handle returned by Add, this has to search all targets.
+	 */
+	MulticastDelegate& operator-= (const DelegateType& d)
+	{
+		for (size_t i = 0; i < Entries.size(); i++)
+		{
+			if (Entries[i].bAlive && Entries[i].Target == d)
+				RemoveEntry(static_cast<uint32_t>(i));
+		}
 
 		return *this;
 	}
@@ -52,7 +222,11 @@ public:
 	 */
 	void Clear()
 	{
-		Delegates.clear();
+		for (size_t i = 0; i < Entries.size(); i++)
+		{
+			if (Entries[i].bAlive)
+				RemoveEntry(static_cast<uint32_t>(i));
+		}
 	}
 
 	/**
@@ -60,11 +234,94 @@ public:
 	 */
 	size_t GetSize() const
 	{
-		return Delegates.size();
+		return Entries.size() - RemovedCount;
+	}
+
+	/**
+	 *	Reserve space for a number of targets so adding them does not reallocate
+	 */
+	void Reserve(size_t count)
+	{
+		Entries.reserve(count);
+		Slots.reserve(count);
 	}
 
 private:
-	std::list<Delegate<return_type, params...>> Delegates;
+	struct Entry
+	{
+		DelegateType Target;
+		uint32_t Slot;
+		bool bAlive;
+		bool bThreadSafe;
+	};
+
+	struct SlotEntry
+	{
+		SlotEntry()
+			:EntryIndex(0),
+			Generation(0)
+		{}
+
+		uint32_t EntryIndex;
+		//Incremented whenever the slot is freed so old handles stop matching
+		uint32_t Generation;
+	};
+
+	void RemoveEntry(uint32_t index)
+	{
+		Entry& entry = Entries[index];
+		assert(entry.bAlive);
+
+		entry.bAlive = false;
+		RemovedCount++;
+
+		if (entry.bThreadSafe)
+			ThreadSafeCount--;
+
+		Slots[entry.Slot].Generation++;
+		FreeSlots.push_back(entry.Slot);
+	}
+
+	template <size_t... Indices>
+	static void InvokeWithArgs(const DelegateType& d, const std::tuple<params...>& args, std::index_sequence<Indices...>)
+	{
+		d(std::get<Indices>(args)...);
+	}
+
+	/**
+	 *	Removes dead entries while keeping the order of the remaining ones.
+	 *	Deferred until the next dispatch or add so removal stays constant time and never disturbs a dispatch in progress.
+	 */
+	void Compact()
+	{
+		size_t writeIndex = 0;
+
+		for (size_t readIndex = 0; readIndex < Entries.size(); readIndex++)
+		{
+			if (!Entries[readIndex].bAlive)
+				continue;
+
+			if (writeIndex != readIndex)
+			{
+				Entries[writeIndex] = Entries[readIndex];
+				Slots[Entries[writeIndex].Slot].EntryIndex = static_cast<uint32_t>(writeIndex);
+			}
+
+			writeIndex++;
+		}
+
+		Entries.resize(writeIndex);
+		RemovedCount = 0;
+	}
+
+private:
+	std::vector<Entry> Entries;
+	std::vector<SlotEntry> Slots;
+	std::vector<uint32_t> FreeSlots;
+
+	uint32_t DispatchDepth;
+	size_t RemovedCount;
+	size_t ThreadSafeCount;
 };
 
-};
\ No newline at end of file
+};
@@ -0,0 +1,153 @@
+#include "EventBus.h"
+#include "Utility/Profiling/Counters.h"
+#include <algorithm>
+#include <atomic>
+
+NE_DEFINE_COUNTER(EventsDispatchedCounter, "Events/Dispatched");
+
+namespace novus
+{
+
+namespace detail
+{
+	EventTypeId AllocateEventTypeId()
+	{
+		static std::atomic<EventTypeId> nextId(0);
+
+		return nextId.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+EventBus* EventBus::StaticInstance = nullptr;
+
+EventBus* EventBus::GetInstance()
+{
+	if (StaticInstance == nullptr)
+	{
+		StaticInstance = new EventBus();
+	}
+
+	return StaticInstance;
+}
+
+EventBus::ThreadQueue::ThreadQueue()
+	:PostedCount(0)
+{
+	EventBus::GetInstance()->AddThreadQueue(this);
+}
+
+EventBus::ThreadQueue::~ThreadQueue()
+{
+	EventBus::GetInstance()->RemoveThreadQueue(this);
+}
+
+EventBus::ThreadQueue& EventBus::GetThreadQueue()
+{
+	static thread_local ThreadQueue queue;
+
+	return queue;
+}
+
+void EventBus::AddThreadQueue(ThreadQueue* queue)
+{
+	std::lock_guard<std::mutex> lock(RegistryLock);
+
+	ThreadQueues.push_back(queue);
+}
+
+void EventBus::RemoveThreadQueue(ThreadQueue* queue)
+{
+	std::lock_guard<std::mutex> lock(RegistryLock);
+
+	//Keep the events of exiting threads around until the next dispatch
+	for (size_t type = 0; type < queue->Queues.size(); type++)
+	{
+		std::unique_ptr<IEventQueue>& events = queue->Queues[type];
+
+		if (!events || events->IsEmpty())
+			continue;
+
+		if (type >= RetiredQueues.size())
+			RetiredQueues.resize(type + 1);
+
+		if (!RetiredQueues[type])
+			RetiredQueues[type] = std::move(events);
+		else
+			events->MoveTo(*RetiredQueues[type]);
+	}
+
+	auto endIt = std::remove(ThreadQueues.begin(), ThreadQueues.end(), queue);
+	ThreadQueues.erase(endIt, ThreadQueues.end());
+}
+
+void EventBus::Unsubscribe(const EventSubscription& subscription)
+{
+	if (subscription.Type < Channels.size() && Channels[subscription.Type])
+		Channels[subscription.Type]->Unsubscribe(subscription);
+}
+
+void EventBus::CollectEvents(ThreadQueue& queue)
+{
+	std::lock_guard<std::mutex> lock(queue.Lock);
+
+	if (queue.PostedCount == 0)
+		return;
+
+	for (size_t type = 0; type < queue.Queues.size(); type++)
+	{
+		IEventQueue* events = queue.Queues[type].get();
+
+		if (events == nullptr || events->IsEmpty())
+			continue;
+
+		if (type < Channels.size() && Channels[type])
+			events->MoveTo(Channels[type]->GetPending());
+		else
+			events->Clear();
+	}
+
+	queue.PostedCount = 0;
+}
+
+size_t EventBus::DispatchEvents()
+{
+	{
+		std::lock_guard<std::mutex> lock(RegistryLock);
+
+		for (ThreadQueue* queue : ThreadQueues)
+		{
+			CollectEvents(*queue);
+		}
+
+		for (size_t type = 0; type < RetiredQueues.size(); type++)
+		{
+			if (!RetiredQueues[type] || RetiredQueues[type]->IsEmpty())
+				continue;
+
+			if (type < Channels.size() && Channels[type])
+				RetiredQueues[type]->MoveTo(Channels[type]->GetPending());
+			else
+				RetiredQueues[type]->Clear();
+		}
+	}
+
+	size_t dispatchedCount = 0;
+
+	//Channels can be added by handlers subscribing to new event types, those have nothing pending yet
+	const size_t channelCount = Channels.size();
+
+	for (size_t type = 0; type < channelCount; type++)
+	{
+		if (!Channels[type])
+			continue;
+
+		dispatchedCount += Channels[type]->GetPending().GetSize();
+		Channels[type]->Dispatch();
+	}
+
+	NE_COUNTER_ADD(EventsDispatchedCounter, dispatchedCount);
+
+	return dispatchedCount;
+}
+
+}
@@ -0,0 +1,285 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "Utility/Delegates/MulticastDelegate.h"
+
+/**
+ *	Engine wide typed event bus.
+ *
+ *	Any thread can post an event, it is appended to a queue owned by the posting thread so producers never contend with each other.
+ *	Events are delivered when DispatchEvents is called at a fixed point in the frame on the main thread.
+ *	All pending events of one type are gathered into a contiguous array and handed to the batch handlers in one call,
+ *	then to the per event handlers in order.
+ *
+ *	Usage: struct AssetLoadedEvent { uint32_t AssetId; };
+ *		   auto subscription = EventBus::GetInstance()->Subscribe<AssetLoadedEvent>(NE_Delegate(&loader, &Loader::OnAssetLoaded));
+ *		   EventBus::GetInstance()->Post(AssetLoadedEvent{ 5 }); //From any thread
+ *		   EventBus::GetInstance()->DispatchEvents(); //Once per frame, calls loader.OnAssetLoaded
+ *
+ *	Events posted by one thread are delivered in the order they were posted, there is no ordering between threads or between event types.
+ *	Events posted from inside a handler are delivered on the next dispatch.
+ *	Events of a type without any subscribers are discarded.
+ *	Subscribing, unsubscribing and dispatching must all happen on the same thread.
+ */
+
+namespace novus
+{
+
+typedef uint32_t EventTypeId;
+
+namespace detail
+{
+	EventTypeId AllocateEventTypeId();
+
+	template <typename TEvent>
+	struct EventType
+	{
+		static EventTypeId GetId()
+		{
+			static const EventTypeId id = AllocateEventTypeId();
+			return id;
+		}
+	};
+}
+
+class IEventQueue
+{
+public:
+	virtual ~IEventQueue() {}
+
+	virtual bool IsEmpty() const = 0;
+	virtual size_t GetSize() const = 0;
+	virtual void Clear() = 0;
+
+	/**
+	 *	Moves all events into another queue of the same type.
+	 *	Swaps the arrays when the destination is empty so allocations get recycled between producers and the dispatcher.
+	 */
+	virtual void MoveTo(IEventQueue& destination) = 0;
+};
+
+template <typename TEvent>
+class EventQueue : public IEventQueue
+{
+public:
+	bool IsEmpty() const override { return Events.empty(); }
+	size_t GetSize() const override { return Events.size(); }
+	void Clear() override { Events.clear(); }
+
+	void MoveTo(IEventQueue& destination) override
+	{
+		std::vector<TEvent>& destinationEvents = static_cast<EventQueue<TEvent>&>(destination).Events;
+
+		if (destinationEvents.empty())
+		{
+			destinationEvents.swap(Events);
+		}
+		else
+		{
+			destinationEvents.insert(destinationEvents.end(), std::make_move_iterator(Events.begin()), std::make_move_iterator(Events.end()));
+			Events.clear();
+		}
+	}
+
+	std::vector<TEvent> Events;
+};
+
+/**
+ *	Returned from Subscribe, removes the handler when passed to Unsubscribe.
+ */
+struct EventSubscription
+{
+	EventSubscription()
+		:Type(0),
+		bBatch(false)
+	{}
+
+	EventTypeId Type;
+	DelegateHandle Handle;
+	bool bBatch;
+};
+
+class EventBus
+{
+public:
+	static EventBus* GetInstance();
+
+	/**
+	 *	Queues an event for the next dispatch. Safe to call from any thread.
+	 */
+	template <typename TEvent>
+	void Post(const TEvent& event)
+	{
+		const EventTypeId type = detail::EventType<TEvent>::GetId();
+		ThreadQueue& queue = GetThreadQueue();
+
+		//Only contended while the dispatcher is collecting this thread's events
+		std::lock_guard<std::mutex> lock(queue.Lock);
+
+		static_cast<EventQueue<TEvent>&>(queue.GetQueue<TEvent>(type)).Events.push_back(event);
+		queue.PostedCount++;
+	}
+
+	/**
+	 *	Subscribes a handler that is called once per event.
+	 */
+	template <typename TEvent>
+	EventSubscription Subscribe(const Delegate<void, const TEvent&>& handler)
+	{
+		EventSubscription subscription;
+		subscription.Type = detail::EventType<TEvent>::GetId();
+		subscription.Handle = GetChannel<TEvent>().Handlers.Add(handler);
+		subscription.bBatch = false;
+
+		return subscription;
+	}
+
+	/**
+	 *	Subscribes a handler that receives every pending event of the type as one contiguous array per dispatch.
+	 */
+	template <typename TEvent>
+	EventSubscription SubscribeBatch(const Delegate<void, const TEvent*, size_t>& handler)
+	{
+		EventSubscription subscription;
+		subscription.Type = detail::EventType<TEvent>::GetId();
+		subscription.Handle = GetChannel<TEvent>().BatchHandlers.Add(handler);
+		subscription.bBatch = true;
+
+		return subscription;
+	}
+
+	void Unsubscribe(const EventSubscription& subscription);
+
+	/**
+	 *	Collects the events queued by every thread and delivers them to the subscribed handlers.
+	 *	Only the collection takes locks, handlers are invoked without any locks held.
+	 *	@return Number of events collected, including events of types whose handlers have all unsubscribed
+	 */
+	size_t DispatchEvents();
+
+private:
+	class IEventChannel
+	{
+	public:
+		virtual ~IEventChannel() {}
+
+		virtual IEventQueue& GetPending() = 0;
+		virtual void Dispatch() = 0;
+		virtual void Unsubscribe(const EventSubscription& subscription) = 0;
+	};
+
+	template <typename TEvent>
+	class EventChannel : public IEventChannel
+	{
+	public:
+		IEventQueue& GetPending() override { return Pending; }
+
+		void Dispatch() override
+		{
+			if (Pending.IsEmpty())
+				return;
+
+			const std::vector<TEvent>& events = Pending.Events;
+
+			BatchHandlers(events.data(), events.size());
+
+			if (Handlers.GetSize() > 0)
+			{
+				for (const TEvent& event : events)
+				{
+					Handlers(event);
+				}
+			}
+
+			Pending.Clear();
+		}
+
+		void Unsubscribe(const EventSubscription& subscription) override
+		{
+			if (subscription.bBatch)
+				BatchHandlers.Remove(subscription.Handle);
+			else
+				Handlers.Remove(subscription.Handle);
+		}
+
+		EventQueue<TEvent> Pending;
+		MulticastDelegate<void, const TEvent*, size_t> BatchHandlers;
+		MulticastDelegate<void, const TEvent&> Handlers;
+	};
+
+	struct ThreadQueue
+	{
+		ThreadQueue();
+		~ThreadQueue();
+
+		template <typename TEvent>
+		IEventQueue& GetQueue(EventTypeId type)
+		{
+			if (type >= Queues.size())
+				Queues.resize(type + 1);
+
+			if (!Queues[type])
+				Queues[type].reset(new EventQueue<TEvent>());
+
+			return *Queues[type];
+		}
+
+		std::mutex Lock;
+		//Indexed by event type id
+		std::vector<std::unique_ptr<IEventQueue>> Queues;
+		uint64_t PostedCount;
+	};
+
+	//Only allow access via GetInstance
+	EventBus() {}
+	~EventBus() {}
+	EventBus(const EventBus&) = delete;
+	EventBus& operator= (const EventBus&) = delete;
+
+	static ThreadQueue& GetThreadQueue();
+
+	void AddThreadQueue(ThreadQueue* queue);
+	void RemoveThreadQueue(ThreadQueue* queue);
+
+	//Moves the events of every type that has subscribers into the channels, must be called with RegistryLock held
+	void CollectEvents(ThreadQueue& queue);
+
+	template <typename TEvent>
+	EventChannel<TEvent>& GetChannel()
+	{
+		const EventTypeId type = detail::EventType<TEvent>::GetId();
+
+		if (type >= Channels.size())
+			Channels.resize(type + 1);
+
+		if (!Channels[type])
+			Channels[type].reset(new EventChannel<TEvent>());
+
+		return static_cast<EventChannel<TEvent>&>(*Channels[type]);
+	}
+
+private:
+	static EventBus* StaticInstance;
+
+	std::mutex RegistryLock;
+	std::vector<ThreadQueue*> ThreadQueues;
+
+	//Holds events posted by threads that exited before the next dispatch
+	std::vector<std::unique_ptr<IEventQueue>> RetiredQueues;
+
+	//Indexed by event type id, only touched by the dispatching thread
+	std::vector<std::unique_ptr<IEventChannel>> Channels;
+};
+
+}
@@ -1,5 +1,7 @@
 #include "GeometryGenerator.h"
 #include "Math/Math.h"
+#include "Math/FastMath.h"
+#include "Math/Packing.h"
 
 namespace novus
 {
@@ -195,34 +197,40 @@ void GeometryGenerator::CreateSphere(float radius, uint32_t sliceCount, uint32_t
 	{
 		float phi = i*phiStep;
 
+		float sinPhi, cosPhi;
+		fastmath::SinCos<FastMathPrecision::High>(phi, sinPhi, cosPhi);
+
 		// Vertices of ring.
 		for (uint32_t j = 0; j <= sliceCount; ++j)
 		{
 			float theta = j*thetaStep;
 
+			float sinTheta, cosTheta;
+			fastmath::SinCos<FastMathPrecision::High>(theta, sinTheta, cosTheta);
+
 			Vertex v;
 
 			// spherical to cartesian
-			v.Position.x = sinf(phi)*cosf(theta);
-			v.Position.y = cosf(phi);
-			v.Position.z = sinf(phi)*sinf(theta);
+			v.Position.x = sinPhi*cosTheta;
+			v.Position.y = cosPhi;
+			v.Position.z = sinPhi*sinTheta;
 
-			v.Normal = Normalize(v.Position);
+			v.Normal = fastmath::Normalize<FastMathPrecision::High>(v.Position);
 
 			// Partial derivative of P with respect to theta
-			v.Tangent.x = -radius*sinf(phi)*sinf(theta);
+			v.Tangent.x = -radius*sinPhi*sinTheta;
 			v.Tangent.y = 0.0f;
-			v.Tangent.z = +radius*sinf(phi)*cosf(theta);
+			v.Tangent.z = +radius*sinPhi*cosTheta;
 
 			/*v.Bitangent.x = 0.0f;
-			v.Bitangent.y = radius*-sinf(phi);
-			v.Bitangent.z = +radius*sinf(phi)*cosf(theta);*/
+			v.Bitangent.y = radius*-sinPhi;
+			v.Bitangent.z = +radius*sinPhi*cosTheta;*/
 
-			v.Tangent = Normalize(v.Tangent);
+			v.Tangent = fastmath::Normalize<FastMathPrecision::High>(v.Tangent);
 
 			//v.Bitangent = Normalize(v.Bitangent);
 
-			v.Position = Normalize(v.Position) * radius;
+			v.Position = v.Normal * radius;
 
 			v.TexCoord.x = theta / Math::TwoPi;
 			v.TexCoord.y = phi / Math::Pi;
@@ -304,21 +312,27 @@ void GeometryGenerator::CreateSphere(float radius, uint32_t sliceCount, uint32_t
 	{
 		float phi = i*phiStep;
 
+		float sinPhi, cosPhi;
+		fastmath::SinCos<FastMathPrecision::High>(phi, sinPhi, cosPhi);
+
 		// Vertices of ring.
 		for (uint32_t j = 0; j <= sliceCount; ++j)
 		{
 			float theta = j*thetaStep;
 
+			float sinTheta, cosTheta;
+			fastmath::SinCos<FastMathPrecision::High>(theta, sinTheta, cosTheta);
+
 			SimpleVertex v;
 
 			// spherical to cartesian
-			v.Position.x = sinf(phi)*cosf(theta);
-			v.Position.y = cosf(phi);
-			v.Position.z = sinf(phi)*sinf(theta);
+			v.Position.x = sinPhi*cosTheta;
+			v.Position.y = cosPhi;
+			v.Position.z = sinPhi*sinTheta;
 
-			v.Normal = Normalize(v.Position);
+			v.Normal = fastmath::Normalize<FastMathPrecision::High>(v.Position);
 
-			v.Position = Normalize(v.Position) * radius;
+			v.Position = v.Normal * radius;
 
 			mesh.Vertices.push_back(v);
 		}
@@ -502,7 +516,7 @@ void GeometryGenerator::CreateGeosphere(float radius, uint32_t numSubdivisions,
 	for (uint32_t i = 0; i < mesh.Vertices.size(); ++i)
 	{
 		// Project onto unit sphere.
-		Vector3 n = Normalize(mesh.Vertices[i].Position);
+		Vector3 n = fastmath::Normalize<FastMathPrecision::High>(mesh.Vertices[i].Position);
 
 		// Project onto sphere.
 		Vector3 p = radius*n;
@@ -511,25 +525,28 @@ void GeometryGenerator::CreateGeosphere(float radius, uint32_t numSubdivisions,
 		mesh.Vertices[i].Normal = n;
 
 		// Derive texture coordinates from spherical coordinates.
-		float theta = atan2(
-			mesh.Vertices[i].Position.z,
-			mesh.Vertices[i].Position.x);
+		float theta = fastmath::Atan2<FastMathPrecision::High>(n.z, n.x);
 
-		float phi = acosf(mesh.Vertices[i].Position.y / radius);
+		float phi = fastmath::Acos<FastMathPrecision::High>(n.y);
 
 		mesh.Vertices[i].TexCoord.x = theta / Math::TwoPi;
 		mesh.Vertices[i].TexCoord.y = phi / Math::Pi;
 
+		float sinTheta, cosTheta;
+		fastmath::SinCos<FastMathPrecision::High>(theta, sinTheta, cosTheta);
+
+		const float sinPhi = fastmath::Sin<FastMathPrecision::High>(phi);
+
 		// Partial derivative of P with respect to theta
-		mesh.Vertices[i].Tangent.x = -radius*sinf(phi)*sinf(theta);
+		mesh.Vertices[i].Tangent.x = -radius*sinPhi*sinTheta;
 		mesh.Vertices[i].Tangent.y = 0.0f;
-		mesh.Vertices[i].Tangent.z = +radius*sinf(phi)*cosf(theta);
+		mesh.Vertices[i].Tangent.z = +radius*sinPhi*cosTheta;
 
 		/*mesh.Vertices[i].Bitangent.x = 0.0f;
-		mesh.Vertices[i].Bitangent.y = radius*-sinf(phi);
-		mesh.Vertices[i].Bitangent.z = +radius*sinf(phi)*cosf(theta);*/
+		mesh.Vertices[i].Bitangent.y = radius*-sinPhi;
+		mesh.Vertices[i].Bitangent.z = +radius*sinPhi*cosTheta;*/
 
-		mesh.Vertices[i].Tangent = Normalize(mesh.Vertices[i].Tangent);
+		mesh.Vertices[i].Tangent = fastmath::Normalize<FastMathPrecision::High>(mesh.Vertices[i].Tangent);
 
 		//mesh.Vertices[i].Bitangent = Normalize(mesh.Vertices[i].Bitangent);
 	}
@@ -764,47 +781,45 @@ void GeometryGenerator::CreatePlane(float width, float depth, uint32_t m, uint32
 
 void GeometryGenerator::CreateSkybox(std::vector<Vector3>& vertices, std::vector<uint32_t>& indices)
 {
-	Vector3 v[24];
-
-	float w2 = 1.0f;
-	float h2 = 1.0f;
-	float d2 = 1.0f;
-
-	//Front face
-	v[0] = Vector3(-w2, -h2, -d2);
-	v[1] = Vector3(-w2, +h2, -d2);
-	v[2] = Vector3(+w2, +h2, -d2);
-	v[3] = Vector3(+w2, -h2, -d2);
-
-	//Back face
-	v[4] = Vector3(-w2, -h2, +d2);
-	v[5] = Vector3(+w2, -h2, +d2);
-	v[6] = Vector3(+w2, +h2, +d2);
-	v[7] = Vector3(-w2, +h2, +d2);
-
-	//Top face
-	v[8] = Vector3(-w2, +h2, -d2);
-	v[9] = Vector3(-w2, +h2, +d2);
-	v[10] = Vector3(+w2, +h2, +d2);
-	v[11] = Vector3(+w2, +h2, -d2);
-
-	//Bottom face
-	v[12] = Vector3(-w2, -h2, -d2);
-	v[13] = Vector3(+w2, -h2, -d2);
-	v[14] = Vector3(+w2, -h2, +d2);
-	v[15] = Vector3(-w2, -h2, +d2);
-
-	//Left face
-	v[16] = Vector3(-w2, -h2, +d2);
-	v[17] = Vector3(-w2, +h2, +d2);
-	v[18] = Vector3(-w2, +h2, -d2);
-	v[19] = Vector3(-w2, -h2, -d2);
-
-	//Right face
-	v[20] = Vector3(+w2, -h2, -d2);
-	v[21] = Vector3(+w2, +h2, -d2);
-	v[22] = Vector3(+w2, +h2, +d2);
-	v[23] = Vector3(+w2, -h2, +d2);
+	//Unit cube, built at compile time
+	static constexpr Vector3 v[24] =
+	{
+		//Front face
+		Vector3(-1.0f, -1.0f, -1.0f),
+		Vector3(-1.0f, +1.0f, -1.0f),
+		Vector3(+1.0f, +1.0f, -1.0f),
+		Vector3(+1.0f, -1.0f, -1.0f),
+
+		//Back face
+		Vector3(-1.0f, -1.0f, +1.0f),
+		Vector3(+1.0f, -1.0f, +1.0f),
+		Vector3(+1.0f, +1.0f, +1.0f),
+		Vector3(-1.0f, +1.0f, +1.0f),
+
+		//Top face
+		Vector3(-1.0f, +1.0f, -1.0f),
+		Vector3(-1.0f, +1.0f, +1.0f),
+		Vector3(+1.0f, +1.0f, +1.0f),
+		Vector3(+1.0f, +1.0f, -1.0f),
+
+		//Bottom face
+		Vector3(-1.0f, -1.0f, -1.0f),
+		Vector3(+1.0f, -1.0f, -1.0f),
+		Vector3(+1.0f, -1.0f, +1.0f),
+		Vector3(-1.0f, -1.0f, +1.0f),
+
+		//Left face
+		Vector3(-1.0f, -1.0f, +1.0f),
+		Vector3(-1.0f, +1.0f, +1.0f),
+		Vector3(-1.0f, +1.0f, -1.0f),
+		Vector3(-1.0f, -1.0f, -1.0f),
+
+		//Right face
+		Vector3(+1.0f, -1.0f, -1.0f),
+		Vector3(+1.0f, +1.0f, -1.0f),
+		Vector3(+1.0f, +1.0f, +1.0f),
+		Vector3(+1.0f, -1.0f, +1.0f)
+	};
 
 	vertices.assign(&v[0], &v[24]);
 
@@ -841,4 +856,27 @@ void GeometryGenerator::CreateSkybox(std::vector<Vector3>& vertices, std::vector
 	indices.assign(&i[0], &i[36]);
 }
 
+void GeometryGenerator::CompressMesh(const Mesh& mesh, PackedMesh& packed)
+{
+	const size_t vertexCount = mesh.Vertices.size();
+
+	packed.Vertices.resize(vertexCount);
+	packed.Indices = mesh.Indices;
+
+	if (vertexCount == 0)
+		return;
+
+	PackOctahedralNormals(&mesh.Vertices[0].Normal, sizeof(Vertex), &packed.Vertices[0].Normal, sizeof(PackedVertex), vertexCount);
+
+	for (size_t i = 0; i < vertexCount; i++)
+	{
+		const Vertex& vertex = mesh.Vertices[i];
+		PackedVertex& packedVertex = packed.Vertices[i];
+
+		packedVertex.Position = vertex.Position;
+		packedVertex.Tangent = PackUnorm1010102(Vector4(vertex.Tangent * 0.5f + Vector3(0.5f), 1.0f));
+		packedVertex.TexCoord = PackHalf2(vertex.TexCoord);
+	}
+}
+
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 //Adapted from code accompanying the book Introduction to 3D Game Programming with DirectX 11 code written by Frank Luna
 
+#include <stdint.h>
 #include <vector>
 #include <list>
 #include "Math/Vector2.h"
@@ -85,6 +86,25 @@ public:
 		std::vector<uint32_t> Indices;
 	};
 
+	///<summary>
+	/// 24 byte version of Vertex made by CompressMesh, the input layout formats of the fields are
+	/// Position R32G32B32_FLOAT, Normal R16G16_SNORM as an octahedral encoding,
+	/// Tangent R10G10B10A2_UNORM holding xyz * 0.5 + 0.5 and TexCoord R16G16_FLOAT.
+	///</summary>
+	struct PackedVertex
+	{
+		Vector3 Position;
+		uint32_t Normal;
+		uint32_t Tangent;
+		uint32_t TexCoord;
+	};
+
+	struct PackedMesh
+	{
+		std::vector<PackedVertex> Vertices;
+		std::vector<uint32_t> Indices;
+	};
+
 public:
 	///<summary>
 	/// Creates a box centered at the origin with the given dimensions.
@@ -122,6 +142,13 @@ public:
 
 	static void CreateSkybox(std::vector<Vector3>& vertices, std::vector<uint32_t>& indices);
 
+	///<summary>
+	/// Packs the vertices of a mesh into PackedVertex. Positions keep full precision, texture
+	/// coordinates become halves whose steps are 1/1024 between 1 and 2 and grow with the value,
+	/// so meshes that tile a texture many times should stay in a Mesh.
+	///</summary>
+	static void CompressMesh(const Mesh& mesh, PackedMesh& packed);
+
 private:
 	static void Subdivide(Mesh& meshData);
 	static void BuildCylinderTopCap(float bottomRadius, float topRadius, float height, uint32_t sliceCount, uint32_t stackCount, Mesh& mesh);
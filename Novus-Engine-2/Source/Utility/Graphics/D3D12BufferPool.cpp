@@ -1,5 +1,7 @@
 #include "D3D12BufferPool.h"
 #include <cassert>
+#include <cstring>
+#include "Utility/Profiling/Counters.h"
 
 #define CHK(result) \
 	if (result != S_OK) \
@@ -10,6 +12,8 @@
 namespace novus
 {
 
+NE_DEFINE_COUNTER(BufferPoolBytesWrittenCounter, "BufferPool/BytesWritten");
+
 D3D12BufferPool::D3D12BufferPool()
 	:AlignedStride(0),
 	SlotCount(0),
@@ -96,4 +100,15 @@ void D3D12BufferPool::Unmap(uint32_t slot)
 	assert(slot < SlotCount);
 }
 
+void D3D12BufferPool::Write(uint32_t slot, const void* data, uint32_t size)
+{
+	assert(slot < SlotCount);
+	assert(size <= BufferSize);
+
+	memcpy(Map(slot), data, size);
+	Unmap(slot);
+
+	NE_COUNTER_ADD(BufferPoolBytesWrittenCounter, size);
+}
+
 }
\ No newline at end of file
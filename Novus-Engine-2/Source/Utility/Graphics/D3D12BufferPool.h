@@ -4,12 +4,16 @@
 #include <stdint.h>
 #include <wrl.h>
 #include <vector>
+#include "Utility/Profiling/Counters.h"
 
 using Microsoft::WRL::ComPtr;
 
 namespace novus
 {
 
+//Bytes written into pool slots, code that fills a mapped slot directly instead of calling Write adds its own bytes
+NE_DECLARE_COUNTER(BufferPoolBytesWrittenCounter);
+
 class D3D12BufferPool
 {
 public:
@@ -24,6 +28,11 @@ public:
 	void* Map(uint32_t slot);
 	void Unmap(uint32_t slot);
 
+	/**
+	 *	Copies data into the specified slot, size must not be larger than the buffer size.
+	 */
+	void Write(uint32_t slot, const void* data, uint32_t size);
+
 	uint32_t GetBufferSize() const { return BufferSize; }
 	uint32_t GetAlignedStride() const { return AlignedStride; }
 	uint32_t GetSlotCount() const { return SlotCount; }
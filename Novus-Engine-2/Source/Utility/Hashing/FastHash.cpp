@@ -0,0 +1,260 @@
+#include "FastHash.h"
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace novus
+{
+
+namespace
+{
+	const uint64_t Secret[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+	//Seed offset for the second half of 128 bit hashes
+	const uint64_t HighSeedOffset = 0x9E3779B97F4A7C15ull;
+
+	/**
+	 *	Full 64x64 -> 128 bit multiply, low half in a and high half in b
+	 */
+	inline void Multiply128(uint64_t& a, uint64_t& b)
+	{
+#if defined(__SIZEOF_INT128__)
+		const __uint128_t result = static_cast<__uint128_t>(a) * b;
+		a = static_cast<uint64_t>(result);
+		b = static_cast<uint64_t>(result >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+		a = _umul128(a, b, &b);
+#else
+		const uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+		const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+		const uint64_t t = rl + (rm0 << 32);
+		uint64_t carry = t < rl;
+		const uint64_t lo = t + (rm1 << 32);
+		carry += lo < t;
+		a = lo;
+		b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+	}
+
+	inline uint64_t Mix(uint64_t a, uint64_t b)
+	{
+		Multiply128(a, b);
+		return a ^ b;
+	}
+
+	inline uint64_t Read8(const uint8_t* p)
+	{
+		uint64_t value;
+		memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	inline uint64_t Read4(const uint8_t* p)
+	{
+		uint32_t value;
+		memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	inline uint64_t Read3(const uint8_t* p, size_t length)
+	{
+		return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[length >> 1]) << 8) | p[length - 1];
+	}
+
+	inline uint64_t InitialSeed(uint64_t seed)
+	{
+		return seed ^ Mix(seed ^ Secret[0], Secret[1]);
+	}
+
+	inline uint64_t ConsumeBlock16(const uint8_t* p, uint64_t seed)
+	{
+		return Mix(Read8(p) ^ Secret[1], Read8(p + 8) ^ seed);
+	}
+
+	/**
+	 *	Inputs of at most 16 bytes
+	 */
+	inline void ReadShort(const uint8_t* p, size_t length, uint64_t& a, uint64_t& b)
+	{
+		if (length >= 4)
+		{
+			a = (Read4(p) << 32) | Read4(p + ((length >> 3) << 2));
+			b = (Read4(p + length - 4) << 32) | Read4(p + length - 4 - ((length >> 3) << 2));
+		}
+		else if (length > 0)
+		{
+			a = Read3(p, length);
+			b = 0;
+		}
+		else
+		{
+			a = 0;
+			b = 0;
+		}
+	}
+
+	/**
+	 *	Mixes the last 1-48 bytes, p must be preceded by at least 16 readable bytes when remaining < 16
+	 */
+	inline uint64_t FinishLong(const uint8_t* p, size_t remaining, uint64_t seed, uint64_t totalLength)
+	{
+		while (remaining > 16)
+		{
+			seed = ConsumeBlock16(p, seed);
+			remaining -= 16;
+			p += 16;
+		}
+
+		uint64_t a = Read8(p + remaining - 16) ^ Secret[1];
+		uint64_t b = Read8(p + remaining - 8) ^ seed;
+		Multiply128(a, b);
+
+		return Mix(a ^ Secret[0] ^ totalLength, b ^ Secret[1]);
+	}
+
+	inline uint64_t FinishShort(const uint8_t* p, size_t length, uint64_t seed)
+	{
+		uint64_t a, b;
+		ReadShort(p, length, a, b);
+
+		a ^= Secret[1];
+		b ^= seed;
+		Multiply128(a, b);
+
+		return Mix(a ^ Secret[0] ^ length, b ^ Secret[1]);
+	}
+}
+
+uint64_t FastHash64(const void* data, size_t length, uint64_t seed)
+{
+	const uint8_t* p = static_cast<const uint8_t*>(data);
+	seed = InitialSeed(seed);
+
+	if (length <= 16)
+		return FinishShort(p, length, seed);
+
+	size_t remaining = length;
+
+	//Strictly more than a stripe, the last 1-48 bytes always go through FinishLong
+	if (remaining > 48)
+	{
+		uint64_t seed1 = seed;
+		uint64_t seed2 = seed;
+
+		do
+		{
+			seed = Mix(Read8(p) ^ Secret[1], Read8(p + 8) ^ seed);
+			seed1 = Mix(Read8(p + 16) ^ Secret[2], Read8(p + 24) ^ seed1);
+			seed2 = Mix(Read8(p + 32) ^ Secret[3], Read8(p + 40) ^ seed2);
+			p += 48;
+			remaining -= 48;
+		} while (remaining > 48);
+
+		seed ^= seed1 ^ seed2;
+	}
+
+	return FinishLong(p, remaining, seed, length);
+}
+
+Hash128 FastHash128(const void* data, size_t length, uint64_t seed)
+{
+	Hash128 hash;
+	hash.Low = FastHash64(data, length, seed);
+	hash.High = FastHash64(data, length, seed + HighSeedOffset);
+
+	return hash;
+}
+
+uint64_t FastHashCombine(uint64_t a, uint64_t b)
+{
+	return Mix(a ^ Secret[0], b ^ Secret[1]);
+}
+
+FastHasher::FastHasher(uint64_t seed)
+{
+	Reset(seed);
+}
+
+void FastHasher::Reset(uint64_t seed)
+{
+	Seed = InitialSeed(seed);
+	Seed1 = Seed;
+	Seed2 = Seed;
+	TotalLength = 0;
+	BufferedLength = 0;
+}
+
+void FastHasher::ConsumeStripe(const uint8_t* data)
+{
+	Seed = Mix(Read8(data) ^ Secret[1], Read8(data + 8) ^ Seed);
+	Seed1 = Mix(Read8(data + 16) ^ Secret[2], Read8(data + 24) ^ Seed1);
+	Seed2 = Mix(Read8(data + 32) ^ Secret[3], Read8(data + 40) ^ Seed2);
+}
+
+void FastHasher::Update(const void* data, size_t length)
+{
+	const uint8_t* p = static_cast<const uint8_t*>(data);
+	uint8_t* pending = Buffer + HistorySize;
+
+	TotalLength += length;
+
+	//A stripe is only consumed once more data follows it since the last 1-48 bytes are mixed by Finalize, so up to a full stripe stays pending
+	if (BufferedLength + length <= StripeSize)
+	{
+		memcpy(pending + BufferedLength, p, length);
+		BufferedLength += length;
+		return;
+	}
+
+	//Top up a partially filled stripe first
+	if (BufferedLength > 0)
+	{
+		const size_t copyLength = StripeSize - BufferedLength;
+		memcpy(pending + BufferedLength, p, copyLength);
+		p += copyLength;
+		length -= copyLength;
+
+		ConsumeStripe(pending);
+		memcpy(Buffer, pending + StripeSize - HistorySize, HistorySize);
+		BufferedLength = 0;
+	}
+
+	//Whole stripes are consumed straight from the input
+	if (length > StripeSize)
+	{
+		do
+		{
+			ConsumeStripe(p);
+			p += StripeSize;
+			length -= StripeSize;
+		} while (length > StripeSize);
+
+		memcpy(Buffer, p - HistorySize, HistorySize);
+	}
+
+	if (length > 0)
+	{
+		memcpy(pending, p, length);
+		BufferedLength = length;
+	}
+}
+
+uint64_t FastHasher::Finalize() const
+{
+	const uint8_t* pending = Buffer + HistorySize;
+
+	//Anything this short never filled a stripe so it is all still pending
+	if (TotalLength <= 16)
+		return FinishShort(pending, static_cast<size_t>(TotalLength), Seed);
+
+	uint64_t seed = Seed;
+
+	if (TotalLength > StripeSize)
+		seed ^= Seed1 ^ Seed2;
+
+	return FinishLong(pending, BufferedLength, seed, TotalLength);
+}
+
+}
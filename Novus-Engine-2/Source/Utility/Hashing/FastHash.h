@@ -0,0 +1,112 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+/**
+ *	Fast non-cryptographic hashing, FastHash64 produces the same results as wyhash final version 4 by Wang Yi
+ *	(public domain, https://github.com/wangyi-fudan/wyhash)
+ *
+ *	Use for cache keys, permutation keys, hash maps and string interning.
+ *	It is not collision resistant against deliberate attacks, use SHA1 when that matters.
+ *	Results depend on the byte order of the platform.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <type_traits>
+
+namespace novus
+{
+
+struct Hash128
+{
+	uint64_t Low;
+	uint64_t High;
+
+	bool operator== (const Hash128& o) const { return Low == o.Low && High == o.High; }
+	bool operator!= (const Hash128& o) const { return !(*this == o); }
+	bool operator< (const Hash128& o) const { return High != o.High ? High < o.High : Low < o.Low; }
+};
+
+uint64_t FastHash64(const void* data, size_t length, uint64_t seed = 0);
+
+/**
+ *	Two independently seeded 64 bit hashes, for keys where the number of entries makes 64 bit collisions a concern.
+ */
+Hash128 FastHash128(const void* data, size_t length, uint64_t seed = 0);
+
+/**
+ *	Mixes two hashes into one, order dependent.
+ */
+uint64_t FastHashCombine(uint64_t a, uint64_t b);
+
+/**
+ *	Streaming version of FastHash64, produces the same hash as hashing all of the data at once.
+ */
+class FastHasher
+{
+public:
+	explicit FastHasher(uint64_t seed = 0);
+
+	void Reset(uint64_t seed = 0);
+
+	void Update(const void* data, size_t length);
+
+	/**
+	 *	Hashes the bytes of a value, only for types without padding
+	 */
+	template <typename T>
+	void UpdateValue(const T& value)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be hashed by their bytes");
+		Update(&value, sizeof(T));
+	}
+
+	void UpdateString(const std::string& value)
+	{
+		//Include the length so consecutive strings can't run into each other
+		UpdateValue(static_cast<uint64_t>(value.size()));
+		Update(value.data(), value.size());
+	}
+
+	/**
+	 *	Gets the hash of everything passed to Update so far, more data can still be added afterwards
+	 */
+	uint64_t Finalize() const;
+
+private:
+	static const size_t StripeSize = 48;
+	static const size_t HistorySize = 16;
+
+	void ConsumeStripe(const uint8_t* data);
+
+private:
+	uint64_t Seed;
+	uint64_t Seed1;
+	uint64_t Seed2;
+	uint64_t TotalLength;
+
+	//The final mix reads the last 16 bytes of the input, even if they belong to an already consumed stripe
+	//so the end of the previous stripe is kept in front of the pending bytes
+	uint8_t Buffer[HistorySize + StripeSize];
+	size_t BufferedLength;
+};
+
+/**
+ *	Hash functor for containers such as std::unordered_map<std::string, T, FastStringHash>
+ */
+struct FastStringHash
+{
+	size_t operator()(const std::string& value) const
+	{
+		return static_cast<size_t>(FastHash64(value.data(), value.size()));
+	}
+};
+
+}
@@ -1,6 +1,10 @@
 #include "SHA1.h"
+#include "SHA1Kernels.h"
+#include "Utility/Platform/CpuFeatures.h"
+#include <algorithm>
 #include <memory>
 #include <cassert>
+#include <cstring>
 #include <iostream>
 
 #define SHA1_MAX_FILE_BUFFER (32 * 20 * 820)
@@ -38,6 +42,194 @@
 namespace novus
 {
 
+namespace
+{
+	struct KernelSelection
+	{
+		SHA1Kernel SingleStream;
+		SHA1Kernel MultiBuffer;
+		detail::SHA1TransformFunction Transform;
+	};
+
+	KernelSelection SelectKernel(SHA1Kernel kernel)
+	{
+		KernelSelection selection;
+		selection.SingleStream = SHA1Kernel::Scalar;
+		selection.MultiBuffer = kernel;
+		selection.Transform = &detail::SHA1TransformScalar;
+
+#if NE_PLATFORM_X86
+		if (kernel == SHA1Kernel::SHANI)
+		{
+			selection.SingleStream = SHA1Kernel::SHANI;
+			selection.Transform = &detail::SHA1TransformSHANI;
+		}
+#endif
+
+		return selection;
+	}
+
+	KernelSelection SelectFastestKernel()
+	{
+		KernelSelection selection = SelectKernel(SHA1::IsKernelSupported(SHA1Kernel::SHANI) ? SHA1Kernel::SHANI : SHA1Kernel::Scalar);
+
+		//8 AVX2 lanes keep up with the SHA extensions hashing one buffer after another on large buffers and beat them on small ones
+		if (SHA1::IsKernelSupported(SHA1Kernel::AVX2MultiBuffer))
+			selection.MultiBuffer = SHA1Kernel::AVX2MultiBuffer;
+
+		return selection;
+	}
+
+	KernelSelection& GetKernelSelection()
+	{
+		static KernelSelection selection = SelectFastestKernel();
+
+		return selection;
+	}
+
+	void StoreDigest(const UINT_32* state, UINT_8* digest)
+	{
+		for (UINT_32 i = 0; i < 20; ++i)
+			digest[i] = static_cast<UINT_8>((state[i >> 2] >> ((3 - (i & 3)) * 8)) & 0xFF);
+	}
+
+#if NE_PLATFORM_X86
+	/**
+	 *	Padded final blocks of one multi-buffer lane, built the same way Finalize pads the message
+	 */
+	struct LaneTail
+	{
+		UINT_8 Blocks[2 * detail::SHA1BlockSize];
+		size_t BlockCount;
+	};
+
+	void BuildLaneTail(const UINT_8* data, UINT_32 length, LaneTail& tail)
+	{
+		const UINT_32 remainder = length % detail::SHA1BlockSize;
+		const UINT_64 bitCount = static_cast<UINT_64>(length) * 8;
+
+		tail.BlockCount = remainder < 56 ? 1 : 2;
+
+		memset(tail.Blocks, 0, sizeof(tail.Blocks));
+		if (remainder > 0)
+			memcpy(tail.Blocks, data + (length - remainder), remainder);
+		tail.Blocks[remainder] = 0x80;
+
+		UINT_8* end = tail.Blocks + tail.BlockCount * detail::SHA1BlockSize;
+		for (int i = 0; i < 8; i++)
+			end[-1 - i] = static_cast<UINT_8>((bitCount >> (i * 8)) & 0xFF);
+	}
+
+	void HashBuffersAVX2(const UINT_8* const* data, const UINT_32* lengths, size_t count, SHA1Hash* hashes)
+	{
+		static const UINT_8 unusedBlock[detail::SHA1BlockSize] = {};
+		const uint32_t laneCount = detail::SHA1MultiBufferLanes;
+
+		for (size_t first = 0; first < count; first += laneCount)
+		{
+			const uint32_t groupSize = static_cast<uint32_t>(std::min<size_t>(laneCount, count - first));
+
+			uint32_t states[detail::SHA1MultiBufferLanes][5];
+			LaneTail tails[detail::SHA1MultiBufferLanes];
+			size_t fullBlocks[detail::SHA1MultiBufferLanes] = {};
+			size_t totalBlocks[detail::SHA1MultiBufferLanes] = {};
+			size_t maxBlocks = 0;
+
+			for (uint32_t lane = 0; lane < laneCount; lane++)
+			{
+				states[lane][0] = 0x67452301;
+				states[lane][1] = 0xEFCDAB89;
+				states[lane][2] = 0x98BADCFE;
+				states[lane][3] = 0x10325476;
+				states[lane][4] = 0xC3D2E1F0;
+
+				if (lane >= groupSize)
+					continue;
+
+				BuildLaneTail(data[first + lane], lengths[first + lane], tails[lane]);
+
+				fullBlocks[lane] = lengths[first + lane] / detail::SHA1BlockSize;
+				totalBlocks[lane] = fullBlocks[lane] + tails[lane].BlockCount;
+				maxBlocks = std::max(maxBlocks, totalBlocks[lane]);
+			}
+
+			for (size_t block = 0; block < maxBlocks; block++)
+			{
+				const UINT_8* blocks[detail::SHA1MultiBufferLanes];
+				uint32_t activeMask = 0;
+
+				for (uint32_t lane = 0; lane < laneCount; lane++)
+				{
+					if (block < fullBlocks[lane])
+						blocks[lane] = data[first + lane] + block * detail::SHA1BlockSize;
+					else if (block < totalBlocks[lane])
+						blocks[lane] = tails[lane].Blocks + (block - fullBlocks[lane]) * detail::SHA1BlockSize;
+					else
+						blocks[lane] = unusedBlock;
+
+					if (block < totalBlocks[lane])
+						activeMask |= 1u << lane;
+				}
+
+				detail::SHA1TransformAVX2x8(states, blocks, activeMask);
+			}
+
+			for (uint32_t lane = 0; lane < groupSize; lane++)
+			{
+				StoreDigest(states[lane], hashes[first + lane].Hash);
+			}
+		}
+	}
+#endif
+}
+
+namespace detail
+{
+
+void SHA1TransformScalar(uint32_t* state, const uint8_t* data, size_t blockCount)
+{
+	SHA1_WORKSPACE_BLOCK workspace;
+	SHA1_WORKSPACE_BLOCK* Block = &workspace;
+
+	for (; blockCount > 0; blockCount--, data += SHA1BlockSize)
+	{
+		UINT_32 a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+
+		memcpy(Block, data, 64);
+
+		// 4 rounds of 20 operations each, loop unrolled
+		S_R0(a, b, c, d, e, 0); S_R0(e, a, b, c, d, 1); S_R0(d, e, a, b, c, 2); S_R0(c, d, e, a, b, 3);
+		S_R0(b, c, d, e, a, 4); S_R0(a, b, c, d, e, 5); S_R0(e, a, b, c, d, 6); S_R0(d, e, a, b, c, 7);
+		S_R0(c, d, e, a, b, 8); S_R0(b, c, d, e, a, 9); S_R0(a, b, c, d, e, 10); S_R0(e, a, b, c, d, 11);
+		S_R0(d, e, a, b, c, 12); S_R0(c, d, e, a, b, 13); S_R0(b, c, d, e, a, 14); S_R0(a, b, c, d, e, 15);
+		S_R1(e, a, b, c, d, 16); S_R1(d, e, a, b, c, 17); S_R1(c, d, e, a, b, 18); S_R1(b, c, d, e, a, 19);
+		S_R2(a, b, c, d, e, 20); S_R2(e, a, b, c, d, 21); S_R2(d, e, a, b, c, 22); S_R2(c, d, e, a, b, 23);
+		S_R2(b, c, d, e, a, 24); S_R2(a, b, c, d, e, 25); S_R2(e, a, b, c, d, 26); S_R2(d, e, a, b, c, 27);
+		S_R2(c, d, e, a, b, 28); S_R2(b, c, d, e, a, 29); S_R2(a, b, c, d, e, 30); S_R2(e, a, b, c, d, 31);
+		S_R2(d, e, a, b, c, 32); S_R2(c, d, e, a, b, 33); S_R2(b, c, d, e, a, 34); S_R2(a, b, c, d, e, 35);
+		S_R2(e, a, b, c, d, 36); S_R2(d, e, a, b, c, 37); S_R2(c, d, e, a, b, 38); S_R2(b, c, d, e, a, 39);
+		S_R3(a, b, c, d, e, 40); S_R3(e, a, b, c, d, 41); S_R3(d, e, a, b, c, 42); S_R3(c, d, e, a, b, 43);
+		S_R3(b, c, d, e, a, 44); S_R3(a, b, c, d, e, 45); S_R3(e, a, b, c, d, 46); S_R3(d, e, a, b, c, 47);
+		S_R3(c, d, e, a, b, 48); S_R3(b, c, d, e, a, 49); S_R3(a, b, c, d, e, 50); S_R3(e, a, b, c, d, 51);
+		S_R3(d, e, a, b, c, 52); S_R3(c, d, e, a, b, 53); S_R3(b, c, d, e, a, 54); S_R3(a, b, c, d, e, 55);
+		S_R3(e, a, b, c, d, 56); S_R3(d, e, a, b, c, 57); S_R3(c, d, e, a, b, 58); S_R3(b, c, d, e, a, 59);
+		S_R4(a, b, c, d, e, 60); S_R4(e, a, b, c, d, 61); S_R4(d, e, a, b, c, 62); S_R4(c, d, e, a, b, 63);
+		S_R4(b, c, d, e, a, 64); S_R4(a, b, c, d, e, 65); S_R4(e, a, b, c, d, 66); S_R4(d, e, a, b, c, 67);
+		S_R4(c, d, e, a, b, 68); S_R4(b, c, d, e, a, 69); S_R4(a, b, c, d, e, 70); S_R4(e, a, b, c, d, 71);
+		S_R4(d, e, a, b, c, 72); S_R4(c, d, e, a, b, 73); S_R4(b, c, d, e, a, 74); S_R4(a, b, c, d, e, 75);
+		S_R4(e, a, b, c, d, 76); S_R4(d, e, a, b, c, 77); S_R4(c, d, e, a, b, 78); S_R4(b, c, d, e, a, 79);
+
+		// Add the working vars back into State
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+	}
+}
+
+}
+
 std::ostream& operator<< (std::ostream& os, const SHA1Hash& hash)
 {
 	for (int i = 0; i < 20; i++)
@@ -86,7 +278,6 @@ bool SHA1Hash::operator>= (const SHA1Hash& o) const
 }
 
 SHA1::SHA1()
-	:Block((SHA1_WORKSPACE_BLOCK*)Workspace)
 {
 	Reset();
 }
@@ -106,42 +297,6 @@ void SHA1::Reset()
 	Count[1] = 0;
 }
 
-void SHA1::Transform(UINT_32* pState, const UINT_8* pBuffer)
-{
-	UINT_32 a = pState[0], b = pState[1], c = pState[2], d = pState[3], e = pState[4];
-
-	memcpy(Block, pBuffer, 64);
-
-	// 4 rounds of 20 operations each, loop unrolled
-	S_R0(a, b, c, d, e, 0); S_R0(e, a, b, c, d, 1); S_R0(d, e, a, b, c, 2); S_R0(c, d, e, a, b, 3);
-	S_R0(b, c, d, e, a, 4); S_R0(a, b, c, d, e, 5); S_R0(e, a, b, c, d, 6); S_R0(d, e, a, b, c, 7);
-	S_R0(c, d, e, a, b, 8); S_R0(b, c, d, e, a, 9); S_R0(a, b, c, d, e, 10); S_R0(e, a, b, c, d, 11);
-	S_R0(d, e, a, b, c, 12); S_R0(c, d, e, a, b, 13); S_R0(b, c, d, e, a, 14); S_R0(a, b, c, d, e, 15);
-	S_R1(e, a, b, c, d, 16); S_R1(d, e, a, b, c, 17); S_R1(c, d, e, a, b, 18); S_R1(b, c, d, e, a, 19);
-	S_R2(a, b, c, d, e, 20); S_R2(e, a, b, c, d, 21); S_R2(d, e, a, b, c, 22); S_R2(c, d, e, a, b, 23);
-	S_R2(b, c, d, e, a, 24); S_R2(a, b, c, d, e, 25); S_R2(e, a, b, c, d, 26); S_R2(d, e, a, b, c, 27);
-	S_R2(c, d, e, a, b, 28); S_R2(b, c, d, e, a, 29); S_R2(a, b, c, d, e, 30); S_R2(e, a, b, c, d, 31);
-	S_R2(d, e, a, b, c, 32); S_R2(c, d, e, a, b, 33); S_R2(b, c, d, e, a, 34); S_R2(a, b, c, d, e, 35);
-	S_R2(e, a, b, c, d, 36); S_R2(d, e, a, b, c, 37); S_R2(c, d, e, a, b, 38); S_R2(b, c, d, e, a, 39);
-	S_R3(a, b, c, d, e, 40); S_R3(e, a, b, c, d, 41); S_R3(d, e, a, b, c, 42); S_R3(c, d, e, a, b, 43);
-	S_R3(b, c, d, e, a, 44); S_R3(a, b, c, d, e, 45); S_R3(e, a, b, c, d, 46); S_R3(d, e, a, b, c, 47);
-	S_R3(c, d, e, a, b, 48); S_R3(b, c, d, e, a, 49); S_R3(a, b, c, d, e, 50); S_R3(e, a, b, c, d, 51);
-	S_R3(d, e, a, b, c, 52); S_R3(c, d, e, a, b, 53); S_R3(b, c, d, e, a, 54); S_R3(a, b, c, d, e, 55);
-	S_R3(e, a, b, c, d, 56); S_R3(d, e, a, b, c, 57); S_R3(c, d, e, a, b, 58); S_R3(b, c, d, e, a, 59);
-	S_R4(a, b, c, d, e, 60); S_R4(e, a, b, c, d, 61); S_R4(d, e, a, b, c, 62); S_R4(c, d, e, a, b, 63);
-	S_R4(b, c, d, e, a, 64); S_R4(a, b, c, d, e, 65); S_R4(e, a, b, c, d, 66); S_R4(d, e, a, b, c, 67);
-	S_R4(c, d, e, a, b, 68); S_R4(b, c, d, e, a, 69); S_R4(a, b, c, d, e, 70); S_R4(e, a, b, c, d, 71);
-	S_R4(d, e, a, b, c, 72); S_R4(c, d, e, a, b, 73); S_R4(b, c, d, e, a, 74); S_R4(a, b, c, d, e, 75);
-	S_R4(e, a, b, c, d, 76); S_R4(d, e, a, b, c, 77); S_R4(c, d, e, a, b, 78); S_R4(b, c, d, e, a, 79);
-
-	// Add the working vars back into State
-	pState[0] += a;
-	pState[1] += b;
-	pState[2] += c;
-	pState[3] += d;
-	pState[4] += e;
-}
-
 void SHA1::Update(const UINT_8* pData, UINT_32 length)
 {
 	UINT_32 j = ((Count[0] >> 3) & 0x3F);
@@ -156,10 +311,14 @@ void SHA1::Update(const UINT_8* pData, UINT_32 length)
 	{
 		i = 64 - j;
 		memcpy(&Buffer[j], pData, i);
-		Transform(State, Buffer);
 
-		for (; (i + 63) < length; i += 64)
-			Transform(State, &pData[i]);
+		const detail::SHA1TransformFunction transform = GetKernelSelection().Transform;
+		transform(State, Buffer, 1);
+
+		//Hand all remaining whole blocks to the kernel at once so SIMD kernels keep the state in registers
+		const UINT_32 blockCount = (length - i) / 64;
+		transform(State, &pData[i], blockCount);
+		i += blockCount * 64;
 
 		j = 0;
 	}
@@ -178,15 +337,14 @@ void SHA1::Finalize()
 	for (i = 0; i < 8; ++i)
 		pbFinalCount[i] = static_cast<UINT_8>((Count[((i >= 4) ? 0 : 1)] >> ((3 - (i & 3)) * 8)) & 0xFF); // Endian independent
 
-	Update((UINT_8*)"\200", 1);
-
-	while ((Count[0] & 504) != 448)
-		Update((UINT_8*)"\0", 1);
+	//Pad with a single 1 bit and zeros up to 56 bytes into the last block
+	static const UINT_8 padding[64] = { 0x80 };
+	const UINT_32 used = (Count[0] >> 3) & 0x3F;
+	Update(padding, used < 56 ? 56 - used : 120 - used);
 
 	Update(pbFinalCount, 8); // Cause a Transform()
 
-	for (i = 0; i < 20; ++i)
-		Digest[i] = static_cast<UINT_8>((State[i >> 2] >> ((3 - (i & 3)) * 8)) & 0xFF);
+	StoreDigest(State, Digest);
 
 	Finalized = true;
 }
@@ -217,4 +375,65 @@ void SHA1::Hash(const UINT_8 * data, UINT_32 length)
 	Finalize();
 }
 
+void SHA1::HashBuffers(const UINT_8* const* data, const UINT_32* lengths, size_t count, SHA1Hash* hashes)
+{
+#if NE_PLATFORM_X86
+	if (GetKernelSelection().MultiBuffer == SHA1Kernel::AVX2MultiBuffer)
+	{
+		HashBuffersAVX2(data, lengths, count, hashes);
+		return;
+	}
+#endif
+
+	SHA1 hasher;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		hasher.Hash(data[i], lengths[i]);
+		hashes[i] = hasher.GetHash();
+	}
+}
+
+bool SHA1::IsKernelSupported(SHA1Kernel kernel)
+{
+	switch (kernel)
+	{
+	case SHA1Kernel::Scalar:
+		return true;
+#if NE_PLATFORM_X86
+	case SHA1Kernel::SHANI:
+		return GetCpuFeatures().bSHA;
+	case SHA1Kernel::AVX2MultiBuffer:
+		return GetCpuFeatures().bAVX2;
+#endif
+	default:
+		return false;
+	}
+}
+
+bool SHA1::SetKernel(SHA1Kernel kernel)
+{
+	if (!IsKernelSupported(kernel))
+		return false;
+
+	GetKernelSelection() = SelectKernel(kernel);
+
+	return true;
+}
+
+void SHA1::ResetKernel()
+{
+	GetKernelSelection() = SelectFastestKernel();
+}
+
+SHA1Kernel SHA1::GetSingleStreamKernel()
+{
+	return GetKernelSelection().SingleStream;
+}
+
+SHA1Kernel SHA1::GetMultiBufferKernel()
+{
+	return GetKernelSelection().MultiBuffer;
+}
+
 };
\ No newline at end of file
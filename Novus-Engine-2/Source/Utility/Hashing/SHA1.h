@@ -13,6 +13,8 @@
 #pragma once
 
 #include <iostream>
+#include <stdint.h>
+#include <stddef.h>
 
  ///////////////////////////////////////////////////////////////////////////
  // Define variable types
@@ -78,6 +80,18 @@ struct SHA1Hash
 	uint8_t Hash[20];
 };
 
+/**
+ *	Block transform implementations, the fastest one the CPU supports is picked automatically
+ */
+enum class SHA1Kernel
+{
+	Scalar,
+	//Intel SHA extensions, single stream
+	SHANI,
+	//8 independent streams in AVX2 registers, only used by HashBuffers
+	AVX2MultiBuffer
+};
+
 class SHA1
 {
 public:
@@ -98,8 +112,28 @@ public:
 	 */
 	void Hash(const UINT_8* data, UINT_32 length);
 
-private:
-	void Transform(UINT_32* pState, const UINT_8* pBuffer);
+	/**
+	 *	Hashes many independent buffers, producing the same hashes as calling Hash on each of them.
+	 *	Uses the multi-buffer kernel when the CPU supports it, which works best on buffers of similar size.
+	 */
+	static void HashBuffers(const UINT_8* const* data, const UINT_32* lengths, size_t count, SHA1Hash* hashes);
+
+	static bool IsKernelSupported(SHA1Kernel kernel);
+
+	/**
+	 *	Overrides the kernel picked from the CPU features, for testing and benchmarks. Not thread safe.
+	 *	Single stream hashing uses the scalar kernel when a multi-buffer kernel is selected.
+	 *	@return false if the CPU does not support the kernel, the current selection is kept
+	 */
+	static bool SetKernel(SHA1Kernel kernel);
+
+	/**
+	 *	Goes back to the fastest kernels the CPU supports
+	 */
+	static void ResetKernel();
+
+	static SHA1Kernel GetSingleStreamKernel();
+	static SHA1Kernel GetMultiBufferKernel();
 
 private:
 	UINT_32 State[5];
@@ -109,9 +143,6 @@ private:
 	UINT_8  Digest[20];
 	UINT_32 reserved1[3];//Padding
 
-	UINT_8  Workspace[64];
-	SHA1_WORKSPACE_BLOCK* Block;
-
 	bool Finalized;
 };
 
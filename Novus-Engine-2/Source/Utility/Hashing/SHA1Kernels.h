@@ -0,0 +1,48 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Utility/Platform/PlatformDefines.h"
+
+/**
+ *	Block transform kernels used by SHA1, selected at runtime based on CpuFeatures.
+ *	Every kernel produces exactly the same result as the scalar one, including reading message words in native byte order.
+ */
+
+namespace novus
+{
+
+namespace detail
+{
+	const size_t SHA1BlockSize = 64;
+	const uint32_t SHA1MultiBufferLanes = 8;
+
+	/**
+	 *	Runs the compression function over blockCount consecutive 64 byte blocks.
+	 */
+	typedef void(*SHA1TransformFunction)(uint32_t* state, const uint8_t* data, size_t blockCount);
+
+	void SHA1TransformScalar(uint32_t* state, const uint8_t* data, size_t blockCount);
+
+#if NE_PLATFORM_X86
+	//Requires CpuFeatures::bSHA
+	void SHA1TransformSHANI(uint32_t* state, const uint8_t* data, size_t blockCount);
+
+	/**
+	 *	Runs one block for each of 8 independent streams. Requires CpuFeatures::bAVX2.
+	 *	@param states 8 states of 5 words each
+	 *	@param blocks One block pointer per lane
+	 *	@param activeMask Lanes with their bit clear are left untouched
+	 */
+	void SHA1TransformAVX2x8(uint32_t states[][5], const uint8_t* const* blocks, uint32_t activeMask);
+#endif
+}
+
+}
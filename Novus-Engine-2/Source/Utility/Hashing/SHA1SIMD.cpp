@@ -0,0 +1,343 @@
+#include "SHA1Kernels.h"
+
+#if NE_PLATFORM_X86
+
+#include <immintrin.h>
+
+namespace novus
+{
+
+namespace detail
+{
+
+namespace
+{
+	/**
+	 *	The scalar transform uses message words in native byte order, so only the word order is reversed to match the lane order of the SHA instructions
+	 */
+	NE_TARGET("sha,sse4.1") inline __m128i LoadMessage(const uint8_t* data)
+	{
+		return _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), 0x1B);
+	}
+}
+
+NE_TARGET("sha,sse4.1") void SHA1TransformSHANI(uint32_t* state, const uint8_t* data, size_t blockCount)
+{
+	__m128i ABCD = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0x1B);
+	__m128i E0 = _mm_set_epi32(static_cast<int>(state[4]), 0, 0, 0);
+	__m128i E1;
+	__m128i MSG0, MSG1, MSG2, MSG3;
+
+	for (; blockCount > 0; blockCount--, data += SHA1BlockSize)
+	{
+		const __m128i ABCDSave = ABCD;
+		const __m128i E0Save = E0;
+
+		//Rounds 0-3
+		MSG0 = LoadMessage(data + 0);
+		E0 = _mm_add_epi32(E0, MSG0);
+		E1 = ABCD;
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E0, 0);
+
+		//Rounds 4-7
+		MSG1 = LoadMessage(data + 16);
+		E1 = _mm_sha1nexte_epu32(E1, MSG1);
+		E0 = ABCD;
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E1, 0);
+		MSG0 = _mm_sha1msg1_epu32(MSG0, MSG1);
+
+		//Rounds 8-11
+		MSG2 = LoadMessage(data + 32);
+		E0 = _mm_sha1nexte_epu32(E0, MSG2);
+		E1 = ABCD;
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E0, 0);
+		MSG1 = _mm_sha1msg1_epu32(MSG1, MSG2);
+		MSG0 = _mm_xor_si128(MSG0, MSG2);
+
+		//Rounds 12-15
+		MSG3 = LoadMessage(data + 48);
+		E1 = _mm_sha1nexte_epu32(E1, MSG3);
+		E0 = ABCD;
+		MSG0 = _mm_sha1msg2_epu32(MSG0, MSG3);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E1, 0);
+		MSG2 = _mm_sha1msg1_epu32(MSG2, MSG3);
+		MSG1 = _mm_xor_si128(MSG1, MSG3);
+
+		//Rounds 16-19
+		E0 = _mm_sha1nexte_epu32(E0, MSG0);
+		E1 = ABCD;
+		MSG1 = _mm_sha1msg2_epu32(MSG1, MSG0);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E0, 0);
+		MSG3 = _mm_sha1msg1_epu32(MSG3, MSG0);
+		MSG2 = _mm_xor_si128(MSG2, MSG0);
+
+		//Rounds 20-23
+		E1 = _mm_sha1nexte_epu32(E1, MSG1);
+		E0 = ABCD;
+		MSG2 = _mm_sha1msg2_epu32(MSG2, MSG1);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E1, 1);
+		MSG0 = _mm_sha1msg1_epu32(MSG0, MSG1);
+		MSG3 = _mm_xor_si128(MSG3, MSG1);
+
+		//Rounds 24-27
+		E0 = _mm_sha1nexte_epu32(E0, MSG2);
+		E1 = ABCD;
+		MSG3 = _mm_sha1msg2_epu32(MSG3, MSG2);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E0, 1);
+		MSG1 = _mm_sha1msg1_epu32(MSG1, MSG2);
+		MSG0 = _mm_xor_si128(MSG0, MSG2);
+
+		//Rounds 28-31
+		E1 = _mm_sha1nexte_epu32(E1, MSG3);
+		E0 = ABCD;
+		MSG0 = _mm_sha1msg2_epu32(MSG0, MSG3);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E1, 1);
+		MSG2 = _mm_sha1msg1_epu32(MSG2, MSG3);
+		MSG1 = _mm_xor_si128(MSG1, MSG3);
+
+		//Rounds 32-35
+		E0 = _mm_sha1nexte_epu32(E0, MSG0);
+		E1 = ABCD;
+		MSG1 = _mm_sha1msg2_epu32(MSG1, MSG0);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E0, 1);
+		MSG3 = _mm_sha1msg1_epu32(MSG3, MSG0);
+		MSG2 = _mm_xor_si128(MSG2, MSG0);
+
+		//Rounds 36-39
+		E1 = _mm_sha1nexte_epu32(E1, MSG1);
+		E0 = ABCD;
+		MSG2 = _mm_sha1msg2_epu32(MSG2, MSG1);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E1, 1);
+		MSG0 = _mm_sha1msg1_epu32(MSG0, MSG1);
+		MSG3 = _mm_xor_si128(MSG3, MSG1);
+
+		//Rounds 40-43
+		E0 = _mm_sha1nexte_epu32(E0, MSG2);
+		E1 = ABCD;
+		MSG3 = _mm_sha1msg2_epu32(MSG3, MSG2);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E0, 2);
+		MSG1 = _mm_sha1msg1_epu32(MSG1, MSG2);
+		MSG0 = _mm_xor_si128(MSG0, MSG2);
+
+		//Rounds 44-47
+		E1 = _mm_sha1nexte_epu32(E1, MSG3);
+		E0 = ABCD;
+		MSG0 = _mm_sha1msg2_epu32(MSG0, MSG3);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E1, 2);
+		MSG2 = _mm_sha1msg1_epu32(MSG2, MSG3);
+		MSG1 = _mm_xor_si128(MSG1, MSG3);
+
+		//Rounds 48-51
+		E0 = _mm_sha1nexte_epu32(E0, MSG0);
+		E1 = ABCD;
+		MSG1 = _mm_sha1msg2_epu32(MSG1, MSG0);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E0, 2);
+		MSG3 = _mm_sha1msg1_epu32(MSG3, MSG0);
+		MSG2 = _mm_xor_si128(MSG2, MSG0);
+
+		//Rounds 52-55
+		E1 = _mm_sha1nexte_epu32(E1, MSG1);
+		E0 = ABCD;
+		MSG2 = _mm_sha1msg2_epu32(MSG2, MSG1);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E1, 2);
+		MSG0 = _mm_sha1msg1_epu32(MSG0, MSG1);
+		MSG3 = _mm_xor_si128(MSG3, MSG1);
+
+		//Rounds 56-59
+		E0 = _mm_sha1nexte_epu32(E0, MSG2);
+		E1 = ABCD;
+		MSG3 = _mm_sha1msg2_epu32(MSG3, MSG2);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E0, 2);
+		MSG1 = _mm_sha1msg1_epu32(MSG1, MSG2);
+		MSG0 = _mm_xor_si128(MSG0, MSG2);
+
+		//Rounds 60-63
+		E1 = _mm_sha1nexte_epu32(E1, MSG3);
+		E0 = ABCD;
+		MSG0 = _mm_sha1msg2_epu32(MSG0, MSG3);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E1, 3);
+		MSG2 = _mm_sha1msg1_epu32(MSG2, MSG3);
+		MSG1 = _mm_xor_si128(MSG1, MSG3);
+
+		//Rounds 64-67
+		E0 = _mm_sha1nexte_epu32(E0, MSG0);
+		E1 = ABCD;
+		MSG1 = _mm_sha1msg2_epu32(MSG1, MSG0);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E0, 3);
+		MSG3 = _mm_sha1msg1_epu32(MSG3, MSG0);
+		MSG2 = _mm_xor_si128(MSG2, MSG0);
+
+		//Rounds 68-71
+		E1 = _mm_sha1nexte_epu32(E1, MSG1);
+		E0 = ABCD;
+		MSG2 = _mm_sha1msg2_epu32(MSG2, MSG1);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E1, 3);
+		MSG3 = _mm_xor_si128(MSG3, MSG1);
+
+		//Rounds 72-75
+		E0 = _mm_sha1nexte_epu32(E0, MSG2);
+		E1 = ABCD;
+		MSG3 = _mm_sha1msg2_epu32(MSG3, MSG2);
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E0, 3);
+
+		//Rounds 76-79
+		E1 = _mm_sha1nexte_epu32(E1, MSG3);
+		E0 = ABCD;
+		ABCD = _mm_sha1rnds4_epu32(ABCD, E1, 3);
+
+		//Add the working vars back into the state
+		E0 = _mm_sha1nexte_epu32(E0, E0Save);
+		ABCD = _mm_add_epi32(ABCD, ABCDSave);
+	}
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_shuffle_epi32(ABCD, 0x1B));
+	state[4] = static_cast<uint32_t>(_mm_extract_epi32(E0, 3));
+}
+
+namespace
+{
+	template <int Bits>
+	NE_TARGET("avx2") inline __m256i Rotl(__m256i value)
+	{
+		return _mm256_or_si256(_mm256_slli_epi32(value, Bits), _mm256_srli_epi32(value, 32 - Bits));
+	}
+
+	/**
+	 *	Transposes 8 rows of 8 words so each output row holds one word from every lane
+	 */
+	NE_TARGET("avx2") inline void Transpose8x8(__m256i rows[8])
+	{
+		const __m256i t0 = _mm256_unpacklo_epi32(rows[0], rows[1]);
+		const __m256i t1 = _mm256_unpackhi_epi32(rows[0], rows[1]);
+		const __m256i t2 = _mm256_unpacklo_epi32(rows[2], rows[3]);
+		const __m256i t3 = _mm256_unpackhi_epi32(rows[2], rows[3]);
+		const __m256i t4 = _mm256_unpacklo_epi32(rows[4], rows[5]);
+		const __m256i t5 = _mm256_unpackhi_epi32(rows[4], rows[5]);
+		const __m256i t6 = _mm256_unpacklo_epi32(rows[6], rows[7]);
+		const __m256i t7 = _mm256_unpackhi_epi32(rows[6], rows[7]);
+
+		const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+		const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+		const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+		const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+		const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+		const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+		const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+		const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+		rows[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+		rows[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+		rows[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+		rows[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+		rows[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+		rows[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+		rows[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+		rows[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+	}
+
+	//Loads words [offset, offset + 8) of every lane's block transposed into W[offset, offset + 8)
+	NE_TARGET("avx2") inline void LoadTransposed(__m256i* W, const uint8_t* const* blocks, size_t offset)
+	{
+		for (uint32_t lane = 0; lane < SHA1MultiBufferLanes; lane++)
+		{
+			W[offset + lane] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[lane] + offset * 4));
+		}
+
+		Transpose8x8(W + offset);
+	}
+}
+
+namespace
+{
+	/**
+	 *	20 rounds of one stage for all 8 lanes
+	 */
+	template <int Stage>
+	NE_TARGET("avx2") inline void SHA1RoundsAVX2(__m256i* W, __m256i& a, __m256i& b, __m256i& c, __m256i& d, __m256i& e)
+	{
+		static const int RoundConstants[4] = { 0x5A827999, 0x6ED9EBA1, static_cast<int>(0x8F1BBCDC), static_cast<int>(0xCA62C1D6) };
+		const __m256i k = _mm256_set1_epi32(RoundConstants[Stage]);
+
+		for (int i = Stage * 20; i < Stage * 20 + 20; i++)
+		{
+			if (i >= 16)
+			{
+				W[i & 15] = Rotl<1>(_mm256_xor_si256(_mm256_xor_si256(W[(i + 13) & 15], W[(i + 8) & 15]), _mm256_xor_si256(W[(i + 2) & 15], W[i & 15])));
+			}
+
+			__m256i f;
+
+			if (Stage == 0)
+				f = _mm256_xor_si256(_mm256_and_si256(b, _mm256_xor_si256(c, d)), d);
+			else if (Stage == 2)
+				f = _mm256_or_si256(_mm256_and_si256(_mm256_or_si256(b, c), d), _mm256_and_si256(b, c));
+			else
+				f = _mm256_xor_si256(_mm256_xor_si256(b, c), d);
+
+			const __m256i temp = _mm256_add_epi32(_mm256_add_epi32(Rotl<5>(a), f), _mm256_add_epi32(_mm256_add_epi32(e, k), W[i & 15]));
+
+			e = d;
+			d = c;
+			c = Rotl<30>(b);
+			b = a;
+			a = temp;
+		}
+	}
+}
+
+NE_TARGET("avx2") void SHA1TransformAVX2x8(uint32_t states[][5], const uint8_t* const* blocks, uint32_t activeMask)
+{
+	__m256i W[16];
+	LoadTransposed(W, blocks, 0);
+	LoadTransposed(W, blocks, 8);
+
+	const __m256i laneIndices = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+	const __m256i laneBits = _mm256_sllv_epi32(_mm256_set1_epi32(1), laneIndices);
+	const __m256i active = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(activeMask)), laneBits), laneBits);
+
+	const __m256i stateIndices = _mm256_mullo_epi32(laneIndices, _mm256_set1_epi32(5));
+	const int* stateBase = reinterpret_cast<const int*>(&states[0][0]);
+
+	__m256i initial[5];
+	for (int i = 0; i < 5; i++)
+	{
+		initial[i] = _mm256_i32gather_epi32(stateBase + i, stateIndices, 4);
+	}
+
+	__m256i a = initial[0], b = initial[1], c = initial[2], d = initial[3], e = initial[4];
+
+	SHA1RoundsAVX2<0>(W, a, b, c, d, e);
+	SHA1RoundsAVX2<1>(W, a, b, c, d, e);
+	SHA1RoundsAVX2<2>(W, a, b, c, d, e);
+	SHA1RoundsAVX2<3>(W, a, b, c, d, e);
+
+	__m256i result[8];
+	result[0] = _mm256_blendv_epi8(initial[0], _mm256_add_epi32(initial[0], a), active);
+	result[1] = _mm256_blendv_epi8(initial[1], _mm256_add_epi32(initial[1], b), active);
+	result[2] = _mm256_blendv_epi8(initial[2], _mm256_add_epi32(initial[2], c), active);
+	result[3] = _mm256_blendv_epi8(initial[3], _mm256_add_epi32(initial[3], d), active);
+	result[4] = _mm256_blendv_epi8(initial[4], _mm256_add_epi32(initial[4], e), active);
+	result[5] = _mm256_setzero_si256();
+	result[6] = _mm256_setzero_si256();
+	result[7] = _mm256_setzero_si256();
+
+	//Row i of the transposed result holds the 5 state words of lane i
+	Transpose8x8(result);
+
+	for (uint32_t lane = 0; lane < SHA1MultiBufferLanes; lane++)
+	{
+		alignas(32) uint32_t words[8];
+		_mm256_store_si256(reinterpret_cast<__m256i*>(words), result[lane]);
+
+		for (int i = 0; i < 5; i++)
+		{
+			states[lane][i] = words[i];
+		}
+	}
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,142 @@
+#include "StringId.h"
+#include <cassert>
+#include <cstdio>
+
+#if NE_STRING_ID_NAMES
+#include <mutex>
+#include <unordered_map>
+#endif
+
+namespace novus
+{
+
+namespace detail
+{
+	uint64_t HashStringIdRuntime(const char* str, size_t length)
+	{
+		uint64_t hash = StringIdOffsetBasis;
+
+		for (size_t i = 0; i < length; i++)
+		{
+			hash = HashStringIdChar(hash, static_cast<unsigned char>(str[i]));
+		}
+
+		return hash;
+	}
+
+	uint64_t HashStringIdRuntime(const wchar_t* str, size_t length)
+	{
+		uint64_t hash = StringIdOffsetBasis;
+
+		for (size_t i = 0; i < length; i++)
+		{
+			hash = HashStringIdChar(hash, static_cast<uint32_t>(str[i]));
+		}
+
+		return hash;
+	}
+}
+
+#if NE_STRING_ID_NAMES
+namespace
+{
+	//Narrows a wide name for debug output, non ASCII characters are replaced
+	std::string NarrowName(const wchar_t* str, size_t length)
+	{
+		std::string result(length, '?');
+
+		for (size_t i = 0; i < length; i++)
+		{
+			if (static_cast<uint32_t>(str[i]) < 0x80)
+				result[i] = static_cast<char>(str[i]);
+		}
+
+		return result;
+	}
+
+	class StringIdNames
+	{
+	public:
+		static StringIdNames& Get()
+		{
+			static StringIdNames names;
+			return names;
+		}
+
+		void Add(uint64_t id, const std::string& name)
+		{
+			std::lock_guard<std::mutex> lock(Lock);
+
+			auto it = Names.find(id);
+
+			if (it == Names.end())
+				Names.emplace(id, name);
+			else
+				assert(it->second == name && "Two different strings hashed to the same StringId");
+		}
+
+		bool Find(uint64_t id, std::string& name)
+		{
+			std::lock_guard<std::mutex> lock(Lock);
+
+			auto it = Names.find(id);
+
+			if (it == Names.end())
+				return false;
+
+			name = it->second;
+
+			return true;
+		}
+
+	private:
+		std::mutex Lock;
+		std::unordered_map<uint64_t, std::string> Names;
+	};
+}
+#endif
+
+StringId StringId::FromString(const char* str, size_t length)
+{
+	StringId id(detail::HashStringIdRuntime(str, length));
+
+#if NE_STRING_ID_NAMES
+	StringIdNames::Get().Add(id.Value, std::string(str, length));
+#endif
+
+	return id;
+}
+
+StringId StringId::FromString(const wchar_t* str, size_t length)
+{
+	StringId id(detail::HashStringIdRuntime(str, length));
+
+#if NE_STRING_ID_NAMES
+	StringIdNames::Get().Add(id.Value, NarrowName(str, length));
+#endif
+
+	return id;
+}
+
+std::string StringId::GetDebugName() const
+{
+#if NE_STRING_ID_NAMES
+	if (DebugName != nullptr)
+		return DebugName;
+
+	if (DebugWideName != nullptr)
+		return NarrowName(DebugWideName, std::char_traits<wchar_t>::length(DebugWideName));
+
+	std::string name;
+
+	if (StringIdNames::Get().Find(Value, name))
+		return name;
+#endif
+
+	char buffer[20];
+	snprintf(buffer, sizeof(buffer), "#%016llx", static_cast<unsigned long long>(Value));
+
+	return buffer;
+}
+
+}
@@ -0,0 +1,172 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <functional>
+
+/**
+ *	Keeps the names of string ids around so they can be turned back into strings for debugging.
+ *	On by default in debug builds, ids are plain integers otherwise.
+ */
+#ifndef NE_STRING_ID_NAMES
+#ifdef _DEBUG
+#define NE_STRING_ID_NAMES 1
+#else
+#define NE_STRING_ID_NAMES 0
+#endif
+#endif
+
+namespace novus
+{
+
+namespace detail
+{
+	const uint64_t StringIdOffsetBasis = 0xcbf29ce484222325ull;
+	const uint64_t StringIdPrime = 0x100000001b3ull;
+
+	constexpr uint64_t HashStringIdByte(uint64_t hash, uint32_t byte)
+	{
+		return (hash ^ (byte & 0xFF)) * StringIdPrime;
+	}
+
+	/**
+	 *	ASCII characters hash as a single byte so narrow and wide spellings of a name get the same id,
+	 *	anything else hashes all four bytes of the code unit.
+	 */
+	constexpr uint64_t HashStringIdChar(uint64_t hash, uint32_t c)
+	{
+		return c < 0x80 ? HashStringIdByte(hash, c) :
+			HashStringIdByte(HashStringIdByte(HashStringIdByte(HashStringIdByte(hash, c), c >> 8), c >> 16), c >> 24);
+	}
+
+	//FNV-1a, recursive since constexpr functions can only contain a return statement in C++11
+	constexpr uint64_t HashStringId(const char* str, size_t length, uint64_t hash = StringIdOffsetBasis)
+	{
+		return length == 0 ? hash : HashStringId(str + 1, length - 1, HashStringIdChar(hash, static_cast<unsigned char>(*str)));
+	}
+
+	constexpr uint64_t HashStringId(const wchar_t* str, size_t length, uint64_t hash = StringIdOffsetBasis)
+	{
+		return length == 0 ? hash : HashStringId(str + 1, length - 1, HashStringIdChar(hash, static_cast<uint32_t>(*str)));
+	}
+
+	//Same hashes as above for strings only known at runtime, without the recursion
+	uint64_t HashStringIdRuntime(const char* str, size_t length);
+	uint64_t HashStringIdRuntime(const wchar_t* str, size_t length);
+}
+
+/**
+ *	A string reduced to a 64 bit hash, used for tags, names and other ids that are compared and looked up far more often than printed.
+ *
+ *	Usage: constexpr StringId RenderingTag = "Rendering"_id; //Hashed at compile time
+ *		   StringId tag = StringId::FromString(name); //Hashed at runtime
+ *		   if (tag == RenderingTag) ...
+ *
+ *	Narrow and wide strings with the same ASCII characters have the same id.
+ *	With NE_STRING_ID_NAMES enabled literals remember their string and runtime strings are added to a global table
+ *	so GetDebugName can return the original string.
+ */
+class StringId
+{
+public:
+	constexpr StringId()
+		:Value(0)
+#if NE_STRING_ID_NAMES
+		, DebugName(nullptr),
+		DebugWideName(nullptr)
+#endif
+	{}
+
+	constexpr explicit StringId(uint64_t value)
+		:Value(value)
+#if NE_STRING_ID_NAMES
+		, DebugName(nullptr),
+		DebugWideName(nullptr)
+#endif
+	{}
+
+	/**
+	 *	Hashes a string literal, the literal has to outlive the id in debug builds since only the pointer is kept
+	 */
+	constexpr StringId(const char* literal, size_t length)
+		:Value(detail::HashStringId(literal, length))
+#if NE_STRING_ID_NAMES
+		, DebugName(literal),
+		DebugWideName(nullptr)
+#endif
+	{}
+
+	constexpr StringId(const wchar_t* literal, size_t length)
+		:Value(detail::HashStringId(literal, length))
+#if NE_STRING_ID_NAMES
+		, DebugName(nullptr),
+		DebugWideName(literal)
+#endif
+	{}
+
+	/**
+	 *	Hashes a string at runtime, the string can be temporary
+	 */
+	static StringId FromString(const char* str, size_t length);
+	static StringId FromString(const wchar_t* str, size_t length);
+	static StringId FromString(const std::string& str) { return FromString(str.data(), str.size()); }
+	static StringId FromString(const std::wstring& str) { return FromString(str.data(), str.size()); }
+
+	constexpr uint64_t GetValue() const { return Value; }
+	constexpr bool IsValid() const { return Value != 0; }
+
+	/**
+	 *	Gets the string the id was created from, or the id in hex if it isn't known or NE_STRING_ID_NAMES is disabled
+	 */
+	std::string GetDebugName() const;
+
+	constexpr bool operator== (const StringId& o) const { return Value == o.Value; }
+	constexpr bool operator!= (const StringId& o) const { return Value != o.Value; }
+	constexpr bool operator< (const StringId& o) const { return Value < o.Value; }
+
+private:
+	uint64_t Value;
+
+#if NE_STRING_ID_NAMES
+	const char* DebugName;
+	const wchar_t* DebugWideName;
+#endif
+};
+
+constexpr StringId operator"" _id(const char* literal, size_t length)
+{
+	return StringId(literal, length);
+}
+
+constexpr StringId operator"" _id(const wchar_t* literal, size_t length)
+{
+	return StringId(literal, length);
+}
+
+//FromString can't run at compile time, so literals are pinned to the FNV-1a value it computes, the benchmark's --verify checks it at runtime
+static_assert("Rendering"_id.GetValue() == 0x16c7c91074561213ull, "StringId literals must hash like StringId::FromString");
+static_assert("Rendering"_id == L"Rendering"_id, "Narrow and wide literals with the same ASCII characters must have the same id");
+static_assert(""_id.GetValue() == detail::StringIdOffsetBasis, "The empty string hashes to the FNV-1a offset basis");
+
+}
+
+namespace std
+{
+	template <>
+	struct hash<novus::StringId>
+	{
+		size_t operator()(const novus::StringId& id) const
+		{
+			//Already a well mixed hash
+			return static_cast<size_t>(id.GetValue());
+		}
+	};
+}
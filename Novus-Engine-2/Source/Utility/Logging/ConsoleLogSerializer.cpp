@@ -3,5 +3,5 @@
 
 void novus::ConsoleLogSerializer::Serialize(const novus::Logger::LogEntry& entry)
 {
-	std::wcout << L"[" << entry.Tag.c_str() << L"] " << entry.Message.c_str() << std::endl;
+	std::wcout << L"[" << novus::Logger::GetInstance()->GetTagName(entry.Tag).c_str() << L"] " << entry.Message.c_str() << std::endl;
 }
\ No newline at end of file
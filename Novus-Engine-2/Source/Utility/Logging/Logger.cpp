@@ -2,10 +2,14 @@
 #include "ILogSerializer.h"
 #include <algorithm>
 #include "ConsoleLogSerializer.h"
+#include "Utility/Profiling/Counters.h"
+#include <cassert>
 
 namespace novus
 {
 
+NE_DEFINE_COUNTER(LogLinesCounter, "Log/Lines");
+
 Logger* Logger::StaticInstance = nullptr;
 
 Logger* Logger::GetInstance()
@@ -30,8 +34,10 @@ Logger::~Logger()
 	delete ConsoleSerializer;
 }
 
-void Logger::Log(const wchar_t * message, const wchar_t * tag, LogLevel logLevel, const char * FileName, int lineNumber)
+void Logger::Log(const wchar_t * message, StringId tag, LogLevel logLevel, const char * FileName, int lineNumber)
 {
+	NE_COUNTER_INCREMENT(LogLinesCounter);
+
 	LogEntry entry;
 	entry.Message = message;
 	entry.Tag = tag;
@@ -44,6 +50,26 @@ void Logger::Log(const wchar_t * message, const wchar_t * tag, LogLevel logLevel
 	DispatchLogEvent(entry);
 }
 
+void Logger::RegisterTag(StringId tag, const wchar_t* name)
+{
+	const size_t nameLength = std::char_traits<wchar_t>::length(name);
+	assert(tag.GetValue() == detail::HashStringIdRuntime(name, nameLength) && "Tag registered with a different name than it was hashed from");
+
+	TagNames.emplace(tag, std::wstring(name, nameLength));
+}
+
+std::wstring Logger::GetTagName(StringId tag) const
+{
+	auto it = TagNames.find(tag);
+
+	if (it != TagNames.end())
+		return it->second;
+
+	const std::string debugName = tag.GetDebugName();
+
+	return std::wstring(debugName.begin(), debugName.end());
+}
+
 void Logger::AddSerializer(ILogSerializer * serializer)
 {
 	LogSerializers.push_back(serializer);
@@ -8,7 +8,16 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <vector>
+#include <unordered_map>
+#include "Utility/Hashing/StringId.h"
+
+/**
+ *	Tags are StringIds built from literals, e.g. NE_MESSAGE(L"Loaded", "Rendering"_id), so logging never hashes or looks up the tag.
+ *	NE_REGISTER_LOG_TAG(Rendering) at namespace scope stores the tag's name once so serializers can print it in any build.
+ */
+#define NE_REGISTER_LOG_TAG(tag) static const novus::LogTagRegistrar NE_LogTagRegistrar_##tag(novus::StringId(#tag, sizeof(#tag) - 1), L"" #tag)
 
 #define NE_LOG(message, tag, logLevel) (novus::Logger::GetInstance()->Log(message, tag, logLevel, __FILE__, __LINE__))
 #define NE_MESSAGE(message, tag) (novus::Logger::GetInstance()->Log(message, tag, novus::LogLevel::Message, __FILE__, __LINE__))
@@ -35,7 +44,8 @@ public:
 	struct LogEntry
 	{
 		std::wstring Message;
-		std::wstring Tag;
+		//Look up the tag's string with GetTagName
+		StringId Tag;
 		LogLevel LogLevel;
 		std::string FileName;
 		int LineNumber;
@@ -44,7 +54,17 @@ public:
 public:
 	static Logger* GetInstance();
 
-	void Log(const wchar_t* message, const wchar_t* tag, LogLevel logLevel, const char* fileName, int lineNumber);
+	void Log(const wchar_t* message, StringId tag, LogLevel logLevel, const char* fileName, int lineNumber);
+
+	/**
+	 *	Stores the name printed for a tag, use NE_REGISTER_LOG_TAG instead of calling this directly.
+	 */
+	void RegisterTag(StringId tag, const wchar_t* name);
+
+	/**
+	 *	Gets the registered name of a tag, or its StringId debug name if it was never registered
+	 */
+	std::wstring GetTagName(StringId tag) const;
 
 	void AddSerializer(ILogSerializer* serializer);
 	void RemoveSerializer(ILogSerializer* serializer);
@@ -63,8 +83,19 @@ private:
 
 	ILogSerializer* ConsoleSerializer;
 
+	//Filled by NE_REGISTER_LOG_TAG during static initialization, entries only keep the id
+	std::unordered_map<StringId, std::wstring> TagNames;
+
 	std::vector<LogEntry> LogHistory;
 	std::vector<ILogSerializer*> LogSerializers;
 };
 
+struct LogTagRegistrar
+{
+	LogTagRegistrar(StringId tag, const wchar_t* name)
+	{
+		Logger::GetInstance()->RegisterTag(tag, name);
+	}
+};
+
 };
\ No newline at end of file
@@ -6,6 +6,8 @@
 namespace novus
 {
 
+NE_REGISTER_LOG_TAG(MallocTracker);
+
 MallocTracker* MallocTracker::StaticInstance = nullptr;
 
 MallocTracker* MallocTracker::GetInstance()
@@ -19,7 +21,8 @@ MallocTracker* MallocTracker::GetInstance()
 }
 
 MallocTracker::MallocTracker()
-	:TotalMemory(0)
+	:AllocLock("MallocTracker::AllocLock"),
+	TotalMemory(0)
 {
 }
 
@@ -31,7 +34,7 @@ void MallocTracker::Alloc(void * p, size_t Size, const char * FileName, const ch
 	memAlloc.FunctionName = FunctionName;
 	memAlloc.LineNum = LineNum;
 
-	std::lock_guard<std::mutex> lock(AllocLock);
+	std::lock_guard<ProfiledMutex> lock(AllocLock);
 
 	Allocations.insert(std::pair<void*, MemAllocation>(p, memAlloc));
 
@@ -40,7 +43,7 @@ void MallocTracker::Alloc(void * p, size_t Size, const char * FileName, const ch
 
 bool MallocTracker::Free(void * p, const char * FileName, const char * FunctionName, int LineNum)
 {
-	std::lock_guard<std::mutex> lock(AllocLock);
+	std::lock_guard<ProfiledMutex> lock(AllocLock);
 
 	auto it = Allocations.find(p);
 
@@ -57,7 +60,7 @@ bool MallocTracker::Free(void * p, const char * FileName, const char * FunctionN
 		wchar_t error[256];
 		swprintf_s(error, 256, L"%s(%i): Could not find matching allocation %z.\n", FileName, LineNum, p);
 
-		NE_WARN(error, L"MallocTracker");
+		NE_WARN(error, "MallocTracker"_id);
 		OutputDebugString(error);
 	}
 
@@ -66,7 +69,7 @@ bool MallocTracker::Free(void * p, const char * FileName, const char * FunctionN
 
 void MallocTracker::DumpTrackedMemory()
 {
-	std::lock_guard<std::mutex> lock(AllocLock);
+	std::lock_guard<ProfiledMutex> lock(AllocLock);
 
 	wchar_t sizeStr[32] = { 0 };
 
@@ -9,7 +9,7 @@
 
 #include <string>
 #include <map>
-#include <mutex>
+#include "Utility/Threading/ProfiledMutex.h"
 
 namespace novus
 {
@@ -69,7 +69,7 @@ private:
 private:
 	static MallocTracker* StaticInstance;
 
-	std::mutex AllocLock;
+	ProfiledMutex AllocLock;
 
 	std::map<void*, MemAllocation> Allocations;
 
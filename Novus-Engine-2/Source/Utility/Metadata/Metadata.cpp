@@ -0,0 +1,57 @@
+#include "Metadata.h"
+#include <cstring>
+
+namespace novus
+{
+
+const FieldMetadata* TypeInfo::FindField(const char* name) const
+{
+	for (const FieldMetadata& field : *this)
+	{
+		if (strcmp(field.Name, name) == 0)
+			return &field;
+	}
+
+	return Parent != nullptr ? Parent->FindField(name) : nullptr;
+}
+
+void ScatterFields(const TypeInfo& type, const void* source, size_t count, void* const* destinations)
+{
+	const uint8_t* sourceBytes = static_cast<const uint8_t*>(source);
+
+	//Field by field so each destination is written sequentially
+	for (size_t f = 0; f < type.FieldCount; f++)
+	{
+		if (destinations[f] == nullptr)
+			continue;
+
+		const FieldMetadata& field = type.Fields[f];
+		uint8_t* destination = static_cast<uint8_t*>(destinations[f]);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			memcpy(destination + i * field.Size, sourceBytes + i * type.Size + field.Offset, field.Size);
+		}
+	}
+}
+
+void GatherFields(const TypeInfo& type, const void* const* sources, size_t count, void* destination)
+{
+	uint8_t* destinationBytes = static_cast<uint8_t*>(destination);
+
+	for (size_t f = 0; f < type.FieldCount; f++)
+	{
+		if (sources[f] == nullptr)
+			continue;
+
+		const FieldMetadata& field = type.Fields[f];
+		const uint8_t* source = static_cast<const uint8_t*>(sources[f]);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			memcpy(destinationBytes + i * type.Size + field.Offset, source + i * field.Size, field.Size);
+		}
+	}
+}
+
+}
@@ -7,36 +7,274 @@
 
 #pragma once
 
-#include "Utility/Delegates/Delegate.h"
-#include <array>
+#include <stdint.h>
+#include <stddef.h>
+#include <type_traits>
+
+/**
+ *	Compile time reflection for plain engine structs.
+ *
+ *	A type's fields are described by constexpr arrays built from a macro, so code iterating over them needs no runtime type information
+ *	and layout checks can run in static_asserts.
+ *
+ *	Usage, at global namespace scope after the type is defined:
+ *		NE_REFLECT_BEGIN(novus::CBPerInstance)
+ *			NE_REFLECT_FIELD(Position)
+ *			NE_REFLECT_FIELD(Scale)
+ *		NE_REFLECT_END(novus::CBPerInstance)
+ *
+ *		static_assert(novus::IsConstantBufferLayoutValid<novus::CBPerInstance>(), "CBPerInstance doesn't match HLSL packing");
+ *
+ *		for (const FieldMetadata& field : GetTypeInfo<CBPerInstance>()) ...
+ *
+ *	Offsets are taken with offsetof so they stay usable in constant expressions, which requires reflected types to be standard layout.
+ *	NE_REFLECT_END checks this. Reflected fields must be public.
+ *
+ *	Types derived from a reflected type use NE_REFLECT_BEGIN_DERIVED and only list their own fields.
+ *	Standard layout only allows fields in one class of a hierarchy, so either the derived type adds no fields
+ *	(e.g. helper functions around a constant buffer) or its reflected parent has none. Parents then start at offset 0.
+ */
 
 namespace novus
 {
 
-//class TypeMetadata;
-//
-//template <typename T, typename return_type, typename ... params>
-//class FunctionMetadata
-//{
-//public:
-//	
-//
-//private:
-//	const std::array<const TypeMetadata*, sizeof...(params)> paramMetadata;
-//};
-//
-//template<typename ... ParentTs>
-//class TypeMetadata
-//{
-//public:
-//	const char* GetName() const { return typeName; }
-//	size_t GetSize() const { return typeSize; }
-//
-//private:
-//	const char* typeName;
-//	size_t typeSize;
-//
-//	const std::array<const TypeMetaData<ParentTs>*, sizeof...(ParentTs)> parentTypes;
-//};
-
-};
\ No newline at end of file
+template <typename T> struct Vector2_t;
+template <typename T> struct Vector3_t;
+template <typename T> struct Vector4_t;
+template <typename T> struct Matrix3x3_t;
+template <typename T> struct Matrix4x4_t;
+template <typename T> struct Matrix3x4_t;
+template <typename T> struct Quaternion_t;
+
+enum class FieldType : uint8_t
+{
+	Unknown,
+	Bool,
+	Int8,
+	UInt8,
+	Int16,
+	UInt16,
+	Int32,
+	UInt32,
+	Int64,
+	UInt64,
+	Float,
+	Double,
+	Vector2,
+	Vector3,
+	Vector4,
+	Matrix3,
+	Matrix4,
+	Matrix3x4,
+	Quaternion,
+	//A reflected type, see FieldMetadata::Type
+	Struct
+};
+
+struct TypeInfo;
+
+struct FieldMetadata
+{
+	const char* Name;
+	//Offset from the start of the containing type in bytes
+	size_t Offset;
+	size_t Size;
+
+	//For arrays these describe a single element
+	FieldType Kind;
+	size_t ElementSize;
+	size_t ElementCount;
+
+	//Set when the field (or array element) is itself a reflected type
+	const TypeInfo* Type;
+};
+
+struct TypeInfo
+{
+	const char* Name;
+	size_t Size;
+	size_t Alignment;
+
+	const FieldMetadata* Fields;
+	size_t FieldCount;
+
+	//nullptr if the type wasn't reflected with NE_REFLECT_BEGIN_DERIVED
+	const TypeInfo* Parent;
+
+	constexpr const FieldMetadata* begin() const { return Fields; }
+	constexpr const FieldMetadata* end() const { return Fields + FieldCount; }
+
+	/**
+	 *	Finds a field of this type or one of its parents by name
+	 *	@returns nullptr if there is no field with the name
+	 */
+	const FieldMetadata* FindField(const char* name) const;
+};
+
+/**
+ *	Specialized by NE_REFLECT_BEGIN, the second parameter only exists so the specialization is a template
+ *	and its static members can be defined in a header.
+ */
+template <typename T, typename Enable = void>
+struct TypeReflection
+{
+	static const bool bReflected = false;
+};
+
+template <typename T>
+struct IsReflected : std::integral_constant<bool, TypeReflection<T>::bReflected> {};
+
+template <typename T>
+constexpr const TypeInfo& GetTypeInfo()
+{
+	static_assert(IsReflected<T>::value, "Type was not reflected with NE_REFLECT_BEGIN");
+
+	return TypeReflection<T>::Info;
+}
+
+namespace detail
+{
+	template <typename T, typename Enable = void> struct FieldKindOf { static const FieldType Value = FieldType::Unknown; };
+
+	template <> struct FieldKindOf<bool> { static const FieldType Value = FieldType::Bool; };
+	template <> struct FieldKindOf<int8_t> { static const FieldType Value = FieldType::Int8; };
+	template <> struct FieldKindOf<uint8_t> { static const FieldType Value = FieldType::UInt8; };
+	template <> struct FieldKindOf<int16_t> { static const FieldType Value = FieldType::Int16; };
+	template <> struct FieldKindOf<uint16_t> { static const FieldType Value = FieldType::UInt16; };
+	template <> struct FieldKindOf<int32_t> { static const FieldType Value = FieldType::Int32; };
+	template <> struct FieldKindOf<uint32_t> { static const FieldType Value = FieldType::UInt32; };
+	template <> struct FieldKindOf<int64_t> { static const FieldType Value = FieldType::Int64; };
+	template <> struct FieldKindOf<uint64_t> { static const FieldType Value = FieldType::UInt64; };
+	template <> struct FieldKindOf<float> { static const FieldType Value = FieldType::Float; };
+	template <> struct FieldKindOf<double> { static const FieldType Value = FieldType::Double; };
+	template <> struct FieldKindOf<Vector2_t<float>> { static const FieldType Value = FieldType::Vector2; };
+	template <> struct FieldKindOf<Vector3_t<float>> { static const FieldType Value = FieldType::Vector3; };
+	template <> struct FieldKindOf<Vector4_t<float>> { static const FieldType Value = FieldType::Vector4; };
+	template <> struct FieldKindOf<Matrix3x3_t<float>> { static const FieldType Value = FieldType::Matrix3; };
+	template <> struct FieldKindOf<Matrix4x4_t<float>> { static const FieldType Value = FieldType::Matrix4; };
+	template <> struct FieldKindOf<Matrix3x4_t<float>> { static const FieldType Value = FieldType::Matrix3x4; };
+	template <> struct FieldKindOf<Quaternion_t<float>> { static const FieldType Value = FieldType::Quaternion; };
+
+	//Enums are described by their underlying integer
+	template <typename T>
+	struct FieldKindOf<T, typename std::enable_if<std::is_enum<T>::value>::type>
+	{
+		static const FieldType Value = FieldKindOf<typename std::underlying_type<T>::type>::Value;
+	};
+
+	template <typename T, bool bReflected = IsReflected<T>::value>
+	struct FieldTypeInfo
+	{
+		static constexpr const TypeInfo* Get() { return nullptr; }
+	};
+
+	template <typename T>
+	struct FieldTypeInfo<T, true>
+	{
+		static constexpr const TypeInfo* Get() { return &TypeReflection<T>::Info; }
+	};
+
+	template <typename TField>
+	constexpr FieldMetadata MakeField(const char* name, size_t offset)
+	{
+		typedef typename std::remove_all_extents<TField>::type ElementType;
+
+		return FieldMetadata{
+			name,
+			offset,
+			sizeof(TField),
+			IsReflected<ElementType>::value ? FieldType::Struct : FieldKindOf<ElementType>::Value,
+			sizeof(ElementType),
+			sizeof(TField) / sizeof(ElementType),
+			FieldTypeInfo<ElementType>::Get()
+		};
+	}
+
+	//Size of one matrix row, rows are packed into separate registers in constant buffers
+	constexpr size_t GetRowSize(FieldType kind)
+	{
+		return kind == FieldType::Matrix3 ? 3 * sizeof(float) :
+			kind == FieldType::Matrix4 || kind == FieldType::Matrix3x4 ? 4 * sizeof(float) : 0;
+	}
+
+	constexpr bool AreFieldsConstantBufferCompatible(const FieldMetadata* fields, size_t count, size_t baseOffset);
+
+	constexpr bool IsTypeConstantBufferCompatible(const TypeInfo* type, size_t baseOffset)
+	{
+		return (type->Parent == nullptr || IsTypeConstantBufferCompatible(type->Parent, baseOffset)) &&
+			AreFieldsConstantBufferCompatible(type->Fields, type->FieldCount, baseOffset);
+	}
+
+	/**
+	 *	HLSL packs constant buffers into 16 byte registers. A value can't straddle two registers,
+	 *	while structs, arrays elements and matrix rows each start a new register.
+	 */
+	constexpr bool IsFieldConstantBufferCompatible(const FieldMetadata& field, size_t offset)
+	{
+		return field.Kind == FieldType::Struct ?
+				offset % 16 == 0 && (field.ElementCount == 1 || field.ElementSize % 16 == 0) && IsTypeConstantBufferCompatible(field.Type, offset) :
+			GetRowSize(field.Kind) != 0 ?
+				offset % 16 == 0 && GetRowSize(field.Kind) % 16 == 0 :
+			field.ElementCount > 1 ?
+				offset % 16 == 0 && field.ElementSize % 16 == 0 :
+			field.Size > 0 && offset / 16 == (offset + field.Size - 1) / 16;
+	}
+
+	constexpr bool AreFieldsConstantBufferCompatible(const FieldMetadata* fields, size_t count, size_t baseOffset)
+	{
+		return count == 0 || (IsFieldConstantBufferCompatible(fields[0], baseOffset + fields[0].Offset) &&
+			AreFieldsConstantBufferCompatible(fields + 1, count - 1, baseOffset));
+	}
+}
+
+/**
+ *	Checks that a reflected type has the same layout as the equivalent HLSL constant buffer, use in a static_assert.
+ *	Only catches fields being placed differently, not fields with different types.
+ */
+template <typename T>
+constexpr bool IsConstantBufferLayoutValid()
+{
+	return detail::IsTypeConstantBufferCompatible(&GetTypeInfo<T>(), 0);
+}
+
+/**
+ *	Copies each field of an array of structs into its own tightly packed array.
+ *	@param destinations One array per field of the type, in field order. Fields with a nullptr array are skipped.
+ */
+void ScatterFields(const TypeInfo& type, const void* source, size_t count, void* const* destinations);
+
+/**
+ *	Inverse of ScatterFields, fields with a nullptr array are left untouched
+ */
+void GatherFields(const TypeInfo& type, const void* const* sources, size_t count, void* destination);
+
+}
+
+#define NE_REFLECT_BEGIN_IMPL(type, parentInfo) \
+	namespace novus { \
+	template <typename Enable> \
+	struct TypeReflection<type, Enable> \
+	{ \
+		typedef type ReflectedType; \
+		static const bool bReflected = true; \
+		static constexpr const TypeInfo* ParentInfo = parentInfo; \
+		static constexpr FieldMetadata Fields[] = {
+
+#define NE_REFLECT_BEGIN(type) NE_REFLECT_BEGIN_IMPL(type, nullptr)
+
+#define NE_REFLECT_BEGIN_DERIVED(type, parent) NE_REFLECT_BEGIN_IMPL(type, &::novus::GetTypeInfo<parent>())
+
+#define NE_REFLECT_FIELD(name) \
+			::novus::detail::MakeField<decltype(ReflectedType::name)>(#name, offsetof(ReflectedType, name)),
+
+#define NE_REFLECT_END(type) \
+			/* Terminator so a type without fields of its own still has a valid array, not counted in FieldCount */ \
+			::novus::FieldMetadata{ nullptr, 0, 0, ::novus::FieldType::Unknown, 0, 0, nullptr } \
+		}; \
+		static_assert(std::is_standard_layout<type>::value, #type " isn't standard layout so offsetof can't be used on it, see Metadata.h"); \
+		static constexpr TypeInfo Info = { #type, sizeof(type), alignof(type), Fields, sizeof(Fields) / sizeof(FieldMetadata) - 1, ParentInfo }; \
+	}; \
+	template <typename Enable> constexpr const TypeInfo* TypeReflection<type, Enable>::ParentInfo; \
+	template <typename Enable> constexpr FieldMetadata TypeReflection<type, Enable>::Fields[]; \
+	template <typename Enable> constexpr TypeInfo TypeReflection<type, Enable>::Info; \
+	}
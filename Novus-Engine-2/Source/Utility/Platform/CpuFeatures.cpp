@@ -0,0 +1,92 @@
+#include "CpuFeatures.h"
+
+#if NE_PLATFORM_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace novus
+{
+
+namespace
+{
+#if NE_PLATFORM_X86
+	void QueryCpuid(unsigned int leaf, unsigned int subleaf, unsigned int registers[4])
+	{
+#ifdef _MSC_VER
+		__cpuidex(reinterpret_cast<int*>(registers), static_cast<int>(leaf), static_cast<int>(subleaf));
+#else
+		__cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+	}
+
+	unsigned long long QueryEnabledXSaveFeatures()
+	{
+#ifdef _MSC_VER
+		return _xgetbv(0);
+#else
+		unsigned int eax, edx;
+		__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+	}
+#endif
+
+	CpuFeatures DetectCpuFeatures()
+	{
+		CpuFeatures features = {};
+
+#if NE_PLATFORM_X86
+		unsigned int registers[4] = {};
+
+		QueryCpuid(0, 0, registers);
+		const unsigned int maxLeaf = registers[0];
+
+		if (maxLeaf < 1)
+			return features;
+
+		QueryCpuid(1, 0, registers);
+		const unsigned int ecx1 = registers[2];
+
+		features.bSSE41 = (ecx1 & (1u << 19)) != 0;
+		features.bSSE42 = (ecx1 & (1u << 20)) != 0;
+
+		//AVX registers are only usable if the OS saves the upper halves on context switches
+		const bool bOSXSave = (ecx1 & (1u << 27)) != 0;
+		const unsigned long long xsaveFeatures = bOSXSave ? QueryEnabledXSaveFeatures() : 0;
+		const bool bYmmEnabled = (xsaveFeatures & 0x6) == 0x6;
+		//AVX-512 additionally needs the opmask and both halves of the upper ZMM registers
+		const bool bZmmEnabled = (xsaveFeatures & 0xE6) == 0xE6;
+
+		features.bAVX = bYmmEnabled && (ecx1 & (1u << 28)) != 0;
+		features.bFMA = features.bAVX && (ecx1 & (1u << 12)) != 0;
+		features.bF16C = features.bAVX && (ecx1 & (1u << 29)) != 0;
+
+		if (maxLeaf >= 7)
+		{
+			QueryCpuid(7, 0, registers);
+			const unsigned int ebx7 = registers[1];
+
+			features.bAVX2 = features.bAVX && (ebx7 & (1u << 5)) != 0;
+			features.bAVX512F = bZmmEnabled && features.bAVX2 && (ebx7 & (1u << 16)) != 0;
+			features.bBMI2 = (ebx7 & (1u << 8)) != 0;
+			features.bSHA = features.bSSE41 && (ebx7 & (1u << 29)) != 0;
+		}
+#endif
+
+		return features;
+	}
+}
+
+const CpuFeatures& GetCpuFeatures()
+{
+	static const CpuFeatures features = DetectCpuFeatures();
+
+	return features;
+}
+
+}
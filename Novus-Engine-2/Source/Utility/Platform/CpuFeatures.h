@@ -0,0 +1,36 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include "PlatformDefines.h"
+
+namespace novus
+{
+
+/**
+ *	Instruction set extensions supported by the CPU and enabled by the OS, used to pick SIMD code paths at runtime.
+ */
+struct CpuFeatures
+{
+	bool bSSE41;
+	bool bSSE42;
+	bool bAVX;
+	bool bAVX2;
+	bool bAVX512F;
+	bool bFMA;
+	bool bF16C;
+	bool bBMI2;
+	bool bSHA;
+};
+
+/**
+ *	Queries the CPU the first time it is called, always returns the same object afterwards.
+ */
+const CpuFeatures& GetCpuFeatures();
+
+}
@@ -8,8 +8,8 @@
 #pragma once
 
 #include <string>
-#include <functional>
 #include "Math/Vector2.h"
+#include "Utility/Delegates/Delegate.h"
 
 namespace novus
 {
@@ -63,21 +63,21 @@ public:
 	// *	Add a quit callback. The quit callback gets called when the user closes the window.
 	// *	@param The callback function must point to a function that returns void and does not take any arguments
 	// */
-	//virtual void AddOnQuitCallback(const std::function<void()>& callback) = 0;
+	//virtual void AddOnQuitCallback(const Delegate<void>& callback) = 0;
 
 	///**
 	// *	Add a quit callback. The quit callback gets called when the user closes the window.
 	// *	@param The callback function must point to a function that returns void and does not take any arguments
 	// */
-	//virtual void RemoveOnQuitCallback(const std::function<void()>& callback) = 0;
+	//virtual void RemoveOnQuitCallback(const Delegate<void>& callback) = 0;
 
 	///**
 	// *	Add a resize callback. The resize callback gets called when the user resizes the window.
 	// *	@param The callback function must point to a function that takes a Vector2i as a parameter.
 	// *			The Vector2i will receive the new width and height of the drawing surface.
 	// */
-	//virtual void AddOnResizeCallback(const std::function<void(const Vector2i&)>& callback) = 0;
-	//virtual void RemoveOnResizeCallback(const std::function<void(const Vector2i&)>& callback) = 0;
+	//virtual void AddOnResizeCallback(const Delegate<void, const Vector2i&>& callback) = 0;
+	//virtual void RemoveOnResizeCallback(const Delegate<void, const Vector2i&>& callback) = 0;
 
 	///**
 	// *	Add an activate callback. The activate callback gets called when the window gains or loses focus.
@@ -85,13 +85,13 @@ public:
 	// *						The bool that the callback function receives is whether the application has gained or lost focus.
 	// *						true: gained focus, false: lost focus
 	// */
-	//virtual void AddOnActivateCallback(const std::function<void(bool)>& callback) = 0;
+	//virtual void AddOnActivateCallback(const Delegate<void, bool>& callback) = 0;
 
 	///**
 	// *	Remove an activate callback. The activate callback gets called when the window gains or loses focus.
 	// *	@param callback A callback identical to the one that should be removed.
 	// */
-	//virtual void RemoveOnActivateCallback(const std::function<void(bool)>& callback) = 0;
+	//virtual void RemoveOnActivateCallback(const Delegate<void, bool>& callback) = 0;
 
 	///**
 	// *	Add a moving callback. The moving callback gets called when the window begins or ends being moved/resized by the user.
@@ -99,12 +99,12 @@ public:
 	// *						The bool that the callback function receives is whether the move event has started or ended
 	// *						true: started moving, false: ended moving
 	// */
-	//virtual void AddOnMoveCallback(const std::function<void(bool)>& callback) = 0;
+	//virtual void AddOnMoveCallback(const Delegate<void, bool>& callback) = 0;
 
-	virtual void SetOnQuitCallback(const std::function<void()>& callback) = 0;
-	virtual void SetOnResizeCallback(const std::function<void(const Vector2i&)>& callback) = 0;
-	virtual void SetOnActivateCallback(const std::function<void(bool)>& callback) = 0;
-	virtual void SetOnMoveCallback(const std::function<void(bool)>& callback) = 0;
+	virtual void SetOnQuitCallback(const Delegate<void>& callback) = 0;
+	virtual void SetOnResizeCallback(const Delegate<void, const Vector2i&>& callback) = 0;
+	virtual void SetOnActivateCallback(const Delegate<void, bool>& callback) = 0;
+	virtual void SetOnMoveCallback(const Delegate<void, bool>& callback) = 0;
 };
 
 };
\ No newline at end of file
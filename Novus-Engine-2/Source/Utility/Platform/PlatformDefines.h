@@ -1,2 +1,20 @@
 #pragma once
 
+//x86 and x64 targets, where SSE/AVX intrinsics and cpuid are available
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define NE_PLATFORM_X86 1
+#else
+#define NE_PLATFORM_X86 0
+#endif
+
+/**
+ *	Enables instruction set extensions for a single function so it can use their intrinsics without compiling the whole file for them.
+ *	MSVC allows any intrinsic without flags, GCC and Clang need the target attribute.
+ *	Only call functions marked with this after checking the CPU supports the extensions (see CpuFeatures.h).
+ *	Example: NE_TARGET("avx2") void TransformAVX2(...);
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define NE_TARGET(features) __attribute__((target(features)))
+#else
+#define NE_TARGET(features)
+#endif
@@ -0,0 +1,39 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include "Math/Vector2.h"
+
+/**
+ *	Events posted to the EventBus by application windows, delivered on the next EventBus::DispatchEvents
+ */
+
+namespace novus
+{
+
+struct WindowQuitEvent
+{
+};
+
+struct WindowResizeEvent
+{
+	Vector2i Size;
+};
+
+struct WindowActivateEvent
+{
+	bool bActive;
+};
+
+struct WindowMoveEvent
+{
+	//True when the user starts dragging or resizing the window, false when they let go
+	bool bMoving;
+};
+
+}
@@ -1,15 +1,17 @@
 #include "WindowsApplicationWindow.h"
+#include "WindowEvents.h"
+#include "Utility/Events/EventBus.h"
 
 namespace novus
 {
 
 /**
- *	Invokes a given std::function if it points to a valid function
+ *	Invokes a given Delegate if it points to a valid function
  */
 template <typename return_t, typename ... params>
-void InvokeIfValid(std::function<return_t(params...)>& func, params... args)
+void InvokeIfValid(const Delegate<return_t, params...>& func, params... args)
 {
-	if (func)
+	if (func.IsValid())
 		func(args...);
 }
 
@@ -100,6 +102,7 @@ void WindowsApplicationWindow::Update()
 	if (msg.message == WM_QUIT)
 	{
 		InvokeIfValid(OnQuitCallback);
+		EventBus::GetInstance()->Post(WindowQuitEvent());
 	}
 }
 
@@ -192,22 +195,27 @@ LRESULT WindowsApplicationWindow::_handleWinAPIMsg(HWND hwnd, UINT msg, WPARAM w
 	switch (msg)
 	{
 	case WM_ACTIVATE:
-		if (LOWORD(wParam) == WA_INACTIVE)
-			InvokeIfValid(OnActivateCallback, false);
-		else
-			InvokeIfValid(OnActivateCallback, true);
+		{
+			const bool bActive = LOWORD(wParam) != WA_INACTIVE;
+
+			InvokeIfValid(OnActivateCallback, bActive);
+			EventBus::GetInstance()->Post(WindowActivateEvent{ bActive });
+		}
 		return 0;
 	case WM_SIZE:
 		WindowWidth = static_cast<unsigned int>(LOWORD(lParam));
 		WindowHeight = static_cast<unsigned int>(HIWORD(lParam));
 
 		InvokeIfValid<void, const Vector2i&>(OnWindowResizeCallback, Vector2i(WindowWidth, WindowHeight));
+		EventBus::GetInstance()->Post(WindowResizeEvent{ Vector2i(WindowWidth, WindowHeight) });
 		return 0;
 	case WM_ENTERSIZEMOVE:
 		InvokeIfValid(OnMoveCallback, true);
+		EventBus::GetInstance()->Post(WindowMoveEvent{ true });
 		return 0;
 	case WM_EXITSIZEMOVE:
 		InvokeIfValid(OnMoveCallback, false);
+		EventBus::GetInstance()->Post(WindowMoveEvent{ false });
 		return 0;
 	case WM_DESTROY:
 		//Forward quit message on to message pump to go and call the OnQuitCallback
@@ -222,7 +230,7 @@ LRESULT WindowsApplicationWindow::_handleWinAPIMsg(HWND hwnd, UINT msg, WPARAM w
 		((MINMAXINFO*)lParam)->ptMinTrackSize.y = 200;
 		return 0;
 	default:
-		if (ProcessInputCallback)
+		if (ProcessInputCallback.IsValid())
 			//Callback to the input system to handle any windows messages for input
 			if (ProcessInputCallback(hwnd, msg, wParam, lParam)) 
 				return 0;
@@ -232,67 +240,67 @@ LRESULT WindowsApplicationWindow::_handleWinAPIMsg(HWND hwnd, UINT msg, WPARAM w
 	return DefWindowProc(hwnd, msg, wParam, lParam);
 }
 
-//void WindowsApplicationWindow::AddOnQuitCallback(const std::function<void()>& callback)
+//void WindowsApplicationWindow::AddOnQuitCallback(const Delegate<void>& callback)
 //{
 //	OnQuitCallback += callback;
 //}
 //
-//void WindowsApplicationWindow::RemoveOnQuitCallback(const std::function<void()>& callback)
+//void WindowsApplicationWindow::RemoveOnQuitCallback(const Delegate<void>& callback)
 //{
 //	OnQuitCallback -= callback;
 //}
 //
-//void WindowsApplicationWindow::AddOnResizeCallback(const std::function<void(const Vector2i&)>& callback)
+//void WindowsApplicationWindow::AddOnResizeCallback(const Delegate<void, const Vector2i&>& callback)
 //{
 //	OnWindowResizeCallback += callback;
 //}
 //
-//void WindowsApplicationWindow::RemoveOnResizeCallback(const std::function<void(const Vector2i&)>& callback)
+//void WindowsApplicationWindow::RemoveOnResizeCallback(const Delegate<void, const Vector2i&>& callback)
 //{
 //	OnWindowResizeCallback -= callback;
 //}
 //
-//void WindowsApplicationWindow::AddOnActivateCallback(const std::function<void(bool)>& callback)
+//void WindowsApplicationWindow::AddOnActivateCallback(const Delegate<void, bool>& callback)
 //{
 //	OnActivateCallback += callback;
 //}
 //
-//void WindowsApplicationWindow::RemoveOnActivateCallback(const std::function<void(bool)>& callback)
+//void WindowsApplicationWindow::RemoveOnActivateCallback(const Delegate<void, bool>& callback)
 //{
 //	OnActivateCallback -= callback;
 //}
 //
-//void WindowsApplicationWindow::AddOnMoveCallback(const std::function<void(bool)>& callback)
+//void WindowsApplicationWindow::AddOnMoveCallback(const Delegate<void, bool>& callback)
 //{
 //	OnMoveCallback += callback;
 //}
 //
-//void WindowsApplicationWindow::RemoveOnMoveCallback(const std::function<void(bool)>& callback)
+//void WindowsApplicationWindow::RemoveOnMoveCallback(const Delegate<void, bool>& callback)
 //{
 //	OnMoveCallback -= callback;
 //}
 
-void WindowsApplicationWindow::SetOnQuitCallback(const std::function<void()>& callback)
+void WindowsApplicationWindow::SetOnQuitCallback(const Delegate<void>& callback)
 {
 	OnQuitCallback = callback;
 }
 
-void WindowsApplicationWindow::SetOnResizeCallback(const std::function<void(const Vector2i&)>& callback)
+void WindowsApplicationWindow::SetOnResizeCallback(const Delegate<void, const Vector2i&>& callback)
 {
 	OnWindowResizeCallback = callback;
 }
 
-void WindowsApplicationWindow::SetOnActivateCallback(const std::function<void(bool)>& callback)
+void WindowsApplicationWindow::SetOnActivateCallback(const Delegate<void, bool>& callback)
 {
 	OnActivateCallback = callback;
 }
 
-void WindowsApplicationWindow::SetOnMoveCallback(const std::function<void(bool)>& callback)
+void WindowsApplicationWindow::SetOnMoveCallback(const Delegate<void, bool>& callback)
 {
 	OnMoveCallback = callback;
 }
 
-void WindowsApplicationWindow::SetProcessInputCallback(const std::function<bool(HWND, UINT, WPARAM, LPARAM)>& callback)
+void WindowsApplicationWindow::SetProcessInputCallback(const Delegate<bool, HWND, UINT, WPARAM, LPARAM>& callback)
 {
 	ProcessInputCallback = callback;
 }
@@ -8,7 +8,6 @@
 #pragma once
 
 #include <Windows.h>
-#include <functional>
 #include "IApplicationWindow.h"
 #include "Utility/Delegates/MulticastDelegate.h"
 
@@ -53,24 +52,24 @@ public:
 
 	LRESULT _handleWinAPIMsg(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
-	/*void AddOnQuitCallback(const std::function<void()>& callback) override;
-	void RemoveOnQuitCallback(const std::function<void()>& callback) override;
+	/*void AddOnQuitCallback(const Delegate<void>& callback) override;
+	void RemoveOnQuitCallback(const Delegate<void>& callback) override;
 
-	void AddOnResizeCallback(const std::function<void(const Vector2i&)>& callback) override;
-	void RemoveOnResizeCallback(const std::function<void(const Vector2i&)>& callback) override;
+	void AddOnResizeCallback(const Delegate<void, const Vector2i&>& callback) override;
+	void RemoveOnResizeCallback(const Delegate<void, const Vector2i&>& callback) override;
 
-	void AddOnActivateCallback(const std::function<void(bool)>& callback) override;
-	void RemoveOnActivateCallback(const std::function<void(bool)>& callback) override;
+	void AddOnActivateCallback(const Delegate<void, bool>& callback) override;
+	void RemoveOnActivateCallback(const Delegate<void, bool>& callback) override;
 
-	void AddOnMoveCallback(const std::function<void(bool)>& callback) override;
-	void RemoveOnMoveCallback(const std::function<void(bool)>& callback) override;*/
+	void AddOnMoveCallback(const Delegate<void, bool>& callback) override;
+	void RemoveOnMoveCallback(const Delegate<void, bool>& callback) override;*/
 
-	void SetOnQuitCallback(const std::function<void()>& callback) override;
-	void SetOnResizeCallback(const std::function<void(const Vector2i&)>& callback) override;
-	void SetOnActivateCallback(const std::function<void(bool)>& callback) override;
-	void SetOnMoveCallback(const std::function<void(bool)>& callback) override;
+	void SetOnQuitCallback(const Delegate<void>& callback) override;
+	void SetOnResizeCallback(const Delegate<void, const Vector2i&>& callback) override;
+	void SetOnActivateCallback(const Delegate<void, bool>& callback) override;
+	void SetOnMoveCallback(const Delegate<void, bool>& callback) override;
 
-	void SetProcessInputCallback(const std::function<bool(HWND, UINT, WPARAM, LPARAM)>& callback);
+	void SetProcessInputCallback(const Delegate<bool, HWND, UINT, WPARAM, LPARAM>& callback);
 
 private:
 	void UpdateWindowSize();
@@ -87,11 +86,11 @@ private:
 
 	std::wstring WindowTitle;
 
-	std::function<void(const Vector2i&)>       OnWindowResizeCallback;
-	std::function<void()>                      OnQuitCallback;
-	std::function<void(bool)>                  OnActivateCallback;
-	std::function<void(bool)>                  OnMoveCallback;
-	std::function<bool(HWND, UINT, WPARAM, LPARAM)> ProcessInputCallback;
+	Delegate<void, const Vector2i&>            OnWindowResizeCallback;
+	Delegate<void>                             OnQuitCallback;
+	Delegate<void, bool>                       OnActivateCallback;
+	Delegate<void, bool>                       OnMoveCallback;
+	Delegate<bool, HWND, UINT, WPARAM, LPARAM> ProcessInputCallback;
 };
 
 namespace detail
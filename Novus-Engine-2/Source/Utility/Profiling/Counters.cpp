@@ -0,0 +1,185 @@
+#include "Counters.h"
+#include "ICounterStream.h"
+#include "Utility/Logging/Logger.h"
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+namespace novus
+{
+
+NE_REGISTER_LOG_TAG(Profiling);
+
+const CounterValue* CounterSnapshot::Find(const char* name) const
+{
+	for (const auto& value : Values)
+	{
+		if (strcmp(value.Name, name) == 0)
+			return &value;
+	}
+
+	return nullptr;
+}
+
+Counter::Counter(const char* name, CounterType type)
+	:Name(name),
+	Type(type),
+	GaugeValue(0)
+{
+	Index = CounterRegistry::GetInstance()->RegisterCounter(this);
+}
+
+CounterRegistry::ThreadSlots::ThreadSlots()
+{
+	for (auto& value : Values)
+	{
+		value.store(0, std::memory_order_relaxed);
+	}
+
+	CounterRegistry::GetInstance()->AddThreadSlots(this);
+}
+
+CounterRegistry::ThreadSlots::~ThreadSlots()
+{
+	CounterRegistry::GetInstance()->RemoveThreadSlots(this);
+}
+
+CounterRegistry* CounterRegistry::StaticInstance = nullptr;
+
+CounterRegistry* CounterRegistry::GetInstance()
+{
+	if (StaticInstance == nullptr)
+	{
+		StaticInstance = new CounterRegistry();
+	}
+
+	return StaticInstance;
+}
+
+CounterRegistry::CounterRegistry()
+	:FrameIndex(0)
+{
+	RetiredValues.fill(0);
+	PreviousTotals.fill(0);
+
+	LastSnapshot.FrameIndex = 0;
+}
+
+CounterRegistry::ThreadSlots& CounterRegistry::GetThreadSlots()
+{
+	static thread_local ThreadSlots slots;
+
+	return slots;
+}
+
+uint32_t CounterRegistry::RegisterCounter(Counter* counter)
+{
+	{
+		std::lock_guard<std::mutex> lock(RegistryLock);
+
+		if (Counters.size() < MaxCounters)
+		{
+			Counters.push_back(counter);
+
+			return static_cast<uint32_t>(Counters.size() - 1);
+		}
+	}
+
+	//Logged without the lock held since logging increments a counter, which may register the thread's slots
+	std::wostringstream message;
+	message << L"Counter " << counter->GetName() << L" exceeds the limit of " << MaxCounters << L" counters and will not be reported";
+
+	NE_ERROR(message.str().c_str(), "Profiling"_id);
+
+	return OverflowIndex;
+}
+
+void CounterRegistry::AddThreadSlots(ThreadSlots* slots)
+{
+	std::lock_guard<std::mutex> lock(RegistryLock);
+
+	ActiveThreadSlots.push_back(slots);
+}
+
+void CounterRegistry::RemoveThreadSlots(ThreadSlots* slots)
+{
+	std::lock_guard<std::mutex> lock(RegistryLock);
+
+	//Keep the values from exiting threads so totals never go backwards
+	for (uint32_t i = 0; i < MaxCounters; i++)
+	{
+		RetiredValues[i] += slots->Values[i].load(std::memory_order_relaxed);
+	}
+
+	auto endIt = std::remove(ActiveThreadSlots.begin(), ActiveThreadSlots.end(), slots);
+	ActiveThreadSlots.erase(endIt, ActiveThreadSlots.end());
+}
+
+const CounterSnapshot& CounterRegistry::CaptureSnapshot()
+{
+	{
+		std::lock_guard<std::mutex> lock(RegistryLock);
+
+		const uint32_t counterCount = static_cast<uint32_t>(Counters.size());
+
+		LastSnapshot.FrameIndex = FrameIndex++;
+		LastSnapshot.Values.resize(counterCount);
+
+		for (uint32_t i = 0; i < counterCount; i++)
+		{
+			const Counter* counter = Counters[i];
+			CounterValue& value = LastSnapshot.Values[i];
+
+			value.Name = counter->GetName();
+			value.Type = counter->GetType();
+
+			if (counter->GetType() == CounterType::Gauge)
+			{
+				value.Value = counter->GetGaugeValue();
+				value.Total = value.Value;
+				continue;
+			}
+
+			int64_t total = RetiredValues[i];
+
+			for (const ThreadSlots* slots : ActiveThreadSlots)
+			{
+				total += slots->Values[i].load(std::memory_order_relaxed);
+			}
+
+			value.Value = total - PreviousTotals[i];
+			value.Total = total;
+
+			PreviousTotals[i] = total;
+		}
+	}
+
+	for (auto& stream : Streams)
+	{
+		stream->Write(LastSnapshot);
+	}
+
+	return LastSnapshot;
+}
+
+uint32_t CounterRegistry::GetCounterCount() const
+{
+	std::lock_guard<std::mutex> lock(RegistryLock);
+
+	return static_cast<uint32_t>(Counters.size());
+}
+
+void CounterRegistry::AddStream(ICounterStream* stream)
+{
+	Streams.push_back(stream);
+}
+
+void CounterRegistry::RemoveStream(ICounterStream* stream)
+{
+	auto endIt = std::remove_if(Streams.begin(), Streams.end(),
+		[stream](const ICounterStream* s) { return s == stream; });
+
+	Streams.erase(endIt, Streams.end());
+}
+
+}
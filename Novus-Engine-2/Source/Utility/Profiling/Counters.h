@@ -0,0 +1,189 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <array>
+#include <vector>
+#include <mutex>
+
+/**
+ *	Engine wide named counters and gauges.
+ *
+ *	Counters are defined once at namespace scope with NE_DEFINE_COUNTER and can be shared between files with NE_DECLARE_COUNTER.
+ *	Increments go into a slot owned by the calling thread so the hot path is a plain load and store with no locked instructions.
+ *	CounterRegistry::CaptureSnapshot sums all thread slots once per frame and hands the result to any registered streams.
+ *
+ *	Defining NE_DISABLE_COUNTERS compiles all of the macros out, the amount expressions passed to them are not evaluated.
+ */
+
+#ifndef NE_DISABLE_COUNTERS
+
+#define NE_COUNTERS_ENABLED 1
+
+#define NE_DEFINE_COUNTER(variable, name) novus::Counter variable(name, novus::CounterType::Counter)
+#define NE_DEFINE_GAUGE(variable, name) novus::Counter variable(name, novus::CounterType::Gauge)
+#define NE_DECLARE_COUNTER(variable) extern novus::Counter variable
+
+#define NE_COUNTER_ADD(variable, amount) ((variable).Add(static_cast<int64_t>(amount)))
+#define NE_COUNTER_INCREMENT(variable) ((variable).Add(1))
+#define NE_GAUGE_SET(variable, value) ((variable).Set(static_cast<int64_t>(value)))
+
+#else
+
+#define NE_COUNTERS_ENABLED 0
+
+#define NE_DEFINE_COUNTER(variable, name) static_assert(true, "")
+#define NE_DEFINE_GAUGE(variable, name) static_assert(true, "")
+#define NE_DECLARE_COUNTER(variable) static_assert(true, "")
+
+#define NE_COUNTER_ADD(variable, amount) ((void)0)
+#define NE_COUNTER_INCREMENT(variable) ((void)0)
+#define NE_GAUGE_SET(variable, value) ((void)0)
+
+#endif
+
+namespace novus
+{
+
+class ICounterStream;
+
+enum class CounterType : uint8_t
+{
+	//Accumulates values, snapshots report the amount added during the frame
+	Counter,
+	//Holds the last value set from any thread
+	Gauge
+};
+
+struct CounterValue
+{
+	const char* Name;
+	CounterType Type;
+
+	//Amount added this frame for counters, current value for gauges
+	int64_t Value;
+	//Amount added since startup for counters, current value for gauges
+	int64_t Total;
+};
+
+struct CounterSnapshot
+{
+	uint64_t FrameIndex;
+	std::vector<CounterValue> Values;
+
+	/** Returns the value with the specified name or nullptr if there is none */
+	const CounterValue* Find(const char* name) const;
+};
+
+class Counter
+{
+public:
+	Counter(const char* name, CounterType type);
+
+	inline void Add(int64_t amount);
+	inline void Set(int64_t value) { GaugeValue.store(value, std::memory_order_relaxed); }
+
+	const char* GetName() const { return Name; }
+	CounterType GetType() const { return Type; }
+	uint32_t GetIndex() const { return Index; }
+
+	int64_t GetGaugeValue() const { return GaugeValue.load(std::memory_order_relaxed); }
+
+private:
+	Counter(const Counter&) = delete;
+	Counter& operator= (const Counter&) = delete;
+
+private:
+	const char* Name;
+	CounterType Type;
+	uint32_t Index;
+
+	std::atomic<int64_t> GaugeValue;
+};
+
+class CounterRegistry
+{
+	friend class Counter;
+
+public:
+	static const uint32_t MaxCounters = 256;
+
+	//Counters registered past MaxCounters all share this slot, it is never reported
+	static const uint32_t OverflowIndex = MaxCounters;
+
+	/**
+	 *	Values owned by a single thread. Only the owning thread writes to the slots, the atomics are only
+	 *	there so the registry can read them while aggregating and are accessed with relaxed ordering.
+	 */
+	struct ThreadSlots
+	{
+		ThreadSlots();
+		~ThreadSlots();
+
+		std::array<std::atomic<int64_t>, MaxCounters + 1> Values;
+	};
+
+public:
+	static CounterRegistry* GetInstance();
+
+	/**
+	 *	Sums the values from all threads into a new snapshot and writes it to the registered streams.
+	 *	Should be called once per frame from the main thread.
+	 */
+	const CounterSnapshot& CaptureSnapshot();
+
+	/** The snapshot from the last call to CaptureSnapshot */
+	const CounterSnapshot& GetLastSnapshot() const { return LastSnapshot; }
+
+	uint32_t GetCounterCount() const;
+
+	void AddStream(ICounterStream* stream);
+	void RemoveStream(ICounterStream* stream);
+
+	/** Slots for the calling thread, created the first time a thread touches a counter */
+	static ThreadSlots& GetThreadSlots();
+
+private:
+	//Only allow access via GetInstance
+	CounterRegistry();
+	~CounterRegistry() {}
+	CounterRegistry(const CounterRegistry&) = delete;
+	CounterRegistry& operator= (const CounterRegistry&) = delete;
+
+	uint32_t RegisterCounter(Counter* counter);
+
+	void AddThreadSlots(ThreadSlots* slots);
+	void RemoveThreadSlots(ThreadSlots* slots);
+
+private:
+	static CounterRegistry* StaticInstance;
+
+	mutable std::mutex RegistryLock;
+
+	std::vector<Counter*> Counters;
+	std::vector<ThreadSlots*> ActiveThreadSlots;
+
+	//Values from threads that have exited
+	std::array<int64_t, MaxCounters> RetiredValues;
+	std::array<int64_t, MaxCounters> PreviousTotals;
+
+	std::vector<ICounterStream*> Streams;
+
+	CounterSnapshot LastSnapshot;
+	uint64_t FrameIndex;
+};
+
+inline void Counter::Add(int64_t amount)
+{
+	std::atomic<int64_t>& slot = CounterRegistry::GetThreadSlots().Values[Index];
+	slot.store(slot.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+}
@@ -0,0 +1,47 @@
+#include "CsvCounterStream.h"
+
+namespace novus
+{
+
+CsvCounterStream::CsvCounterStream(const std::string& filePath)
+	:HeaderCounterCount(static_cast<size_t>(-1))
+{
+	File.open(filePath, std::ios::out | std::ios::trunc);
+}
+
+CsvCounterStream::~CsvCounterStream()
+{
+	if (File.is_open())
+		File.close();
+}
+
+void CsvCounterStream::Write(const CounterSnapshot& snapshot)
+{
+	if (!File.is_open())
+		return;
+
+	if (snapshot.Values.size() != HeaderCounterCount)
+	{
+		File << "Frame";
+
+		for (const auto& value : snapshot.Values)
+		{
+			File << ',' << value.Name;
+		}
+
+		File << '\n';
+
+		HeaderCounterCount = snapshot.Values.size();
+	}
+
+	File << snapshot.FrameIndex;
+
+	for (const auto& value : snapshot.Values)
+	{
+		File << ',' << value.Value;
+	}
+
+	File << '\n';
+}
+
+}
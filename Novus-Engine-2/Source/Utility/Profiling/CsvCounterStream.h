@@ -0,0 +1,36 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include "ICounterStream.h"
+#include <fstream>
+#include <string>
+
+namespace novus
+{
+
+/**
+ *	Writes one row per frame with the per frame value of every counter and gauge.
+ *	A new header row is written whenever counters are registered after the stream was opened.
+ */
+class CsvCounterStream : public ICounterStream
+{
+public:
+	explicit CsvCounterStream(const std::string& filePath);
+	~CsvCounterStream();
+
+	bool IsOpen() const { return File.is_open(); }
+
+	void Write(const CounterSnapshot& snapshot) override;
+
+private:
+	std::ofstream File;
+	size_t HeaderCounterCount;
+};
+
+}
@@ -0,0 +1,154 @@
+#include "FrameStatistics.h"
+#include "Utility/Logging/Logger.h"
+#include <sstream>
+#include <iomanip>
+
+namespace novus
+{
+
+NE_REGISTER_LOG_TAG(Profiling);
+
+namespace
+{
+	void WriteSummary(std::wostringstream& stream, const std::string& name, const TimeHistogramSummary& summary)
+	{
+		stream << std::wstring(name.begin(), name.end()) << L": count " << summary.Count
+			<< L", mean " << summary.Mean * 1000.0
+			<< L", min " << summary.Min * 1000.0
+			<< L", p50 " << summary.P50 * 1000.0
+			<< L", p90 " << summary.P90 * 1000.0
+			<< L", p95 " << summary.P95 * 1000.0
+			<< L", p99 " << summary.P99 * 1000.0
+			<< L", p99.9 " << summary.P999 * 1000.0
+			<< L", max " << summary.Max * 1000.0
+			<< L" (ms), hitches " << summary.HitchCount;
+	}
+}
+
+TrackedDuration::TrackedDuration(const std::string& name, double hitchThreshold, uint32_t sliceCount)
+	:Name(name),
+	HitchThreshold(hitchThreshold),
+	Rolling(sliceCount)
+{
+}
+
+void TrackedDuration::Record(double seconds)
+{
+	Lifetime.Record(seconds);
+	Rolling.Record(seconds);
+}
+
+FrameStatistics* FrameStatistics::StaticInstance = nullptr;
+
+FrameStatistics* FrameStatistics::GetInstance()
+{
+	if (StaticInstance == nullptr)
+	{
+		StaticInstance = new FrameStatistics();
+	}
+
+	return StaticInstance;
+}
+
+FrameStatistics::FrameStatistics()
+	:FrameTime("Frame", 1.0 / 30.0, WindowSliceCount),
+	FrameHitchThreshold(1.0 / 30.0),
+	FrameCount(0)
+{
+}
+
+bool FrameStatistics::RecordFrame(double deltaTime)
+{
+	FrameTime.Record(deltaTime);
+	FrameCount++;
+
+	if (FrameCount % FramesPerSlice == 0)
+	{
+		FrameTime.Rolling.AdvanceWindow();
+
+		std::lock_guard<std::mutex> lock(DurationLock);
+
+		for (auto& duration : Durations)
+		{
+			duration->Rolling.AdvanceWindow();
+		}
+	}
+
+	return FrameHitchThreshold > 0.0 && deltaTime >= FrameHitchThreshold;
+}
+
+TrackedDuration* FrameStatistics::RegisterDuration(const std::string& name, double hitchThreshold)
+{
+	std::lock_guard<std::mutex> lock(DurationLock);
+
+	for (auto& duration : Durations)
+	{
+		if (duration->GetName() == name)
+			return duration.get();
+	}
+
+	Durations.push_back(std::unique_ptr<TrackedDuration>(new TrackedDuration(name, hitchThreshold, WindowSliceCount)));
+
+	return Durations.back().get();
+}
+
+TrackedDuration* FrameStatistics::FindDuration(const std::string& name)
+{
+	std::lock_guard<std::mutex> lock(DurationLock);
+
+	for (auto& duration : Durations)
+	{
+		if (duration->GetName() == name)
+			return duration.get();
+	}
+
+	return nullptr;
+}
+
+TimeHistogramSummary FrameStatistics::GetFrameSummary(bool rollingWindow) const
+{
+	if (rollingWindow)
+		return FrameTime.Rolling.GetSummary(FrameHitchThreshold);
+
+	return FrameTime.Lifetime.GetSummary(FrameHitchThreshold);
+}
+
+void FrameStatistics::DumpSummary(bool rollingWindow)
+{
+	std::wostringstream stream;
+	stream << std::fixed << std::setprecision(3);
+
+	stream << (rollingWindow ? L"Rolling window of up to " : L"Session of ")
+		<< (rollingWindow ? WindowSliceCount * FramesPerSlice : FrameCount) << L" frames\n";
+
+	WriteSummary(stream, FrameTime.GetName(), GetFrameSummary(rollingWindow));
+
+	{
+		std::lock_guard<std::mutex> lock(DurationLock);
+
+		for (const auto& duration : Durations)
+		{
+			stream << L"\n";
+			WriteSummary(stream, duration->GetName(), rollingWindow ? duration->GetRollingSummary() : duration->GetLifetimeSummary());
+		}
+	}
+
+	NE_MESSAGE(stream.str().c_str(), "Profiling"_id);
+}
+
+void FrameStatistics::Reset()
+{
+	FrameTime.Lifetime.Reset();
+	FrameTime.Rolling.Reset();
+	FrameCount = 0;
+
+	std::lock_guard<std::mutex> lock(DurationLock);
+
+	for (auto& duration : Durations)
+	{
+		duration->Lifetime.Reset();
+		duration->Rolling.Reset();
+	}
+}
+
+}
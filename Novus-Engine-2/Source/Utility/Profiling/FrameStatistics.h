@@ -0,0 +1,155 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include "TimeHistogram.h"
+#include <string>
+#include <deque>
+#include <mutex>
+#include <chrono>
+
+#define NE_PROFILING_CONCAT_INNER(a, b) a##b
+#define NE_PROFILING_CONCAT(a, b) NE_PROFILING_CONCAT_INNER(a, b)
+
+/**
+ *	Times the rest of the enclosing scope and records it into the named duration.
+ *	The duration is registered the first time the scope is entered.
+ */
+#define NE_TRACK_DURATION(name) \
+	static novus::TrackedDuration* NE_PROFILING_CONCAT(neTrackedDuration, __LINE__) = novus::FrameStatistics::GetInstance()->RegisterDuration(name); \
+	novus::ScopedDurationTimer NE_PROFILING_CONCAT(neScopedDurationTimer, __LINE__)(NE_PROFILING_CONCAT(neTrackedDuration, __LINE__))
+
+namespace novus
+{
+
+/**
+ *	A named duration with histograms over the whole session and over the rolling window.
+ *	Recording is lock-free and can be done from any thread.
+ */
+class TrackedDuration
+{
+	friend class FrameStatistics;
+
+public:
+	TrackedDuration(const std::string& name, double hitchThreshold, uint32_t sliceCount);
+
+	void Record(double seconds);
+
+	const std::string& GetName() const { return Name; }
+	double GetHitchThreshold() const { return HitchThreshold; }
+
+	const TimeHistogram& GetLifetimeHistogram() const { return Lifetime; }
+	const RollingTimeHistogram& GetRollingHistogram() const { return Rolling; }
+
+	TimeHistogramSummary GetLifetimeSummary() const { return Lifetime.GetSummary(HitchThreshold); }
+	TimeHistogramSummary GetRollingSummary() const { return Rolling.GetSummary(HitchThreshold); }
+
+private:
+	TrackedDuration(const TrackedDuration&) = delete;
+	TrackedDuration& operator= (const TrackedDuration&) = delete;
+
+private:
+	std::string Name;
+	double HitchThreshold;
+
+	TimeHistogram Lifetime;
+	RollingTimeHistogram Rolling;
+};
+
+/**
+ *	Collects frame times and named durations so builds can be compared by percentiles and hitch counts instead of averages.
+ *	The rolling window covers WindowSliceCount * FramesPerSlice frames and moves forward as frames are recorded.
+ */
+class FrameStatistics
+{
+public:
+	static const uint32_t WindowSliceCount = 8;
+	static const uint32_t FramesPerSlice = 60;
+
+public:
+	static FrameStatistics* GetInstance();
+
+	/**
+	 *	Records the time taken by the last frame, should be called once per frame from the main thread.
+	 *	@return True if the frame was a hitch
+	 */
+	bool RecordFrame(double deltaTime);
+
+	/**
+	 *	Registers a named duration or returns the existing one with the same name.
+	 *	The returned pointer stays valid for the lifetime of the application.
+	 *	@param hitchThreshold Samples at or above this value in seconds are counted as hitches, 0 disables hitch counting
+	 */
+	TrackedDuration* RegisterDuration(const std::string& name, double hitchThreshold = 0.0);
+
+	/** Returns the duration registered with the name or nullptr if there is none */
+	TrackedDuration* FindDuration(const std::string& name);
+
+	void SetFrameHitchThreshold(double seconds) { FrameHitchThreshold = seconds; }
+	double GetFrameHitchThreshold() const { return FrameHitchThreshold; }
+
+	uint64_t GetFrameCount() const { return FrameCount; }
+
+	TimeHistogramSummary GetFrameSummary(bool rollingWindow = false) const;
+
+	/**
+	 *	Writes the frame and duration summaries to the log.
+	 *	@param rollingWindow Dump the rolling window instead of the whole session
+	 */
+	void DumpSummary(bool rollingWindow = false);
+
+	/**
+	 *	Clears all recorded samples, registered durations stay registered.
+	 */
+	void Reset();
+
+private:
+	//Only allow access via GetInstance
+	FrameStatistics();
+	~FrameStatistics() {}
+	FrameStatistics(const FrameStatistics&) = delete;
+	FrameStatistics& operator= (const FrameStatistics&) = delete;
+
+private:
+	static FrameStatistics* StaticInstance;
+
+	TrackedDuration FrameTime;
+	double FrameHitchThreshold;
+	uint64_t FrameCount;
+
+	std::mutex DurationLock;
+	std::deque<std::unique_ptr<TrackedDuration>> Durations;
+};
+
+/**
+ *	Records the time between construction and destruction into a tracked duration.
+ */
+class ScopedDurationTimer
+{
+public:
+	explicit ScopedDurationTimer(TrackedDuration* duration)
+		:Duration(duration),
+		StartTime(std::chrono::high_resolution_clock::now())
+	{}
+
+	~ScopedDurationTimer()
+	{
+		std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - StartTime;
+		Duration->Record(elapsed.count());
+	}
+
+private:
+	ScopedDurationTimer(const ScopedDurationTimer&) = delete;
+	ScopedDurationTimer& operator= (const ScopedDurationTimer&) = delete;
+
+private:
+	TrackedDuration* Duration;
+	std::chrono::high_resolution_clock::time_point StartTime;
+};
+
+}
@@ -0,0 +1,23 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include "Counters.h"
+
+namespace novus
+{
+
+class ICounterStream
+{
+public:
+	virtual ~ICounterStream() {}
+
+	virtual void Write(const CounterSnapshot& snapshot) = 0;
+};
+
+}
@@ -0,0 +1,294 @@
+#include "TimeHistogram.h"
+#include <cassert>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace novus
+{
+
+namespace
+{
+	inline uint32_t HighestBitIndex(uint64_t value)
+	{
+		assert(value != 0);
+
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanReverse64(&index, value);
+		return static_cast<uint32_t>(index);
+#else
+		return 63 - static_cast<uint32_t>(__builtin_clzll(value));
+#endif
+	}
+
+	inline uint64_t SecondsToMicroseconds(double seconds)
+	{
+		if (seconds <= 0.0)
+			return 0;
+
+		const double microseconds = seconds * 1000000.0;
+
+		if (microseconds >= static_cast<double>(TimeHistogram::MaxTrackableValue))
+			return TimeHistogram::MaxTrackableValue;
+
+		return static_cast<uint64_t>(microseconds + 0.5);
+	}
+
+	inline double MicrosecondsToSeconds(uint64_t microseconds)
+	{
+		return static_cast<double>(microseconds) * 0.000001;
+	}
+}
+
+TimeHistogram::TimeHistogram()
+{
+	Reset();
+}
+
+void TimeHistogram::Record(double seconds)
+{
+	RecordMicroseconds(SecondsToMicroseconds(seconds));
+}
+
+void TimeHistogram::RecordMicroseconds(uint64_t microseconds)
+{
+	if (microseconds > MaxTrackableValue)
+		microseconds = MaxTrackableValue;
+
+	Buckets[GetBucketIndex(microseconds)].fetch_add(1, std::memory_order_relaxed);
+	Count.fetch_add(1, std::memory_order_relaxed);
+	Sum.fetch_add(microseconds, std::memory_order_relaxed);
+
+	uint64_t currentMin = MinValue.load(std::memory_order_relaxed);
+	while (microseconds < currentMin && !MinValue.compare_exchange_weak(currentMin, microseconds, std::memory_order_relaxed)) {}
+
+	uint64_t currentMax = MaxValue.load(std::memory_order_relaxed);
+	while (microseconds > currentMax && !MaxValue.compare_exchange_weak(currentMax, microseconds, std::memory_order_relaxed)) {}
+}
+
+void TimeHistogram::Reset()
+{
+	for (auto& bucket : Buckets)
+	{
+		bucket.store(0, std::memory_order_relaxed);
+	}
+
+	Count.store(0, std::memory_order_relaxed);
+	Sum.store(0, std::memory_order_relaxed);
+	MinValue.store(UINT64_MAX, std::memory_order_relaxed);
+	MaxValue.store(0, std::memory_order_relaxed);
+}
+
+void TimeHistogram::Merge(const TimeHistogram& other)
+{
+	for (uint32_t i = 0; i < BucketCount; i++)
+	{
+		const uint32_t count = other.Buckets[i].load(std::memory_order_relaxed);
+
+		if (count != 0)
+			Buckets[i].fetch_add(count, std::memory_order_relaxed);
+	}
+
+	Count.fetch_add(other.Count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	Sum.fetch_add(other.Sum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+	const uint64_t otherMin = other.MinValue.load(std::memory_order_relaxed);
+	uint64_t currentMin = MinValue.load(std::memory_order_relaxed);
+	while (otherMin < currentMin && !MinValue.compare_exchange_weak(currentMin, otherMin, std::memory_order_relaxed)) {}
+
+	const uint64_t otherMax = other.MaxValue.load(std::memory_order_relaxed);
+	uint64_t currentMax = MaxValue.load(std::memory_order_relaxed);
+	while (otherMax > currentMax && !MaxValue.compare_exchange_weak(currentMax, otherMax, std::memory_order_relaxed)) {}
+}
+
+double TimeHistogram::GetMin() const
+{
+	return GetCount() > 0 ? MicrosecondsToSeconds(MinValue.load(std::memory_order_relaxed)) : 0.0;
+}
+
+double TimeHistogram::GetMax() const
+{
+	return GetCount() > 0 ? MicrosecondsToSeconds(MaxValue.load(std::memory_order_relaxed)) : 0.0;
+}
+
+double TimeHistogram::GetMean() const
+{
+	const uint64_t count = GetCount();
+
+	if (count == 0)
+		return 0.0;
+
+	return MicrosecondsToSeconds(Sum.load(std::memory_order_relaxed)) / static_cast<double>(count);
+}
+
+double TimeHistogram::GetPercentile(double percentile) const
+{
+	uint64_t total = 0;
+
+	for (const auto& bucket : Buckets)
+	{
+		total += bucket.load(std::memory_order_relaxed);
+	}
+
+	if (total == 0)
+		return 0.0;
+
+	if (percentile < 0.0)
+		percentile = 0.0;
+	else if (percentile > 100.0)
+		percentile = 100.0;
+
+	//Index of the sample we are looking for in sorted order, at least the first sample
+	uint64_t target = static_cast<uint64_t>(percentile * 0.01 * static_cast<double>(total) + 0.5);
+	if (target == 0)
+		target = 1;
+
+	const uint64_t maxValue = MaxValue.load(std::memory_order_relaxed);
+	uint64_t accumulated = 0;
+
+	for (uint32_t i = 0; i < BucketCount; i++)
+	{
+		accumulated += Buckets[i].load(std::memory_order_relaxed);
+
+		if (accumulated >= target)
+		{
+			//Report the highest value that lands in this bucket, but never more than the largest recorded sample
+			const uint64_t upper = GetBucketUpperBound(i);
+			return MicrosecondsToSeconds(upper < maxValue ? upper : maxValue);
+		}
+	}
+
+	return MicrosecondsToSeconds(maxValue);
+}
+
+uint64_t TimeHistogram::GetCountAbove(double seconds) const
+{
+	const uint64_t threshold = SecondsToMicroseconds(seconds);
+	uint64_t result = 0;
+
+	//Buckets that only partially cover the threshold are counted as long as their upper bound reaches it
+	for (uint32_t i = GetBucketIndex(threshold); i < BucketCount; i++)
+	{
+		result += Buckets[i].load(std::memory_order_relaxed);
+	}
+
+	return result;
+}
+
+TimeHistogramSummary TimeHistogram::GetSummary(double hitchThreshold) const
+{
+	TimeHistogramSummary summary;
+
+	summary.Count = GetCount();
+	summary.HitchCount = hitchThreshold > 0.0 ? GetCountAbove(hitchThreshold) : 0;
+	summary.Min = GetMin();
+	summary.Max = GetMax();
+	summary.Mean = GetMean();
+	summary.P50 = GetPercentile(50.0);
+	summary.P90 = GetPercentile(90.0);
+	summary.P95 = GetPercentile(95.0);
+	summary.P99 = GetPercentile(99.0);
+	summary.P999 = GetPercentile(99.9);
+
+	return summary;
+}
+
+uint32_t TimeHistogram::GetBucketIndex(uint64_t microseconds)
+{
+	//Values below 2 * SubBucketCount get one bucket each, after that every power of two is split into SubBucketCount linear buckets
+	if (microseconds < (2 * SubBucketCount))
+		return static_cast<uint32_t>(microseconds);
+
+	const uint32_t exponent = HighestBitIndex(microseconds) - SubBucketBits;
+	const uint32_t subBucket = static_cast<uint32_t>(microseconds >> exponent) - SubBucketCount;
+
+	return (exponent + 1) * SubBucketCount + subBucket;
+}
+
+uint64_t TimeHistogram::GetBucketLowerBound(uint32_t index)
+{
+	assert(index < BucketCount);
+
+	if (index < (2 * SubBucketCount))
+		return index;
+
+	const uint32_t exponent = index / SubBucketCount - 1;
+	const uint64_t subBucket = index % SubBucketCount + SubBucketCount;
+
+	return subBucket << exponent;
+}
+
+uint64_t TimeHistogram::GetBucketUpperBound(uint32_t index)
+{
+	assert(index < BucketCount);
+
+	if (index < (2 * SubBucketCount))
+		return index;
+
+	const uint32_t exponent = index / SubBucketCount - 1;
+	const uint64_t subBucket = index % SubBucketCount + SubBucketCount;
+
+	return ((subBucket + 1) << exponent) - 1;
+}
+
+RollingTimeHistogram::RollingTimeHistogram(uint32_t sliceCount)
+	:CurrentSlice(0)
+{
+	assert(sliceCount > 0);
+
+	Slices.reserve(sliceCount);
+
+	for (uint32_t i = 0; i < sliceCount; i++)
+	{
+		Slices.push_back(std::unique_ptr<TimeHistogram>(new TimeHistogram()));
+	}
+}
+
+void RollingTimeHistogram::Record(double seconds)
+{
+	Slices[CurrentSlice.load(std::memory_order_acquire)]->Record(seconds);
+}
+
+void RollingTimeHistogram::RecordMicroseconds(uint64_t microseconds)
+{
+	Slices[CurrentSlice.load(std::memory_order_acquire)]->RecordMicroseconds(microseconds);
+}
+
+void RollingTimeHistogram::AdvanceWindow()
+{
+	const uint32_t next = (CurrentSlice.load(std::memory_order_relaxed) + 1) % static_cast<uint32_t>(Slices.size());
+
+	//Clear the oldest slice before publishing it so recording threads never see stale samples in the new slice.
+	//Samples recorded by threads that still hold the previous index land in the previous slice, which is still inside the window.
+	Slices[next]->Reset();
+
+	CurrentSlice.store(next, std::memory_order_release);
+}
+
+void RollingTimeHistogram::Reset()
+{
+	for (auto& slice : Slices)
+	{
+		slice->Reset();
+	}
+}
+
+void RollingTimeHistogram::GetWindow(TimeHistogram& result) const
+{
+	for (const auto& slice : Slices)
+	{
+		result.Merge(*slice);
+	}
+}
+
+TimeHistogramSummary RollingTimeHistogram::GetSummary(double hitchThreshold) const
+{
+	TimeHistogram window;
+	GetWindow(window);
+
+	return window.GetSummary(hitchThreshold);
+}
+
+}
\ No newline at end of file
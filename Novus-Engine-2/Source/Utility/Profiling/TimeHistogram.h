@@ -0,0 +1,156 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <array>
+#include <vector>
+#include <memory>
+
+/**
+ *	HDR style log-linear histogram for timing samples.
+ *	Values are tracked in microseconds with a relative error of about 3% (32 linear sub buckets per power of two)
+ *	from 1 microsecond up to a bit over an hour, which is plenty for frame times and most engine durations.
+ *
+ *	Recording is lock-free and can happen from any thread, queries read the buckets without synchronizing so they
+ *	may be off by the few samples that were recorded while the query was running.
+ */
+
+namespace novus
+{
+
+struct TimeHistogramSummary
+{
+	uint64_t Count;
+	uint64_t HitchCount;
+
+	//All times are in seconds
+	double Min;
+	double Max;
+	double Mean;
+	double P50;
+	double P90;
+	double P95;
+	double P99;
+	double P999;
+};
+
+class TimeHistogram
+{
+public:
+	static const uint32_t SubBucketBits = 5;
+	static const uint32_t SubBucketCount = 1 << SubBucketBits;
+	static const uint32_t MaxValueBits = 32;
+	static const uint32_t BucketCount = (MaxValueBits - SubBucketBits + 1) * SubBucketCount;
+
+	/** Largest value in microseconds that can be tracked, larger samples are clamped to this. */
+	static const uint64_t MaxTrackableValue = (1ull << MaxValueBits) - 1;
+
+public:
+	TimeHistogram();
+
+	/**
+	 *	Record a sample in seconds.
+	 */
+	void Record(double seconds);
+
+	/**
+	 *	Record a sample in microseconds.
+	 */
+	void RecordMicroseconds(uint64_t microseconds);
+
+	/**
+	 *	Clears all samples. Not safe to call while other threads are recording into this histogram.
+	 */
+	void Reset();
+
+	/**
+	 *	Adds all samples from another histogram into this one.
+	 */
+	void Merge(const TimeHistogram& other);
+
+	uint64_t GetCount() const { return Count.load(std::memory_order_relaxed); }
+
+	/** Minimum sample in seconds, 0 if there are no samples */
+	double GetMin() const;
+	/** Maximum sample in seconds, 0 if there are no samples */
+	double GetMax() const;
+	/** Mean of all samples in seconds, 0 if there are no samples */
+	double GetMean() const;
+
+	/**
+	 *	Get the value in seconds that the specified percentage of samples are less than or equal to.
+	 *	@param percentile Percentile in the range [0, 100]
+	 */
+	double GetPercentile(double percentile) const;
+
+	/**
+	 *	Get the number of samples at or above the specified threshold in seconds.
+	 *	The threshold is rounded down to the start of its bucket so samples just under it may also be counted.
+	 */
+	uint64_t GetCountAbove(double seconds) const;
+
+	/**
+	 *	Builds a summary of the histogram.
+	 *	@param hitchThreshold Samples at or above this value in seconds are counted as hitches, a threshold of 0 disables hitch counting
+	 */
+	TimeHistogramSummary GetSummary(double hitchThreshold = 0.0) const;
+
+	static uint32_t GetBucketIndex(uint64_t microseconds);
+	static uint64_t GetBucketLowerBound(uint32_t index);
+	static uint64_t GetBucketUpperBound(uint32_t index);
+
+private:
+	TimeHistogram(const TimeHistogram&) = delete;
+	TimeHistogram& operator= (const TimeHistogram&) = delete;
+
+private:
+	std::array<std::atomic<uint32_t>, BucketCount> Buckets;
+
+	std::atomic<uint64_t> Count;
+	std::atomic<uint64_t> Sum;
+	std::atomic<uint64_t> MinValue;
+	std::atomic<uint64_t> MaxValue;
+};
+
+/**
+ *	Histogram over a rolling window made of a ring of histogram slices.
+ *	Samples go into the newest slice and AdvanceWindow drops the oldest slice, so queries cover the last
+ *	SliceCount windows worth of samples. AdvanceWindow should only be called from one thread (usually at the end of a frame).
+ */
+class RollingTimeHistogram
+{
+public:
+	explicit RollingTimeHistogram(uint32_t sliceCount);
+
+	void Record(double seconds);
+	void RecordMicroseconds(uint64_t microseconds);
+
+	/**
+	 *	Starts a new slice, discarding the samples in the oldest slice.
+	 */
+	void AdvanceWindow();
+
+	void Reset();
+
+	uint32_t GetSliceCount() const { return static_cast<uint32_t>(Slices.size()); }
+
+	/**
+	 *	Merges all slices in the window into the result histogram.
+	 */
+	void GetWindow(TimeHistogram& result) const;
+
+	TimeHistogramSummary GetSummary(double hitchThreshold = 0.0) const;
+
+private:
+	std::vector<std::unique_ptr<TimeHistogram>> Slices;
+	std::atomic<uint32_t> CurrentSlice;
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,191 @@
+#include "ProfiledMutex.h"
+#include "Utility/Logging/Logger.h"
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+
+using std::chrono::steady_clock;
+
+namespace novus
+{
+
+NE_REGISTER_LOG_TAG(Profiling);
+
+namespace
+{
+	inline uint64_t ToNanoseconds(steady_clock::duration duration)
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+	}
+
+	inline void UpdateMax(std::atomic<uint64_t>& maxValue, uint64_t value)
+	{
+		uint64_t current = maxValue.load(std::memory_order_relaxed);
+		while (value > current && !maxValue.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+	}
+}
+
+LockProfiler* LockProfiler::StaticInstance = nullptr;
+
+LockProfiler* LockProfiler::GetInstance()
+{
+	if (StaticInstance == nullptr)
+	{
+		StaticInstance = new LockProfiler();
+	}
+
+	return StaticInstance;
+}
+
+LockStatistics* LockProfiler::RegisterLock(const char* name)
+{
+	std::lock_guard<std::mutex> lock(RegistryLock);
+
+	for (auto& statistics : Locks)
+	{
+		if (statistics->Name == name)
+			return statistics.get();
+	}
+
+	Locks.push_back(std::unique_ptr<LockStatistics>(new LockStatistics(name)));
+
+	return Locks.back().get();
+}
+
+std::vector<LockReportEntry> LockProfiler::GetReport(size_t maxEntries) const
+{
+	std::vector<LockReportEntry> report;
+
+	{
+		std::lock_guard<std::mutex> lock(RegistryLock);
+
+		report.reserve(Locks.size());
+
+		for (const auto& statistics : Locks)
+		{
+			LockReportEntry entry;
+			entry.Name = statistics->Name;
+			entry.AcquireCount = statistics->AcquireCount.load(std::memory_order_relaxed);
+			entry.ContentionCount = statistics->ContentionCount.load(std::memory_order_relaxed);
+			entry.TotalWait = statistics->TotalWaitNs.load(std::memory_order_relaxed) * 1.0e-9;
+			entry.MaxWait = statistics->MaxWaitNs.load(std::memory_order_relaxed) * 1.0e-9;
+			entry.P99Wait = statistics->WaitTimes.GetPercentile(99.0);
+			entry.TotalHold = statistics->TotalHoldNs.load(std::memory_order_relaxed) * 1.0e-9;
+			entry.MaxHold = statistics->MaxHoldNs.load(std::memory_order_relaxed) * 1.0e-9;
+			entry.MeanHold = entry.AcquireCount > 0 ? entry.TotalHold / static_cast<double>(entry.AcquireCount) : 0.0;
+
+			report.push_back(entry);
+		}
+	}
+
+	//Locks that make threads wait the longest in total are the most likely scaling problems
+	std::sort(report.begin(), report.end(), [](const LockReportEntry& a, const LockReportEntry& b) {
+		return a.TotalWait != b.TotalWait ? a.TotalWait > b.TotalWait : a.ContentionCount > b.ContentionCount;
+	});
+
+	if (maxEntries > 0 && report.size() > maxEntries)
+		report.resize(maxEntries);
+
+	return report;
+}
+
+void LockProfiler::DumpReport(size_t maxEntries) const
+{
+	std::vector<LockReportEntry> report = GetReport(maxEntries);
+
+	std::wostringstream stream;
+	stream << std::fixed << std::setprecision(3);
+	stream << L"Lock contention report, worst " << report.size() << L" locks by total wait time";
+
+	for (const auto& entry : report)
+	{
+		const double contentionPercent = entry.AcquireCount > 0 ?
+			static_cast<double>(entry.ContentionCount) / static_cast<double>(entry.AcquireCount) * 100.0 : 0.0;
+
+		stream << L"\n" << std::wstring(entry.Name.begin(), entry.Name.end())
+			<< L": acquired " << entry.AcquireCount
+			<< L", contended " << entry.ContentionCount << L" (" << contentionPercent << L"%)"
+			<< L", wait total " << entry.TotalWait * 1000.0
+			<< L" max " << entry.MaxWait * 1000.0
+			<< L" p99 " << entry.P99Wait * 1000.0
+			<< L", hold total " << entry.TotalHold * 1000.0
+			<< L" max " << entry.MaxHold * 1000.0
+			<< L" mean " << entry.MeanHold * 1000.0 << L" (ms)";
+	}
+
+	NE_MESSAGE(stream.str().c_str(), "Profiling"_id);
+}
+
+void LockProfiler::Reset()
+{
+	std::lock_guard<std::mutex> lock(RegistryLock);
+
+	for (auto& statistics : Locks)
+	{
+		statistics->AcquireCount.store(0, std::memory_order_relaxed);
+		statistics->ContentionCount.store(0, std::memory_order_relaxed);
+		statistics->TotalWaitNs.store(0, std::memory_order_relaxed);
+		statistics->MaxWaitNs.store(0, std::memory_order_relaxed);
+		statistics->TotalHoldNs.store(0, std::memory_order_relaxed);
+		statistics->MaxHoldNs.store(0, std::memory_order_relaxed);
+		statistics->WaitTimes.Reset();
+	}
+}
+
+ProfiledMutex::ProfiledMutex(const char* name)
+	:Statistics(LockProfiler::GetInstance()->RegisterLock(name))
+{
+}
+
+void ProfiledMutex::lock()
+{
+	//Uncontended acquisitions skip the wait timing
+	if (Mutex.try_lock())
+	{
+		OnAcquired(steady_clock::now());
+		return;
+	}
+
+	const steady_clock::time_point waitStart = steady_clock::now();
+
+	Mutex.lock();
+
+	const steady_clock::time_point acquireTime = steady_clock::now();
+	const uint64_t waitNs = ToNanoseconds(acquireTime - waitStart);
+
+	Statistics->ContentionCount.fetch_add(1, std::memory_order_relaxed);
+	Statistics->TotalWaitNs.fetch_add(waitNs, std::memory_order_relaxed);
+	UpdateMax(Statistics->MaxWaitNs, waitNs);
+	Statistics->WaitTimes.RecordMicroseconds(waitNs / 1000);
+
+	OnAcquired(acquireTime);
+}
+
+bool ProfiledMutex::try_lock()
+{
+	if (!Mutex.try_lock())
+		return false;
+
+	OnAcquired(steady_clock::now());
+
+	return true;
+}
+
+void ProfiledMutex::unlock()
+{
+	const uint64_t holdNs = ToNanoseconds(steady_clock::now() - AcquireTime);
+
+	Statistics->TotalHoldNs.fetch_add(holdNs, std::memory_order_relaxed);
+	UpdateMax(Statistics->MaxHoldNs, holdNs);
+
+	Mutex.unlock();
+}
+
+void ProfiledMutex::OnAcquired(steady_clock::time_point acquireTime)
+{
+	AcquireTime = acquireTime;
+
+	Statistics->AcquireCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+}
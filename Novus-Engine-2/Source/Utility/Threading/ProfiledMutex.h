@@ -0,0 +1,142 @@
+/*****************************************************************
+ * Copyright (c) 2015 Leif Erkenbrach
+ * Distributed under the terms of the MIT License.
+ * (See accompanying file LICENSE or copy at
+ * http://opensource.org/licenses/MIT)
+ *****************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <deque>
+#include <memory>
+#include <vector>
+#include "Utility/Profiling/TimeHistogram.h"
+
+/**
+ *	Drop-in replacement for std::mutex that records how long threads wait to acquire the lock and how long it is held.
+ *	Works with std::lock_guard, std::unique_lock and std::lock like a regular mutex.
+ *
+ *	Every mutex constructed with the same name shares one set of statistics, so per-instance locks
+ *	(one per resource for example) show up as a single entry in the report.
+ */
+
+namespace novus
+{
+
+struct LockStatistics
+{
+	LockStatistics(const std::string& name)
+		:Name(name),
+		AcquireCount(0),
+		ContentionCount(0),
+		TotalWaitNs(0),
+		MaxWaitNs(0),
+		TotalHoldNs(0),
+		MaxHoldNs(0)
+	{}
+
+	std::string Name;
+
+	std::atomic<uint64_t> AcquireCount;
+	//Number of acquisitions where the lock was already held by another thread
+	std::atomic<uint64_t> ContentionCount;
+
+	std::atomic<uint64_t> TotalWaitNs;
+	std::atomic<uint64_t> MaxWaitNs;
+	std::atomic<uint64_t> TotalHoldNs;
+	std::atomic<uint64_t> MaxHoldNs;
+
+	//Wait times of contended acquisitions only
+	TimeHistogram WaitTimes;
+};
+
+struct LockReportEntry
+{
+	std::string Name;
+
+	uint64_t AcquireCount;
+	uint64_t ContentionCount;
+
+	//All times in seconds
+	double TotalWait;
+	double MaxWait;
+	double P99Wait;
+	double TotalHold;
+	double MaxHold;
+	double MeanHold;
+};
+
+class LockProfiler
+{
+public:
+	static LockProfiler* GetInstance();
+
+	/**
+	 *	Get the statistics for the named lock, creating them the first time a name is used.
+	 *	The returned pointer stays valid for the lifetime of the application.
+	 */
+	LockStatistics* RegisterLock(const char* name);
+
+	/**
+	 *	Builds a report of all registered locks sorted by total wait time, worst first.
+	 *	@param maxEntries Maximum number of locks to include, 0 includes all of them
+	 */
+	std::vector<LockReportEntry> GetReport(size_t maxEntries = 0) const;
+
+	/**
+	 *	Writes the worst offenders to the log.
+	 */
+	void DumpReport(size_t maxEntries = 10) const;
+
+	/**
+	 *	Clears the statistics of every registered lock.
+	 */
+	void Reset();
+
+private:
+	//Only allow access via GetInstance
+	LockProfiler() {}
+	~LockProfiler() {}
+	LockProfiler(const LockProfiler&) = delete;
+	LockProfiler& operator= (const LockProfiler&) = delete;
+
+private:
+	static LockProfiler* StaticInstance;
+
+	mutable std::mutex RegistryLock;
+
+	std::deque<std::unique_ptr<LockStatistics>> Locks;
+};
+
+class ProfiledMutex
+{
+public:
+	explicit ProfiledMutex(const char* name);
+
+	void lock();
+	bool try_lock();
+	void unlock();
+
+	const LockStatistics* GetStatistics() const { return Statistics; }
+
+private:
+	ProfiledMutex(const ProfiledMutex&) = delete;
+	ProfiledMutex& operator= (const ProfiledMutex&) = delete;
+
+	void OnAcquired(std::chrono::steady_clock::time_point acquireTime);
+
+private:
+	std::mutex Mutex;
+
+	LockStatistics* Statistics;
+
+	//Only written by the thread holding the lock
+	std::chrono::steady_clock::time_point AcquireTime;
+};
+
+}
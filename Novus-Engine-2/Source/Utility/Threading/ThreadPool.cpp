@@ -0,0 +1,164 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace novus
+{
+
+namespace
+{
+	thread_local bool bIsPoolWorker = false;
+
+	//Number of ParallelFor calls the thread is inside of as the calling thread, its bodies can call ParallelFor again
+	thread_local uint32_t ParallelForDepth = 0;
+
+	struct ParallelForScope
+	{
+		ParallelForScope() { ParallelForDepth++; }
+		~ParallelForScope() { ParallelForDepth--; }
+	};
+}
+
+ThreadPool* ThreadPool::StaticInstance = nullptr;
+
+ThreadPool* ThreadPool::GetInstance()
+{
+	if (StaticInstance == nullptr)
+	{
+		const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+		StaticInstance = new ThreadPool(hardwareThreads > 1 ? hardwareThreads - 1 : 1);
+	}
+
+	return StaticInstance;
+}
+
+ThreadPool::ThreadPool(uint32_t threadCount)
+	:JobCount(0),
+	JobGrainSize(1),
+	JobId(0),
+	NextIndex(0),
+	ActiveWorkers(0),
+	bShutdown(false)
+{
+	Workers.reserve(threadCount);
+
+	for (uint32_t i = 0; i < threadCount; i++)
+	{
+		Workers.push_back(std::thread(&ThreadPool::WorkerMain, this));
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(Lock);
+		bShutdown = true;
+	}
+
+	WorkAvailable.notify_all();
+
+	for (auto& worker : Workers)
+	{
+		worker.join();
+	}
+}
+
+bool ThreadPool::IsWorkerThread()
+{
+	return bIsPoolWorker;
+}
+
+void ThreadPool::ParallelFor(size_t count, size_t grainSize, const Delegate<void, size_t, size_t>& body)
+{
+	if (count == 0)
+		return;
+
+	grainSize = std::max<size_t>(grainSize, 1);
+
+	//Not worth waking anyone for a single range, and nested calls from a worker or from the calling thread's share of the ranges would wait on themselves
+	if (Workers.empty() || count <= grainSize || bIsPoolWorker || ParallelForDepth > 0)
+	{
+		RunRanges(body, count, grainSize);
+		return;
+	}
+
+	ParallelForScope scope;
+	std::lock_guard<std::mutex> jobLock(JobLock);
+
+	{
+		std::unique_lock<std::mutex> lock(Lock);
+
+		//Workers still finishing up the previous job hold on to its settings
+		WorkFinished.wait(lock, [this] { return ActiveWorkers == 0; });
+
+		JobBody = body;
+		JobCount = count;
+		JobGrainSize = grainSize;
+		NextIndex.store(0, std::memory_order_relaxed);
+		JobId++;
+	}
+
+	WorkAvailable.notify_all();
+
+	//The calling thread takes ranges too rather than sitting idle
+	size_t begin;
+	while ((begin = NextIndex.fetch_add(grainSize, std::memory_order_relaxed)) < count)
+	{
+		body(begin, std::min(begin + grainSize, count));
+	}
+
+	//Every range has been claimed, the ones taken by workers are done once no worker is active
+	std::unique_lock<std::mutex> lock(Lock);
+	WorkFinished.wait(lock, [this] { return ActiveWorkers == 0; });
+}
+
+void ThreadPool::RunRanges(const Delegate<void, size_t, size_t>& body, size_t count, size_t grainSize)
+{
+	for (size_t begin = 0; begin < count; begin += grainSize)
+	{
+		body(begin, std::min(begin + grainSize, count));
+	}
+}
+
+void ThreadPool::WorkerMain()
+{
+	bIsPoolWorker = true;
+
+	uint64_t lastJobId = 0;
+
+	while (true)
+	{
+		Delegate<void, size_t, size_t> body;
+		size_t count;
+		size_t grainSize;
+
+		{
+			std::unique_lock<std::mutex> lock(Lock);
+			WorkAvailable.wait(lock, [&] { return bShutdown || JobId != lastJobId; });
+
+			if (bShutdown)
+				return;
+
+			lastJobId = JobId;
+			body = JobBody;
+			count = JobCount;
+			grainSize = JobGrainSize;
+
+			ActiveWorkers++;
+		}
+
+		size_t begin;
+		while ((begin = NextIndex.fetch_add(grainSize, std::memory_order_relaxed)) < count)
+		{
+			body(begin, std::min(begin + grainSize, count));
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(Lock);
+			ActiveWorkers--;
+		}
+
+		WorkFinished.notify_all();
+	}
+}
+
+}
@@ -7,9 +7,77 @@
 
 #pragma once
 
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Utility/Delegates/Delegate.h"
+
 namespace novus
 {
 
+/**
+ *	Fixed set of worker threads that split loops between themselves and the calling thread.
+ *	Only one ParallelFor runs at a time, calls from other threads wait for the current one to finish.
+ */
+class ThreadPool
+{
+public:
+	/**
+	 *	Shared pool with one worker per hardware thread, minus one for the thread that calls ParallelFor.
+	 */
+	static ThreadPool* GetInstance();
+
+	/**
+	 *	@param threadCount Number of worker threads, the calling thread also does work during ParallelFor
+	 */
+	explicit ThreadPool(uint32_t threadCount);
+	~ThreadPool();
+
+	uint32_t GetThreadCount() const { return static_cast<uint32_t>(Workers.size()); }
+
+	/**
+	 *	Splits [0, count) into ranges of grainSize elements and calls body(begin, end) once per range from the workers and the calling thread.
+	 *	Returns once every range has finished.
+	 *	Calls made from inside a body, on a worker or on the calling thread, run serially on that thread instead of deadlocking.
+	 */
+	void ParallelFor(size_t count, size_t grainSize, const Delegate<void, size_t, size_t>& body);
+
+	/**
+	 *	True if the calling thread is one of this process' pool workers
+	 */
+	static bool IsWorkerThread();
+
+private:
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator= (const ThreadPool&) = delete;
+
+	void WorkerMain();
+	void RunRanges(const Delegate<void, size_t, size_t>& body, size_t count, size_t grainSize);
+
+private:
+	static ThreadPool* StaticInstance;
+
+	std::vector<std::thread> Workers;
+
+	//Serializes ParallelFor calls from different threads
+	std::mutex JobLock;
+
+	std::mutex Lock;
+	std::condition_variable WorkAvailable;
+	std::condition_variable WorkFinished;
+
+	//Current job, only changed while no worker is active
+	Delegate<void, size_t, size_t> JobBody;
+	size_t JobCount;
+	size_t JobGrainSize;
+	uint64_t JobId;
+	std::atomic<size_t> NextIndex;
 
+	uint32_t ActiveWorkers;
+	bool bShutdown;
+};
 
-}
\ No newline at end of file
+}
@@ -10,9 +10,17 @@
 #include <Resources/Shader/D3D12/D3D12Shader.h>
 #include <Math/Quaternion.h>
 #include <Utility/Memory/MallocTracker.h>
+#include <Utility/Profiling/FrameStatistics.h>
+#include <Utility/Profiling/Counters.h>
+#include <Utility/Threading/ProfiledMutex.h>
+#include <Utility/Events/EventBus.h>
+#include <Utility/Threading/ThreadPool.h>
+#include <Math/Random.h>
 
 using namespace DirectX;
 
+NE_DEFINE_COUNTER(DrawCallsCounter, "Render/DrawCalls");
+
 #pragma comment(lib, "D3d12.lib")
 #pragma comment(lib, "d3dcompiler.lib")
 #pragma comment(lib, "DXGI.lib")
@@ -54,6 +62,9 @@ void AppTest::Destroy()
 
 	CloseHandle(HandleEvent);
 
+	novus::FrameStatistics::GetInstance()->DumpSummary();
+	novus::LockProfiler::GetInstance()->DumpReport();
+
 #ifdef DEBUG
 	novus::MallocTracker::GetInstance()->DumpTrackedMemory();
 #endif
@@ -62,7 +73,18 @@ void AppTest::Destroy()
 void AppTest::Update()
 {
 	Timer.Tick();
-	std::cout << Timer.GetDeltaTime() << std::endl;
+
+	//Deliver events queued since the last frame before anything else reacts to them
+	novus::EventBus::GetInstance()->DispatchEvents();
+
+	novus::CounterRegistry::GetInstance()->CaptureSnapshot();
+
+	novus::FrameStatistics* frameStatistics = novus::FrameStatistics::GetInstance();
+	frameStatistics->RecordFrame(Timer.GetDeltaTime());
+
+	//Dump the rolling window every time it has been completely replaced
+	if (frameStatistics->GetFrameCount() % (novus::FrameStatistics::WindowSliceCount * novus::FrameStatistics::FramesPerSlice) == 0)
+		frameStatistics->DumpSummary(true);
 }
 
 void AppTest::Render()
@@ -292,6 +314,41 @@ void AppTest::LoadAssets()
 	//Allocate buffer for all constant buffers
 	PerObjectConstantBuffers.Init(BoxCount, sizeof(CBPerObject), Device.Get());
 
+	ObjectPositionX.resize(BoxCount);
+	ObjectPositionY.resize(BoxCount);
+	ObjectPositionZ.resize(BoxCount);
+	ObjectScaleX.resize(BoxCount);
+	ObjectScaleY.resize(BoxCount);
+	ObjectScaleZ.resize(BoxCount);
+
+	ObjectOrbitPhase.resize(BoxCount);
+
+	for (unsigned int i = 0; i < BoxCount; i++)
+	{
+		//Scaled down along with the orbit radius, never zero so the inverse transpose exists
+		const float scale = 0.04f * static_cast<float>(i + 1) * 0.01f;
+
+		ObjectScaleX[i] = scale;
+		ObjectScaleY[i] = scale;
+		ObjectScaleZ[i] = scale;
+	}
+
+	//Random starting angles and heights. Each range jumps its generator to the first value of its first box,
+	//so every run places the boxes the same way however the pool splits the loop
+	Delegate<void, size_t, size_t> placeBoxes = [this](size_t begin, size_t end)
+	{
+		Pcg32 random(BoxPlacementSeed);
+		random.Advance(begin * 2);
+
+		for (size_t i = begin; i < end; i++)
+		{
+			ObjectOrbitPhase[i] = random.NextFloat(0.0f, Math::TwoPi);
+			ObjectPositionY[i] = random.NextFloat(-1.0f, 1.0f) * static_cast<float>(i) * 0.001f;
+		}
+	};
+
+	ThreadPool::GetInstance()->ParallelFor(BoxCount, 4096, placeBoxes);
+
 	//Create the constant buffer descriptor heap and populate it
 	if (!UseRootLevelCBV)
 	{
@@ -396,6 +453,8 @@ void AppTest::WaitForGPU()
 
 void AppTest::PopulateCommandLists()
 {
+	NE_TRACK_DURATION("PopulateCommandLists");
+
 	std::vector<std::future<void>> futures;
 
 	for (unsigned int i = 0; i < ThreadCount - 1; i++)
@@ -440,45 +499,42 @@ void AppTest::PopulateCommandListAsync(uint32_t threadID)
 
 	CommandListArray[threadID]->Reset(CommandAllocatorArray[threadID].Get(), PSO.Get());
 
-	Matrix4 view = Matrix4::LookAt(Vector3(0.0f, 6.0f, 2.0f), Vector3(), Vector3(0.0f, 1.0f, 0.0f));
-	Matrix4 proj = Matrix4::Perspective(Math::PiOver4, 1280.0f / 720.0f, 0.1f, 1000.0f);
-
 	XMMATRIX viewXM = XMMatrixLookAtRH(XMVectorSet(0.0f, 20.0f, 50.0f, 1.0f), XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
 	XMMATRIX projXM = XMMatrixPerspectiveFovRH(Math::PiOver4, 1280.0f / 720.0f, 1.0f, 10000.0f);
+	XMMATRIX viewProjXM = viewXM * projXM;
 
-	//Update constant buffer
-	CBPerObject perObject;
-
-	void* cbUploadPtr = nullptr;
+	Matrix4 view, viewProj;
+	memcpy_s(&view, sizeof(view), &viewXM, sizeof(viewXM));
+	memcpy_s(&viewProj, sizeof(viewProj), &viewProjXM, sizeof(viewProjXM));
 
 	const unsigned int start = threadID * (BoxCount / ThreadCount);
 	const unsigned int end = start + (BoxCount / ThreadCount);
 
-	//Update the constant buffer view transforms for each object
+	const float timeOffset = 1000.0f;
+	const float timeMultiplier = 0.001f;
+
+	//Each object orbits the origin at a radius and speed proportional to its index, from its random starting angle and at its random height
 	for (unsigned int i = start; i < end; i++)
 	{
-		const float scale = 0.04f * static_cast<float>(i);
-		const float timeOffset = 1000.0f;
-		const float timeMultiplier = 0.001f;
-
-		XMMATRIX world, invTranspose, worldView, worldViewProj;
-		world = XMMatrixScaling(scale, scale, scale) * 
-			XMMatrixTranslation(static_cast<float>(i), 0.0f, 0.0f) * 
-			XMMatrixRotationY(-static_cast<float>((Timer.GetTotalTime() + timeOffset) * static_cast<float>(i)) * timeMultiplier) * 
-			XMMatrixScaling(0.01f, 0.01f, 0.01f);
-
-		worldView = world * viewXM;
-		worldViewProj = worldView * projXM;
-
-		memcpy_s(&perObject.World, sizeof(perObject.World), &world, sizeof(world));
-		memcpy_s(&perObject.WorldViewProj, sizeof(perObject.WorldViewProj), &worldViewProj, sizeof(worldViewProj));
-
-		//Update the constant buffer data for specified object
-		cbUploadPtr = PerObjectConstantBuffers.Map(i);
-		memcpy_s(cbUploadPtr, sizeof(CBPerObject), &perObject, sizeof(perObject));
-		PerObjectConstantBuffers.Unmap(i);
+		const float angle = ObjectOrbitPhase[i] - static_cast<float>((Timer.GetTotalTime() + timeOffset) * static_cast<float>(i)) * timeMultiplier;
+		const float radius = static_cast<float>(i) * 0.01f;
+
+		ObjectPositionX[i] = radius * cosf(angle);
+		ObjectPositionZ[i] = -radius * sinf(angle);
 	}
 
+	ObjectTransformArrays objects;
+	objects.PositionX = &ObjectPositionX[start];
+	objects.PositionY = &ObjectPositionY[start];
+	objects.PositionZ = &ObjectPositionZ[start];
+	objects.ScaleX = &ObjectScaleX[start];
+	objects.ScaleY = &ObjectScaleY[start];
+	objects.ScaleZ = &ObjectScaleZ[start];
+
+	//Write the constant buffers of this thread's objects straight into the mapped pool
+	ComputePerObjectConstants(view, viewProj, objects, end - start, PerObjectConstantBuffers.Map(start), PerObjectConstantBuffers.GetAlignedStride());
+	NE_COUNTER_ADD(BufferPoolBytesWrittenCounter, static_cast<uint64_t>(end - start) * PerObjectConstantBuffers.GetAlignedStride());
+
 	if (!UseRootLevelCBV)
 	{
 		ID3D12DescriptorHeap* descriptorHeap = ConstantBufferDescriptorHeap->GetBaseHeap();
@@ -518,6 +574,8 @@ void AppTest::PopulateCommandListAsync(uint32_t threadID)
 				CommandListArray[threadID]->DrawIndexedInstanced(IndexCount, 1, 0, 0, 0);
 			}
 		}
+
+		NE_COUNTER_ADD(DrawCallsCounter, end - start);
 	}
 	else
 	{
@@ -528,6 +586,8 @@ void AppTest::PopulateCommandListAsync(uint32_t threadID)
 		{
 			CommandListArray[threadID]->ExecuteBundle(CommandBundleArray[i].Get());
 		}
+
+		NE_COUNTER_ADD(DrawCallsCounter, (bundleEnd - bundleStart) * ObjectsPerBundle);
 	}
 
 	SetResourceBarrier(CommandListArray[threadID].Get(), RenderTarget.Get(), D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PRESENT);
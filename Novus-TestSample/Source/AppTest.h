@@ -19,6 +19,8 @@
 #include <functional>
 #include <Math/Matrix3.h>
 #include <Math/Matrix4.h>
+#include <Utility/Metadata/Metadata.h>
+#include <Rendering/PerObjectConstants.h>
 #include <Utility/Graphics/D3D12BufferPool.h>
 #include <Rendering/RHI/D3D12/D3D12RHIResources.h>
 
@@ -29,13 +31,8 @@ namespace novus
 
 class AppTest
 {
-struct CBPerObject
-{
-	Matrix4 World;
-	Matrix4 WorldView;
-	Matrix4 WorldViewProj;
-	Matrix3 WorldInvTranspose;
-};
+public:
+typedef PerObjectConstants CBPerObject;
 
 struct CBPerInstance
 {
@@ -45,7 +42,6 @@ struct CBPerInstance
 	float pad2;
 };
 
-public:
 	AppTest();
 	~AppTest();
 
@@ -101,6 +97,7 @@ private:
 	static const int BoxCount = 120000;
 	static const int ObjectsPerBundle = 200;
 	static const unsigned int BundleCount = BoxCount / ObjectsPerBundle;
+	static const uint64_t BoxPlacementSeed = 0x4E6F767573ull;
 
 	std::array<ComPtr<ID3D12CommandAllocator>, ThreadCount> CommandAllocatorArray;
 	ComPtr<ID3D12CommandAllocator> CommandBundleAllocator;
@@ -138,6 +135,13 @@ private:
 
 	D3D12BufferPool PerObjectConstantBuffers;
 
+	//Object transforms split per component for ComputePerObjectConstants, each thread updates the positions of its own range
+	std::vector<float> ObjectPositionX, ObjectPositionY, ObjectPositionZ;
+	std::vector<float> ObjectScaleX, ObjectScaleY, ObjectScaleZ;
+
+	//Starting angle of each object's orbit, generated in parallel from BoxPlacementSeed
+	std::vector<float> ObjectOrbitPhase;
+
 	std::unique_ptr<D3D12RHIDescriptorHeap> ConstantBufferDescriptorHeap;
 
 	D3D12_VERTEX_BUFFER_VIEW DescViewBufVert;
@@ -146,4 +150,13 @@ private:
 	uint32_t IndexCount;
 };
 
-}
\ No newline at end of file
+}
+
+NE_REFLECT_BEGIN(novus::AppTest::CBPerInstance)
+	NE_REFLECT_FIELD(Position)
+	NE_REFLECT_FIELD(pad)
+	NE_REFLECT_FIELD(Scale)
+	NE_REFLECT_FIELD(pad2)
+NE_REFLECT_END(novus::AppTest::CBPerInstance)
+
+static_assert(novus::IsConstantBufferLayoutValid<novus::AppTest::CBPerInstance>(), "CBPerInstance doesn't match the HLSL constant buffer packing");
\ No newline at end of file
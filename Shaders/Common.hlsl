@@ -31,4 +31,19 @@
 
 #endif
 
+//Normal of a GeometryGenerator::PackedVertex, e is the R16G16_SNORM octahedral encoding
+float3 DecodeOctahedralNormal(float2 e)
+{
+	float3 n = float3(e.xy, 1.0f - abs(e.x) - abs(e.y));
+	float t = saturate(-n.z);
+	n.xy += (n.xy >= 0.0f) ? -t : t;
+	return normalize(n);
+}
+
+//Tangent of a GeometryGenerator::PackedVertex, t is the R10G10B10A2_UNORM value
+float3 DecodePackedTangent(float4 t)
+{
+	return t.xyz * 2.0f - 1.0f;
+}
+
 #endif //COMMON_HLSL
\ No newline at end of file
@@ -13,8 +13,9 @@
 
 cbuffer CBPerObject : register(b0)
 {
-	float4x4 cWorld;
-	float4x4 cWorldView;
+	//Affine transforms without their constant last column, see Matrix3x4
+	row_major float3x4 cWorld;
+	row_major float3x4 cWorldView;
 	float4x4 cWorldViewProj;
 	float3x3 cWorldInvTranspose;
 };
@@ -37,8 +38,8 @@ PS_INPUT VS(VS_INPUT input)
 	PS_INPUT output;
 
 	output.Position = mul(cWorldViewProj, float4(input.Position, 1.0f));
-	output.PositionW = mul(cWorld, float4(input.Position, 1.0f)).xyz;
-	output.Normal = mul(cWorld, float4(input.Normal, 0.0f)).xyz;
+	output.PositionW = mul(cWorld, float4(input.Position, 1.0f));
+	output.Normal = mul(cWorld, float4(input.Normal, 0.0f));
 
 	return output;
 }